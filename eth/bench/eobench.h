@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOBENCH_H_
+#define _EOBENCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       eobench.h
+    @brief      This header file contains the helpers shared by the benchmarks of embobj.
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_bench Benchmarks of embobj
+    The program embobj_bench, built with the cmake option WITH_EMBOBJ_BENCHMARKS, measures the objects of embobj on
+    the host and prints the results as a json document on stdout:
+
+        { "benchmark": "embobj", "mempool": "dynamic", "clock": "monotonic", "quick": false, "results": [
+            { "group": "containers", "object": "EOfifo", "itemsize": 4, "capacity": 64, "mutex": "none", "op": "put+getrem", "ns": 12.5 },
+            ... ] }
+
+    Every result is the best of EOBENCH_RUNS runs, in nano-seconds per operation. Its parameters depend on the group.
+    The results of the groups which care about the latency of single operations, such as find, also have the members
+    "p50", "p99" and "max": the percentiles of the time of EOBENCH_SAMPLES operations timed one by one.
+    The arguments of the program are the names of the groups to run (all of them if none is given), --quick to run
+    fewer iterations, --mempool slab to initialise the EOtheMemoryPool in slab mode and --clock to choose the clock
+    of the EOYtheSystem (monotonic by default).
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define EOBENCH_RUNS        5
+
+#define EOBENCH_SAMPLES     20000
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+// it executes ops operations of the benchmark on arg
+typedef void (*eobench_fp_t)(void *arg, uint32_t ops);
+
+// the distribution of the time of single operations, in nano-seconds
+typedef struct
+{
+    double          p50;
+    double          p99;
+    double          max;
+} eobench_percentiles_t;
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+// monotonic time in nano-seconds
+extern uint64_t eobench_now(void);
+
+// the name of the clock of the EOYtheSystem given by --clock
+extern const char * eobench_clockname(void);
+
+// the number of operations of a run: ops, or a tenth of it with --quick
+extern uint32_t eobench_ops(uint32_t ops);
+
+// the best time of EOBENCH_RUNS calls of run(arg, ops), in nano-seconds per operation
+extern double eobench_measure(eobench_fp_t run, void *arg, uint32_t ops);
+
+// the percentiles of samples calls of run(arg, 1), each one timed by itself and without the cost of reading the clock
+extern void eobench_percentiles(eobench_fp_t run, void *arg, uint32_t samples, eobench_percentiles_t *pct);
+
+// it prints one result. params are further json members, e.g. "\"itemsize\": 4, \"capacity\": 64", or NULL
+extern void eobench_report(const char *group, const char *object, const char *params, const char *op, double ns);
+
+// as eobench_report() but with also the percentiles
+extern void eobench_report_percentiles(const char *group, const char *object, const char *params, const char *op, double ns, const eobench_percentiles_t *pct);
+
+// the groups of benchmarks
+extern void eobench_containers(void);
+extern void eobench_fifo(void);
+extern void eobench_list(void);
+extern void eobench_find(void);
+extern void eobench_timers(void);
+extern void eobench_clocks(void);
+
+
+/** @}
+    end of group eo_bench
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
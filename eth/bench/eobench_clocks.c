@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include <time.h>
+
+#include "EoCommon.h"
+#include "EOVtheSystem.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define EOBENCH_CLOCKS_ops          2000000
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_clocks_lifetime(void *arg, uint32_t ops);
+static void s_eobench_clocks_nanotime(void *arg, uint32_t ops);
+static void s_eobench_clocks_posix(void *arg, uint32_t ops);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+// it keeps the compiler from removing the calls
+static volatile uint64_t s_eobench_clocks_sink = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// the cost of a call of eov_sys_LifeTimeGet() and of eov_sys_NanoTimeGet() with the clock of the EOYtheSystem given
+// by --clock, and of clock_gettime(CLOCK_MONOTONIC) as reference. the clock is chosen once by eoy_sys_Initialise(),
+// thus the clocks are compared by running the program once for each of them.
+extern void eobench_clocks(void)
+{
+    char params[48];
+    uint32_t ops = eobench_ops(EOBENCH_CLOCKS_ops);
+
+    snprintf(params, sizeof(params), "\"clock\": \"%s\"", eobench_clockname());
+
+    eobench_report("clocks", "EOVtheSystem", params, "lifetimeget", eobench_measure(s_eobench_clocks_lifetime, NULL, ops));
+    eobench_report("clocks", "EOVtheSystem", params, "nanotimeget", eobench_measure(s_eobench_clocks_nanotime, NULL, ops));
+    eobench_report("clocks", "posix", "\"clock\": \"CLOCK_MONOTONIC\"", "clock_gettime", eobench_measure(s_eobench_clocks_posix, NULL, ops));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_clocks_lifetime(void *arg, uint32_t ops)
+{
+    EOVtheSystem *sys = eov_sys_GetHandle();
+    uint64_t sum = 0;
+    uint32_t i = 0;
+
+    (void)arg;
+
+    for(i=0; i<ops; i++)
+    {
+        sum += eov_sys_LifeTimeGet(sys);
+    }
+
+    s_eobench_clocks_sink = sum;
+}
+
+
+static void s_eobench_clocks_nanotime(void *arg, uint32_t ops)
+{
+    EOVtheSystem *sys = eov_sys_GetHandle();
+    eOnanotime_t nt = 0;
+    uint64_t sum = 0;
+    uint32_t i = 0;
+
+    (void)arg;
+
+    for(i=0; i<ops; i++)
+    {
+        eov_sys_NanoTimeGet(sys, &nt);
+        sum += nt;
+    }
+
+    s_eobench_clocks_sink = sum;
+}
+
+
+static void s_eobench_clocks_posix(void *arg, uint32_t ops)
+{
+    struct timespec ts;
+    uint64_t sum = 0;
+    uint32_t i = 0;
+
+    (void)arg;
+
+    for(i=0; i<ops; i++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        sum += (uint64_t)ts.tv_nsec;
+    }
+
+    s_eobench_clocks_sink = sum;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
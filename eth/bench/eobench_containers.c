@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOVmutex.h"
+#include "EOYmutex.h"
+#include "EOfifo.h"
+#include "EOdeque.h"
+#include "EOvector.h"
+#include "EOlist.h"
+#include "EOarray.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the number of push+pop pairs of a run
+#define EOBENCH_CONTAINERS_ops          200000
+
+#define EOBENCH_CONTAINERS_maxitemsize  248
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// a run fills the container up to its capacity and then it empties it, as many times as needed for ops pairs.
+// the containers other than the EOfifo and the EOtheMemoryPool have no mutex of their own: in mutex mode every
+// operation is enclosed by eov_mutex_Take() / eov_mutex_Release() of an external mutex, as their users do.
+typedef struct
+{
+    void                *object;
+    EOVmutexDerived     *mutex;
+    uint16_t            capacity;
+    uint16_t            itemsize;
+} eobench_container_t;
+
+
+typedef enum
+{
+    eobench_mutex_none      = 0,
+    eobench_mutex_internal  = 1,    // the mutex of the object
+    eobench_mutex_external  = 2     // a mutex around every call
+} eobench_mutex_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_fifo(void *arg, uint32_t ops);
+static void s_eobench_deque(void *arg, uint32_t ops);
+static void s_eobench_vector(void *arg, uint32_t ops);
+static void s_eobench_list(void *arg, uint32_t ops);
+static void s_eobench_array(void *arg, uint32_t ops);
+static void s_eobench_mempool(void *arg, uint32_t ops);
+
+static void s_eobench_lock(eobench_container_t *c);
+static void s_eobench_unlock(eobench_container_t *c);
+
+static void s_eobench_containers_report(const char *object, const char *op, const eobench_container_t *c, eobench_mutex_t mutex, double ns);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint16_t s_eobench_itemsizes[] = { 1, 4, 24, 72, 248 };
+
+static const uint16_t s_eobench_capacities[] = { 16, 64, 256 };
+
+static uint8_t s_eobench_item[EOBENCH_CONTAINERS_maxitemsize] = { 0 };
+
+static uint8_t s_eobench_out[EOBENCH_CONTAINERS_maxitemsize] = { 0 };
+
+static void * s_eobench_blocks[256] = { NULL };
+
+// it keeps the compiler from removing the reads
+static volatile uint8_t s_eobench_sink = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void eobench_containers(void)
+{
+    eobench_container_t c = { NULL, NULL, 0, 0 };
+    EOVmutexDerived *mutex = NULL;
+    uint8_t m = 0;
+    uint8_t s = 0;
+    uint8_t k = 0;
+    uint32_t ops = eobench_ops(EOBENCH_CONTAINERS_ops);
+
+    memset(s_eobench_item, 0xa5, sizeof(s_eobench_item));
+
+    // the mutex of the EOtheMemoryPool cannot be removed, thus all the tests without mutex come first
+    for(m=0; m<2; m++)
+    {
+        if(1 == m)
+        {
+            mutex = eoy_mutex_New();
+            eo_mempool_SetMutex(eo_mempool_GetHandle(), eoy_mutex_New(), eok_reltimeINFINITE);
+        }
+
+        for(s=0; s<sizeof(s_eobench_itemsizes)/sizeof(s_eobench_itemsizes[0]); s++)
+        {
+            for(k=0; k<sizeof(s_eobench_capacities)/sizeof(s_eobench_capacities[0]); k++)
+            {
+                c.itemsize = s_eobench_itemsizes[s];
+                c.capacity = s_eobench_capacities[k];
+
+                // eo_fifo_Delete() returns with the mutex taken, thus the fifo has its own
+                c.mutex = (1 == m) ? (eoy_mutex_New()) : (NULL);
+                c.object = eo_fifo_New(c.itemsize, c.capacity, NULL, 0, NULL, NULL, c.mutex);
+                s_eobench_containers_report("EOfifo", "put+getrem", &c, (eobench_mutex_t)m, eobench_measure(s_eobench_fifo, &c, ops));
+                eo_fifo_Delete((EOfifo*)c.object);
+                if(NULL != c.mutex)
+                {
+                    eoy_mutex_Delete((EOYmutex*)c.mutex);
+                }
+
+                c.mutex = mutex;
+                c.object = eo_deque_New(c.itemsize, c.capacity, NULL, 0, NULL, NULL);
+                s_eobench_containers_report("EOdeque", "pushback+popfront", &c, (eobench_mutex_t)(2*m), eobench_measure(s_eobench_deque, &c, ops));
+                eo_deque_Delete((EOdeque*)c.object);
+
+                c.object = eo_vector_New(c.itemsize, c.capacity, NULL, 0, NULL, NULL);
+                s_eobench_containers_report("EOvector", "pushback+popback", &c, (eobench_mutex_t)(2*m), eobench_measure(s_eobench_vector, &c, ops));
+                eo_vector_Delete((EOvector*)c.object);
+
+                c.object = eo_list_New(c.itemsize, c.capacity, NULL, 0, NULL, NULL);
+                s_eobench_containers_report("EOlist", "pushback+popfront", &c, (eobench_mutex_t)(2*m), eobench_measure(s_eobench_list, &c, ops));
+                eo_list_Delete((EOlist*)c.object);
+
+                c.object = eo_list_NewIndexed(c.itemsize, c.capacity, NULL, 0, NULL, NULL);
+                s_eobench_containers_report("EOlist-indexed", "pushback+popfront", &c, (eobench_mutex_t)(2*m), eobench_measure(s_eobench_list, &c, ops));
+                eo_list_Delete((EOlist*)c.object);
+
+                // the capacity of an EOarray is at most 255
+                c.capacity = EO_MIN(c.capacity, 255);
+                c.object = eo_array_New((uint8_t)c.capacity, (uint8_t)c.itemsize, NULL);
+                s_eobench_containers_report("EOarray", "pushback+popback", &c, (eobench_mutex_t)(2*m), eobench_measure(s_eobench_array, &c, ops));
+                eo_array_Delete((EOarray*)c.object);
+                c.capacity = s_eobench_capacities[k];
+
+                // a block of itemsize bytes for every item
+                c.mutex = NULL;
+                c.object = eo_mempool_GetHandle();
+                s_eobench_containers_report("EOtheMemoryPool", "new+delete", &c, (eobench_mutex_t)m, eobench_measure(s_eobench_mempool, &c, ops));
+            }
+        }
+    }
+
+    if(NULL != mutex)
+    {
+        eoy_mutex_Delete((EOYmutex*)mutex);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_fifo(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOfifo *fifo = (EOfifo*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            eo_fifo_Put(fifo, s_eobench_item, eok_reltimeINFINITE);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            eo_fifo_GetRem(fifo, s_eobench_out, eok_reltimeINFINITE);
+        }
+        done += c->capacity;
+    }
+    s_eobench_sink = s_eobench_out[0];
+}
+
+
+static void s_eobench_deque(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOdeque *deque = (EOdeque*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            eo_deque_PushBack(deque, s_eobench_item);
+            s_eobench_unlock(c);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            memcpy(s_eobench_out, eo_deque_Front(deque), c->itemsize);
+            eo_deque_PopFront(deque);
+            s_eobench_unlock(c);
+        }
+        done += c->capacity;
+    }
+    s_eobench_sink = s_eobench_out[0];
+}
+
+
+static void s_eobench_vector(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOvector *vector = (EOvector*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            eo_vector_PushBack(vector, s_eobench_item);
+            s_eobench_unlock(c);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            memcpy(s_eobench_out, eo_vector_At(vector, c->capacity-1-i), c->itemsize);
+            eo_vector_PopBack(vector);
+            s_eobench_unlock(c);
+        }
+        done += c->capacity;
+    }
+    s_eobench_sink = s_eobench_out[0];
+}
+
+
+static void s_eobench_list(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOlist *list = (EOlist*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            eo_list_PushBack(list, s_eobench_item);
+            s_eobench_unlock(c);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            memcpy(s_eobench_out, eo_list_Front(list), c->itemsize);
+            eo_list_PopFront(list);
+            s_eobench_unlock(c);
+        }
+        done += c->capacity;
+    }
+    s_eobench_sink = s_eobench_out[0];
+}
+
+
+static void s_eobench_array(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOarray *array = (EOarray*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            eo_array_PushBack(array, s_eobench_item);
+            s_eobench_unlock(c);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_lock(c);
+            memcpy(s_eobench_out, eo_array_At(array, (uint8_t)(c->capacity-1-i)), c->itemsize);
+            eo_array_PopBack(array);
+            s_eobench_unlock(c);
+        }
+        done += c->capacity;
+    }
+    s_eobench_sink = s_eobench_out[0];
+}
+
+
+static void s_eobench_mempool(void *arg, uint32_t ops)
+{
+    eobench_container_t *c = (eobench_container_t*)arg;
+    EOtheMemoryPool *mempool = (EOtheMemoryPool*)c->object;
+    uint32_t done = 0;
+    uint16_t i = 0;
+
+    while(done < ops)
+    {
+        for(i=0; i<c->capacity; i++)
+        {
+            s_eobench_blocks[i] = eo_mempool_New(mempool, c->itemsize);
+        }
+        for(i=0; i<c->capacity; i++)
+        {
+            eo_mempool_Delete(mempool, s_eobench_blocks[i]);
+        }
+        done += c->capacity;
+    }
+}
+
+
+static void s_eobench_lock(eobench_container_t *c)
+{
+    if(NULL != c->mutex)
+    {
+        eov_mutex_Take(c->mutex, eok_reltimeINFINITE);
+    }
+}
+
+
+static void s_eobench_unlock(eobench_container_t *c)
+{
+    if(NULL != c->mutex)
+    {
+        eov_mutex_Release(c->mutex);
+    }
+}
+
+
+static void s_eobench_containers_report(const char *object, const char *op, const eobench_container_t *c, eobench_mutex_t mutex, double ns)
+{
+    static const char * const mutexnames[] = { "none", "internal", "external" };
+    char params[96];
+
+    snprintf(params, sizeof(params), "\"itemsize\": %u, \"capacity\": %u, \"mutex\": \"%s\"", c->itemsize, c->capacity, mutexnames[mutex]);
+    eobench_report("containers", object, params, op, ns);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+#include <pthread.h>
+#include <sched.h>
+
+#include "EoCommon.h"
+#include "EOVmutex.h"
+#include "EOYmutex.h"
+#include "EOfifo.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the number of items which go through the fifo in a run
+#define EOBENCH_FIFO_ops            200000
+
+#define EOBENCH_FIFO_capacity       256
+
+#define EOBENCH_FIFO_maxthreads     4
+
+#define EOBENCH_FIFO_maxitemsize    72
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// a run starts numthreads producers and numthreads consumers. every producer puts ops/numthreads items and every
+// consumer removes as many. a full or an empty fifo is retried after a sched_yield(), thus the result is the wall
+// time per item of the whole transfer, waits included.
+typedef struct
+{
+    EOfifo              *fifo;
+    uint16_t            itemsize;
+    uint8_t             numthreads;
+    uint32_t            itemsperthread;
+} eobench_fifo_t;
+
+
+typedef struct
+{
+    const char              *name;
+    eOfifo_concurrency_t    concurrency;
+    uint8_t                 numthreads;
+} eobench_fifo_case_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_fifo_transfer(void *arg, uint32_t ops);
+static void * s_eobench_fifo_producer(void *arg);
+static void * s_eobench_fifo_consumer(void *arg);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint16_t s_eobench_fifo_itemsizes[] = { 4, 72 };
+
+// the spsc fifo allows only one producer and one consumer
+static const eobench_fifo_case_t s_eobench_fifo_cases[] =
+{
+    { "mutex",  eo_fifo_concurrency_mutex,  1 },
+    { "mutex",  eo_fifo_concurrency_mutex,  2 },
+    { "mutex",  eo_fifo_concurrency_mutex,  4 },
+    { "spsc",   eo_fifo_concurrency_spsc,   1 },
+    { "mpmc",   eo_fifo_concurrency_mpmc,   1 },
+    { "mpmc",   eo_fifo_concurrency_mpmc,   2 },
+    { "mpmc",   eo_fifo_concurrency_mpmc,   4 }
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void eobench_fifo(void)
+{
+    eobench_fifo_t b = { NULL, 0, 0, 0 };
+    EOVmutexDerived *mutex = NULL;
+    char params[96];
+    uint8_t s = 0;
+    uint8_t k = 0;
+    uint32_t ops = eobench_ops(EOBENCH_FIFO_ops);
+    double ns = 0;
+
+    for(s=0; s<sizeof(s_eobench_fifo_itemsizes)/sizeof(s_eobench_fifo_itemsizes[0]); s++)
+    {
+        for(k=0; k<sizeof(s_eobench_fifo_cases)/sizeof(s_eobench_fifo_cases[0]); k++)
+        {
+            const eobench_fifo_case_t *c = &s_eobench_fifo_cases[k];
+
+            b.itemsize = s_eobench_fifo_itemsizes[s];
+            b.numthreads = c->numthreads;
+            b.itemsperthread = ops / c->numthreads;
+
+            // eo_fifo_Delete() returns with the mutex taken, thus every fifo has its own
+            mutex = NULL;
+            if(eo_fifo_concurrency_mutex == c->concurrency)
+            {
+                mutex = eoy_mutex_New();
+                b.fifo = eo_fifo_New(b.itemsize, EOBENCH_FIFO_capacity, NULL, 0, NULL, NULL, mutex);
+            }
+            else
+            {
+                b.fifo = eo_fifo_NewLockFree(b.itemsize, EOBENCH_FIFO_capacity, NULL, 0, NULL, NULL, c->concurrency);
+            }
+
+            if(NULL == b.fifo)
+            {
+                // no atomic operations on this system
+                continue;
+            }
+
+            ns = eobench_measure(s_eobench_fifo_transfer, &b, b.itemsperthread * b.numthreads);
+
+            snprintf(params, sizeof(params), "\"itemsize\": %u, \"capacity\": %u, \"concurrency\": \"%s\", \"producers\": %u, \"consumers\": %u",
+                     b.itemsize, EOBENCH_FIFO_capacity, c->name, b.numthreads, b.numthreads);
+            eobench_report("fifo", "EOfifo", params, "put+getrem", ns);
+
+            eo_fifo_Delete(b.fifo);
+
+            if(NULL != mutex)
+            {
+                eoy_mutex_Delete((EOYmutex*)mutex);
+            }
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_fifo_transfer(void *arg, uint32_t ops)
+{
+    eobench_fifo_t *b = (eobench_fifo_t*)arg;
+    pthread_t producers[EOBENCH_FIFO_maxthreads];
+    pthread_t consumers[EOBENCH_FIFO_maxthreads];
+    uint8_t i = 0;
+
+    // ops is already itemsperthread * numthreads
+    (void)ops;
+
+    for(i=0; i<b->numthreads; i++)
+    {
+        pthread_create(&consumers[i], NULL, s_eobench_fifo_consumer, b);
+        pthread_create(&producers[i], NULL, s_eobench_fifo_producer, b);
+    }
+
+    for(i=0; i<b->numthreads; i++)
+    {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+}
+
+
+static void * s_eobench_fifo_producer(void *arg)
+{
+    eobench_fifo_t *b = (eobench_fifo_t*)arg;
+    uint8_t item[EOBENCH_FIFO_maxitemsize];
+    uint32_t n = 0;
+
+    memset(item, 0xa5, sizeof(item));
+
+    for(n=0; n<b->itemsperthread; n++)
+    {
+        while(eores_OK != eo_fifo_Put(b->fifo, item, 0))
+        {
+            sched_yield();
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void * s_eobench_fifo_consumer(void *arg)
+{
+    eobench_fifo_t *b = (eobench_fifo_t*)arg;
+    uint8_t item[EOBENCH_FIFO_maxitemsize];
+    uint32_t n = 0;
+
+    for(n=0; n<b->itemsperthread; n++)
+    {
+        while(eores_OK != eo_fifo_GetRem(b->fifo, item, 0))
+        {
+            sched_yield();
+        }
+    }
+
+    return(NULL);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+
+#include "EoCommon.h"
+#include "EOvector.h"
+#include "EOlist.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the number of finds of a run
+#define EOBENCH_FIND_ops            200000
+
+#define EOBENCH_FIND_maxitemsize    72
+
+// the keys to be found are taken in turn from a table of this size, which must be a power of 2
+#define EOBENCH_FIND_keys           1024
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the items keep a uint32_t key at their start, as the rops of the EOtransmitter keep their id. a hit looks for a key
+// at a random position, a miss for a key which is not there and thus it visits all the items.
+typedef enum
+{
+    eobench_find_vector         = 0,
+    eobench_find_listpointer    = 1,
+    eobench_find_listindexed    = 2
+} eobench_find_kind_t;
+
+typedef struct
+{
+    void                *object;
+    eobench_find_kind_t kind;
+    uint32_t            next;                           // the next key of the table
+    uint32_t            keys[EOBENCH_FIND_keys];
+} eobench_find_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_find(void *arg, uint32_t ops);
+static eOresult_t s_eobench_find_matching(void *item, void *param);
+static uint32_t s_eobench_find_random(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint16_t s_eobench_find_itemsizes[] = { 4, 72 };
+
+static const uint16_t s_eobench_find_numbers[] = { 16, 64, 256 };
+
+static const char * const s_eobench_find_objects[] = { "EOvector", "EOlist", "EOlist" };
+
+static const char * const s_eobench_find_kinds[] = { "", ", \"list\": \"pointer\"", ", \"list\": \"indexed\"" };
+
+static eobench_find_t s_eobench_find_data;
+
+static uint32_t s_eobench_find_seed = 1;
+
+// it keeps the compiler from removing the finds
+static volatile uint32_t s_eobench_find_sink = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void eobench_find(void)
+{
+    eobench_find_t *f = &s_eobench_find_data;
+    eobench_percentiles_t pct;
+    uint8_t item[EOBENCH_FIND_maxitemsize];
+    char params[128];
+    uint8_t s = 0;
+    uint8_t n = 0;
+    uint8_t k = 0;
+    uint8_t hit = 0;
+    uint32_t i = 0;
+    uint16_t itemsize = 0;
+    uint16_t number = 0;
+    uint32_t ops = eobench_ops(EOBENCH_FIND_ops);
+    uint32_t samples = eobench_ops(EOBENCH_SAMPLES);
+    double ns = 0;
+
+    memset(item, 0, sizeof(item));
+
+    for(s=0; s<sizeof(s_eobench_find_itemsizes)/sizeof(s_eobench_find_itemsizes[0]); s++)
+    {
+        itemsize = s_eobench_find_itemsizes[s];
+
+        for(n=0; n<sizeof(s_eobench_find_numbers)/sizeof(s_eobench_find_numbers[0]); n++)
+        {
+            number = s_eobench_find_numbers[n];
+
+            for(k=eobench_find_vector; k<=eobench_find_listindexed; k++)
+            {
+                f->kind = (eobench_find_kind_t)k;
+                switch(f->kind)
+                {
+                    case eobench_find_vector:       f->object = eo_vector_New(itemsize, number, NULL, 0, NULL, NULL);       break;
+                    case eobench_find_listpointer:  f->object = eo_list_New(itemsize, number, NULL, 0, NULL, NULL);         break;
+                    default:                        f->object = eo_list_NewIndexed(itemsize, number, NULL, 0, NULL, NULL);  break;
+                }
+
+                // the keys are 1, 3, 5, ... so that the even ones are never found
+                for(i=0; i<number; i++)
+                {
+                    uint32_t key = 2*i + 1;
+                    memcpy(item, &key, sizeof(key));
+                    if(eobench_find_vector == f->kind)
+                    {
+                        eo_vector_PushBack((EOvector*)f->object, item);
+                    }
+                    else
+                    {
+                        eo_list_PushBack((EOlist*)f->object, item);
+                    }
+                }
+
+                for(hit=0; hit<2; hit++)
+                {
+                    s_eobench_find_seed = 1;
+                    for(i=0; i<EOBENCH_FIND_keys; i++)
+                    {
+                        f->keys[i] = 2*(s_eobench_find_random() % number) + ((1 == hit) ? (1) : (0));
+                    }
+                    f->next = 0;
+
+                    snprintf(params, sizeof(params), "\"itemsize\": %u, \"items\": %u%s", itemsize, number, s_eobench_find_kinds[k]);
+                    ns = eobench_measure(s_eobench_find, f, ops);
+                    eobench_percentiles(s_eobench_find, f, samples, &pct);
+                    eobench_report_percentiles("find", s_eobench_find_objects[k], params, (1 == hit) ? ("find/hit") : ("find/miss"), ns, &pct);
+                }
+
+                if(eobench_find_vector == f->kind)
+                {
+                    eo_vector_Delete((EOvector*)f->object);
+                }
+                else
+                {
+                    eo_list_Delete((EOlist*)f->object);
+                }
+            }
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_find(void *arg, uint32_t ops)
+{
+    eobench_find_t *f = (eobench_find_t*)arg;
+    eOsizecntnr_t position = 0;
+    uint32_t found = 0;
+    uint32_t key = 0;
+    uint32_t i = 0;
+
+    for(i=0; i<ops; i++)
+    {
+        key = f->keys[f->next];
+        f->next = (f->next + 1) & (EOBENCH_FIND_keys - 1);
+
+        if(eobench_find_vector == f->kind)
+        {
+            found += (eobool_true == eo_vector_Find((EOvector*)f->object, s_eobench_find_matching, &key, &position)) ? (1) : (0);
+        }
+        else
+        {
+            found += (NULL != eo_list_Find((EOlist*)f->object, s_eobench_find_matching, &key)) ? (1) : (0);
+        }
+    }
+
+    s_eobench_find_sink = found;
+}
+
+
+static eOresult_t s_eobench_find_matching(void *item, void *param)
+{
+    uint32_t key = 0;
+
+    memcpy(&key, item, sizeof(key));
+    return((key == *((uint32_t*)param)) ? (eores_OK) : (eores_NOK_generic));
+}
+
+
+static uint32_t s_eobench_find_random(void)
+{
+    // the same sequence for every object, so that they look for the same keys
+    s_eobench_find_seed = s_eobench_find_seed * 1103515245 + 12345;
+    return(s_eobench_find_seed >> 8);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+
+#include "EoCommon.h"
+#include "EOlist.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the number of items visited in a run
+#define EOBENCH_LIST_ops            2000000
+
+#define EOBENCH_LIST_items          512
+
+#define EOBENCH_LIST_maxitemsize    72
+
+// the erasures and insertions at random positions which fragment a list
+#define EOBENCH_LIST_churn          (4*EOBENCH_LIST_items)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the list is walked by eo_list_Execute(), as the EOtransmitter does with its regular rops: the pointer list of
+// eo_list_New() vs the indexed list of eo_list_NewIndexed(), both when just filled and after a churn of erasures and
+// insertions, and the indexed one also after eo_list_Compact().
+typedef enum
+{
+    eobench_list_pointer            = 0,
+    eobench_list_indexed            = 1,
+    eobench_list_indexedcompacted   = 2
+} eobench_list_kind_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_list_execute(void *arg, uint32_t ops);
+static void s_eobench_list_visit(void *item, void *param);
+static void s_eobench_list_churn(EOlist *list);
+static uint32_t s_eobench_list_random(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint16_t s_eobench_list_itemsizes[] = { 24, 72 };
+
+static const char * const s_eobench_list_kinds[] = { "pointer", "indexed", "indexed+compact" };
+
+static uint32_t s_eobench_list_seed = 1;
+
+// it keeps the compiler from removing the reads
+static volatile uint32_t s_eobench_list_sink = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void eobench_list(void)
+{
+    EOlist *list = NULL;
+    uint8_t item[EOBENCH_LIST_maxitemsize];
+    char params[96];
+    uint8_t s = 0;
+    uint8_t k = 0;
+    uint8_t fragmented = 0;
+    uint16_t i = 0;
+    uint16_t itemsize = 0;
+    uint32_t ops = eobench_ops(EOBENCH_LIST_ops);
+
+    memset(item, 0, sizeof(item));
+
+    for(s=0; s<sizeof(s_eobench_list_itemsizes)/sizeof(s_eobench_list_itemsizes[0]); s++)
+    {
+        itemsize = s_eobench_list_itemsizes[s];
+
+        for(fragmented=0; fragmented<2; fragmented++)
+        {
+            for(k=eobench_list_pointer; k<=eobench_list_indexedcompacted; k++)
+            {
+                if((0 == fragmented) && (eobench_list_indexedcompacted == k))
+                {   // a list just filled is already compact
+                    continue;
+                }
+
+                list = (eobench_list_pointer == k) ? (eo_list_New(itemsize, EOBENCH_LIST_items, NULL, 0, NULL, NULL))
+                                                   : (eo_list_NewIndexed(itemsize, EOBENCH_LIST_items, NULL, 0, NULL, NULL));
+
+                s_eobench_list_seed = 1;
+                for(i=0; i<EOBENCH_LIST_items; i++)
+                {
+                    memcpy(item, &i, sizeof(i));
+                    eo_list_PushBack(list, item);
+                }
+
+                if(1 == fragmented)
+                {
+                    s_eobench_list_churn(list);
+                }
+
+                if(eobench_list_indexedcompacted == k)
+                {
+                    eo_list_Compact(list);
+                }
+
+                snprintf(params, sizeof(params), "\"itemsize\": %u, \"items\": %u, \"list\": \"%s\", \"fragmented\": %s",
+                         itemsize, EOBENCH_LIST_items, s_eobench_list_kinds[k], (1 == fragmented) ? ("true") : ("false"));
+                eobench_report("list", "EOlist", params, "execute/item", eobench_measure(s_eobench_list_execute, list, ops));
+
+                eo_list_Delete(list);
+            }
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_list_execute(void *arg, uint32_t ops)
+{
+    EOlist *list = (EOlist*)arg;
+    uint32_t sum = 0;
+    uint32_t done = 0;
+
+    while(done < ops)
+    {
+        eo_list_Execute(list, s_eobench_list_visit, &sum);
+        done += EOBENCH_LIST_items;
+    }
+
+    s_eobench_list_sink = sum;
+}
+
+
+static void s_eobench_list_visit(void *item, void *param)
+{
+    uint32_t *sum = (uint32_t*)param;
+    *sum += *((uint8_t*)item);
+}
+
+
+static void s_eobench_list_churn(EOlist *list)
+{
+    uint8_t item[EOBENCH_LIST_maxitemsize];
+    EOlistIter *li = NULL;
+    uint32_t n = 0;
+    uint32_t pos = 0;
+
+    memset(item, 0, sizeof(item));
+
+    for(n=0; n<EOBENCH_LIST_churn; n++)
+    {
+        // it erases an item at a random position and it inserts a new one at another
+        pos = s_eobench_list_random() % EOBENCH_LIST_items;
+        for(li=eo_list_Begin(list); pos>0; pos--)
+        {
+            li = eo_list_Next(list, li);
+        }
+        eo_list_Erase(list, li);
+
+        memcpy(item, &n, sizeof(n));
+        pos = s_eobench_list_random() % (EOBENCH_LIST_items - 1);
+        for(li=eo_list_Begin(list); pos>0; pos--)
+        {
+            li = eo_list_Next(list, li);
+        }
+        eo_list_Insert(list, li, item);
+    }
+}
+
+
+static uint32_t s_eobench_list_random(void)
+{
+    // the same sequence for every list, so that they have the same order of the items
+    s_eobench_list_seed = s_eobench_list_seed * 1103515245 + 12345;
+    return(s_eobench_list_seed >> 8);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
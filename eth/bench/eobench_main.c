@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <time.h>
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOYtheSystem.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    const char      *name;
+    eOvoid_fp_void_t run;
+} eobench_group_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const eobench_group_t s_eobench_groups[] =
+{
+    { "containers",     eobench_containers },
+    { "fifo",           eobench_fifo },
+    { "list",           eobench_list },
+    { "find",           eobench_find },
+    { "timers",         eobench_timers },
+    { "clocks",         eobench_clocks }
+};
+
+// indexed by eOysystem_clock_t
+static const char * const s_eobench_clocks[] = { "timeget", "monotonic", "monotonicraw", "tsc", "nanotimeget" };
+
+static eObool_t s_eobench_quick = eobool_false;
+
+static eOysystem_clock_t s_eobench_clock = eoy_sys_clock_monotonic;
+
+static uint32_t s_eobench_numberofresults = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static double s_eobench_timeget(void);
+static int s_eobench_compare(const void *a, const void *b);
+static void s_eobench_print(const char *group, const char *object, const char *params, const char *op, double ns, const char *more);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern uint64_t eobench_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return((uint64_t)t.tv_sec * 1000000000 + (uint64_t)t.tv_nsec);
+}
+
+
+extern const char * eobench_clockname(void)
+{
+    return(s_eobench_clocks[s_eobench_clock]);
+}
+
+
+extern uint32_t eobench_ops(uint32_t ops)
+{
+    return((eobool_true == s_eobench_quick) ? ((ops + 9) / 10) : (ops));
+}
+
+
+extern double eobench_measure(eobench_fp_t run, void *arg, uint32_t ops)
+{
+    double best = 0;
+    double ns = 0;
+    uint64_t t0 = 0;
+    uint8_t i = 0;
+
+    // a first run to warm up the caches and the branch predictors
+    run(arg, ops);
+
+    for(i=0; i<EOBENCH_RUNS; i++)
+    {
+        t0 = eobench_now();
+        run(arg, ops);
+        ns = (double)(eobench_now() - t0) / (double)ops;
+        if((0 == i) || (ns < best))
+        {
+            best = ns;
+        }
+    }
+
+    return(best);
+}
+
+
+extern void eobench_percentiles(eobench_fp_t run, void *arg, uint32_t samples, eobench_percentiles_t *pct)
+{
+    uint64_t *ns = (uint64_t*) calloc(samples, sizeof(uint64_t));
+    uint64_t overhead = 0;
+    uint64_t t0 = 0;
+    uint64_t t1 = 0;
+    uint32_t i = 0;
+
+    // the cost of reading the clock is the smallest distance between two readings
+    for(i=0; i<1000; i++)
+    {
+        t0 = eobench_now();
+        t1 = eobench_now();
+        if((0 == i) || ((t1 - t0) < overhead))
+        {
+            overhead = t1 - t0;
+        }
+    }
+
+    run(arg, samples);
+
+    for(i=0; i<samples; i++)
+    {
+        t0 = eobench_now();
+        run(arg, 1);
+        t1 = eobench_now();
+        ns[i] = ((t1 - t0) > overhead) ? (t1 - t0 - overhead) : (0);
+    }
+
+    qsort(ns, samples, sizeof(uint64_t), s_eobench_compare);
+
+    pct->p50 = (double)ns[samples / 2];
+    pct->p99 = (double)ns[((uint64_t)samples * 99) / 100];
+    pct->max = (double)ns[samples - 1];
+
+    free(ns);
+}
+
+
+extern void eobench_report(const char *group, const char *object, const char *params, const char *op, double ns)
+{
+    s_eobench_print(group, object, params, op, ns, "");
+}
+
+
+extern void eobench_report_percentiles(const char *group, const char *object, const char *params, const char *op, double ns, const eobench_percentiles_t *pct)
+{
+    char more[96];
+
+    snprintf(more, sizeof(more), ", \"p50\": %.0f, \"p99\": %.0f, \"max\": %.0f", pct->p50, pct->p99, pct->max);
+    s_eobench_print(group, object, params, op, ns, more);
+}
+
+
+int main(int argc, char *argv[])
+{
+    eOysystem_cfg_t syscfg = { s_eobench_timeget, { NULL, NULL, NULL, NULL }, eoy_sys_clock_monotonic, eobench_now };
+    eOmempool_cfg_t mpoolcfg = { eo_mempool_alloc_dynamic, NULL };
+    eObool_t selected[sizeof(s_eobench_groups)/sizeof(s_eobench_groups[0])] = { eobool_false };
+    eObool_t any = eobool_false;
+    uint8_t g = 0;
+    int i = 0;
+
+    for(i=1; i<argc; i++)
+    {
+        if(0 == strcmp(argv[i], "--quick"))
+        {
+            s_eobench_quick = eobool_true;
+        }
+        else if((0 == strcmp(argv[i], "--mempool")) && ((i+1) < argc))
+        {
+            i++;
+            mpoolcfg.mode = (0 == strcmp(argv[i], "slab")) ? (eo_mempool_alloc_slab) : (eo_mempool_alloc_dynamic);
+        }
+        else if((0 == strcmp(argv[i], "--clock")) && ((i+1) < argc))
+        {
+            i++;
+            for(g=0; g<sizeof(s_eobench_clocks)/sizeof(s_eobench_clocks[0]); g++)
+            {
+                if(0 == strcmp(argv[i], s_eobench_clocks[g]))
+                {
+                    s_eobench_clock = (eOysystem_clock_t)g;
+                    break;
+                }
+            }
+            if(g == sizeof(s_eobench_clocks)/sizeof(s_eobench_clocks[0]))
+            {
+                fprintf(stderr, "%s: unknown clock %s\n", argv[0], argv[i]);
+                return(1);
+            }
+        }
+        else
+        {
+            for(g=0; g<sizeof(s_eobench_groups)/sizeof(s_eobench_groups[0]); g++)
+            {
+                if(0 == strcmp(argv[i], s_eobench_groups[g].name))
+                {
+                    break;
+                }
+            }
+            if(g < sizeof(s_eobench_groups)/sizeof(s_eobench_groups[0]))
+            {
+                selected[g] = eobool_true;
+                any = eobool_true;
+            }
+            else
+            {
+                fprintf(stderr, "usage: %s [--quick] [--mempool dynamic|slab] [--clock timeget|monotonic|monotonicraw|tsc|nanotimeget] [group ...]\n", argv[0]);
+                return(1);
+            }
+        }
+    }
+
+    syscfg.clock = s_eobench_clock;
+    eoy_sys_Initialise(&syscfg, &mpoolcfg, NULL);
+
+    printf("{ \"benchmark\": \"embobj\", \"mempool\": \"%s\", \"clock\": \"%s\", \"quick\": %s, \"results\": [",
+           (eo_mempool_alloc_slab == mpoolcfg.mode) ? ("slab") : ("dynamic"), eobench_clockname(), (eobool_true == s_eobench_quick) ? ("true") : ("false"));
+
+    for(g=0; g<sizeof(s_eobench_groups)/sizeof(s_eobench_groups[0]); g++)
+    {
+        if((eobool_false == any) || (eobool_true == selected[g]))
+        {
+            s_eobench_groups[g].run();
+        }
+    }
+
+    printf("\n] }\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// as the time of yarp: seconds in a double
+static double s_eobench_timeget(void)
+{
+    return((double)eobench_now() / 1e9);
+}
+
+
+static int s_eobench_compare(const void *a, const void *b)
+{
+    uint64_t x = *((const uint64_t*)a);
+    uint64_t y = *((const uint64_t*)b);
+    return((x < y) ? (-1) : ((x > y) ? (1) : (0)));
+}
+
+
+static void s_eobench_print(const char *group, const char *object, const char *params, const char *op, double ns, const char *more)
+{
+    printf("%s\n    { \"group\": \"%s\", \"object\": \"%s\", %s%s\"op\": \"%s\", \"ns\": %.2f%s }",
+           (0 == s_eobench_numberofresults) ? ("") : (","),
+           group, object, (NULL == params) ? ("") : (params), (NULL == params) ? ("") : (", "), op, ns, more);
+    fflush(stdout);
+    s_eobench_numberofresults++;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "stdlib.h"
+
+#include "EoCommon.h"
+#include "EOaction.h"
+#include "EOtimer.h"
+#include "EOYtheTimerManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "eobench.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define EOBENCH_TIMERS_ops          200000
+
+#define EOBENCH_TIMERS_maxarmed     10000
+
+// the armed timers expire with periods in [min, min + range) micro-seconds, so that a run of ticks sees some expiries
+#define EOBENCH_TIMERS_periodmin    10000
+
+#define EOBENCH_TIMERS_periodrange  1000000
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the EOYtheTimerManager is used without its tick thread, so that eoy_timerman_Tick() is called by the benchmark.
+// with 0, 1000 and 10000 periodic timers armed in the wheel it measures the start + stop of one more timer and a call
+// of eoy_timerman_Tick(), which also executes the callbacks of the timers expired in the meantime.
+typedef struct
+{
+    EOtimer             *timer;
+    EOaction            *action;
+    uint32_t            expired;
+} eobench_timers_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_timers_startstop(void *arg, uint32_t ops);
+static void s_eobench_timers_tick(void *arg, uint32_t ops);
+static void s_eobench_timers_onexpiry(void *p);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint32_t s_eobench_timers_armed[] = { 0, 1000, EOBENCH_TIMERS_maxarmed };
+
+static const eOytimerman_cfg_t s_eobench_timers_cfg =
+{
+    EO_INIT(.tickperiod)    1000,
+    EO_INIT(.tickthread)    eobool_false
+};
+
+static EOtimer * s_eobench_timers[EOBENCH_TIMERS_maxarmed] = { NULL };
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern void eobench_timers(void)
+{
+    eobench_timers_t b = { NULL, NULL, 0 };
+    char params[96];
+    uint32_t armed = 0;
+    uint32_t i = 0;
+    uint8_t k = 0;
+    uint32_t ops = eobench_ops(EOBENCH_TIMERS_ops);
+    double ns = 0;
+
+    if(NULL == eoy_timerman_GetHandle())
+    {
+        eoy_timerman_Initialise(&s_eobench_timers_cfg);
+    }
+
+    b.action = eo_action_New();
+    eo_action_SetCallback(b.action, s_eobench_timers_onexpiry, &b, NULL);
+    b.timer = eo_timer_New();
+
+    for(i=0; i<EOBENCH_TIMERS_maxarmed; i++)
+    {
+        s_eobench_timers[i] = eo_timer_New();
+    }
+
+    srand(1);
+
+    for(k=0; k<sizeof(s_eobench_timers_armed)/sizeof(s_eobench_timers_armed[0]); k++)
+    {
+        // the timers armed by the previous case stay armed
+        for(; armed<s_eobench_timers_armed[k]; armed++)
+        {
+            eo_timer_Start(s_eobench_timers[armed], eok_abstimeNOW, EOBENCH_TIMERS_periodmin + (rand() % EOBENCH_TIMERS_periodrange), eo_tmrmode_FOREVER, b.action);
+        }
+
+        snprintf(params, sizeof(params), "\"armed\": %u, \"running\": %u", armed, eoy_timerman_NumberOfRunningTimers(eoy_timerman_GetHandle()));
+
+        ns = eobench_measure(s_eobench_timers_startstop, &b, ops);
+        eobench_report("timers", "EOYtheTimerManager", params, "start+stop", ns);
+
+        // the expiries are those of all the runs of the measure
+        b.expired = 0;
+        ns = eobench_measure(s_eobench_timers_tick, &b, ops);
+        snprintf(params, sizeof(params), "\"armed\": %u, \"running\": %u, \"expired\": %u", armed, eoy_timerman_NumberOfRunningTimers(eoy_timerman_GetHandle()), b.expired);
+        eobench_report("timers", "EOYtheTimerManager", params, "tick", ns);
+    }
+
+    for(i=0; i<EOBENCH_TIMERS_maxarmed; i++)
+    {
+        eo_timer_Stop(s_eobench_timers[i]);
+        eo_timer_Delete(s_eobench_timers[i]);
+        s_eobench_timers[i] = NULL;
+    }
+
+    eo_timer_Delete(b.timer);
+    eo_action_Delete(b.action);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eobench_timers_startstop(void *arg, uint32_t ops)
+{
+    eobench_timers_t *b = (eobench_timers_t*)arg;
+    uint32_t i = 0;
+
+    for(i=0; i<ops; i++)
+    {
+        // a different countdown every time, so that the timer goes into different slots and levels
+        eo_timer_Start(b->timer, eok_abstimeNOW, EOBENCH_TIMERS_periodmin + (i & 0xffff) * 64, eo_tmrmode_ONESHOT, b->action);
+        eo_timer_Stop(b->timer);
+    }
+}
+
+
+static void s_eobench_timers_tick(void *arg, uint32_t ops)
+{
+    uint32_t i = 0;
+
+    (void)arg;
+
+    for(i=0; i<ops; i++)
+    {
+        eoy_timerman_Tick(eoy_timerman_GetHandle());
+    }
+}
+
+
+static void s_eobench_timers_onexpiry(void *p)
+{
+    eobench_timers_t *b = (eobench_timers_t*)p;
+    b->expired++;
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
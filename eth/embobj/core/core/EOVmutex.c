@@ -157,6 +157,30 @@ extern void eov_mutex_Delete(EOVmutexDerived *d)
 }
 
 
+extern eOresult_t eov_mutex_Stats_Get(EOVmutexDerived *d, eOmutex_stats_t *stats)
+{
+    EOVmutex *mutex;
+    eOres_fp_voidp_voidp_t fptr;
+
+    mutex = (EOVmutex*) eo_common_getbaseobject(d);
+
+    if((NULL == mutex) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    // get stats function. it is optional
+    fptr = (eOres_fp_voidp_voidp_t)mutex->vtable[VF03_stats];
+
+    if(NULL == fptr)
+    {
+        return(eores_NOK_unsupported);
+    }
+
+    return(fptr(d, stats));
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
@@ -176,6 +200,7 @@ extern EOVmutex* eov_mutex_hid_New(void)
     retptr->vtable[VF00_take]           = NULL;
     retptr->vtable[VF01_release]        = NULL;
     retptr->vtable[VF02_delete]         = NULL;
+    retptr->vtable[VF03_stats]          = NULL;
     // other stuff
 
 
@@ -211,6 +236,14 @@ extern eOresult_t eov_mutex_hid_SetVTABLE(EOVmutex *p, eOres_fp_voidp_uint32_t v
 }
 
 
+extern eOresult_t eov_mutex_hid_SetStatsVF(EOVmutex *p, eOres_fp_voidp_voidp_t v_stats)
+{
+    p->vtable[VF03_stats]           = (void*) v_stats;
+
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
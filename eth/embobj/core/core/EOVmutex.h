@@ -80,6 +80,20 @@ typedef EOVmutexDerived* (*eov_mutex_fn_mutexderived_new)(void);
     @brief      eov_mutexderived_fn_delete is used to represent a pointer to a function which deallocates a derived mutex.
  **/
 typedef void (*eov_mutex_fn_mutexderived_delete)(EOVmutexDerived* m);
+
+
+/** @typedef    typedef struct eOmutex_stats_t
+    @brief      eOmutex_stats_t contains the contention statistics of a mutex which supports them. The contended
+                acquisitions are those which found the mutex already taken by another task.
+ **/
+typedef struct
+{
+    uint32_t    acquisitions;       /**< the number of successful takes, the recursive ones excluded */
+    uint32_t    contended;          /**< the number of successful takes which had to spin or wait */
+    uint32_t    timeouts;           /**< the number of takes which failed upon timeout */
+    uint32_t    maxwaittime;        /**< the longest wait of a contended take, in nanoseconds */
+    uint64_t    waittime;           /**< the sum of the waits of the contended takes, in nanoseconds */
+} eOmutex_stats_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -120,6 +134,16 @@ extern eOpurevirtual eOresult_t eov_mutex_Release(EOVmutexDerived *d);
 extern eOpurevirtual void eov_mutex_Delete(EOVmutexDerived *d);
 
 
+/** @fn         extern eOresult_t eov_mutex_Stats_Get(EOVmutexDerived *d, eOmutex_stats_t *stats)
+    @brief      Gives the contention statistics of the mutex. The derived objects are not required to support them.
+    @param      d               Pointer to the mutex-derived object
+    @param      stats           The statistics
+    @return     eores_OK in case of success, eores_NOK_nullpointer if any argument is NULL, or eores_NOK_unsupported
+                if the derived object does not keep statistics.
+ **/
+extern eOresult_t eov_mutex_Stats_Get(EOVmutexDerived *d, eOmutex_stats_t *stats);
+
+
 
 /** @}            
     end of group eov_mutex  
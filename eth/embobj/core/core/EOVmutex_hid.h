@@ -45,7 +45,8 @@ extern "C" {
 #define VF00_take                   0
 #define VF01_release                1
 #define VF02_delete                 2
-#define VTABLESIZE_mutex            3
+#define VF03_stats                  3
+#define VTABLESIZE_mutex            4
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
@@ -96,6 +97,15 @@ extern void eov_mutex_hid_Delete(EOVmutex *p);
 extern eOresult_t eov_mutex_hid_SetVTABLE(EOVmutex *p, eOres_fp_voidp_uint32_t v_take, eOres_fp_voidp_t v_release, eOres_fp_voidp_t v_delete);
 
 
+/** @fn         extern eOresult_t eov_mutex_hid_SetStatsVF(EOVmutex *p, eOres_fp_voidp_voidp_t v_stats)
+    @brief      Specialise the optional virtual function which gives the statistics. It is NULL by default.
+    @param      p               The object
+    @param      v_stats         the virtual function. it receives the derived object and a eOmutex_stats_t*
+    @return     eores_OK.
+ **/
+extern eOresult_t eov_mutex_hid_SetStatsVF(EOVmutex *p, eOres_fp_voidp_voidp_t v_stats);
+
+
 #ifdef __cplusplus
 }       // closing brace for extern "C"
 #endif 
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOVrwlock.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface 
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOVrwlock_hid.h" 
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set() 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOVrwlock";
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern eOresult_t eov_rwlock_TakeShared(EOVrwlockDerived *d, eOreltime_t tout) 
+{   
+    EOVrwlock *rwlock;
+    eOres_fp_voidp_uint32_t fptr;
+
+    rwlock = (EOVrwlock*) eo_common_getbaseobject(d);
+    
+    if(NULL == rwlock) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+
+    // get take function
+    fptr = (eOres_fp_voidp_uint32_t)rwlock->vtable[VF00_takeshared]; 
+
+    // call funtion of derived object. it cant be NULL
+    return(fptr(d, tout));
+}
+
+
+extern eOresult_t eov_rwlock_TakeExclusive(EOVrwlockDerived *d, eOreltime_t tout) 
+{   
+    EOVrwlock *rwlock;
+    eOres_fp_voidp_uint32_t fptr;
+
+    rwlock = (EOVrwlock*) eo_common_getbaseobject(d);
+    
+    if(NULL == rwlock) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+
+    // get take function
+    fptr = (eOres_fp_voidp_uint32_t)rwlock->vtable[VF01_takeexclusive]; 
+
+    // call funtion of derived object. it cant be NULL
+    return(fptr(d, tout));
+}
+
+
+extern eOresult_t eov_rwlock_Release(EOVrwlockDerived *d) 
+{
+    EOVrwlock *rwlock;
+    eOres_fp_voidp_t fptr;
+    
+    rwlock = (EOVrwlock*) eo_common_getbaseobject(d);
+
+    if(NULL == rwlock) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+
+    // get release function
+    fptr = (eOres_fp_voidp_t)rwlock->vtable[VF02_release]; 
+
+    // call funtion of derived object. it cant be NULL
+    return(fptr(d));
+}
+
+
+extern void eov_rwlock_Delete(EOVrwlockDerived *d) 
+{
+    EOVrwlock *rwlock;
+    eOres_fp_voidp_t fptr;
+    
+    rwlock = (EOVrwlock*) eo_common_getbaseobject(d);
+
+    if(NULL == rwlock) 
+    {
+        return; 
+    }
+
+    // get delete function
+    fptr = (eOres_fp_voidp_t)rwlock->vtable[VF03_delete]; 
+
+    // call funtion of derived object. it cant be NULL
+    fptr(d);
+    return;    
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOVrwlock* eov_rwlock_hid_New(void) 
+{
+    EOVrwlock *retptr = NULL;    
+
+    // i get the memory for the object
+    retptr = (EOVrwlock*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOVrwlock), 1);
+
+    // now the obj has valid memory. i need to initialise it with user-defined data
+    
+    // vtable
+    retptr->vtable[VF00_takeshared]     = NULL;
+    retptr->vtable[VF01_takeexclusive]  = NULL;
+    retptr->vtable[VF02_release]        = NULL;
+    retptr->vtable[VF03_delete]         = NULL;
+    // other stuff
+
+
+    return(retptr);    
+}
+
+
+extern void eov_rwlock_hid_Delete(EOVrwlock *p) 
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+    memset(p, 0, sizeof(EOVrwlock));
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+    return;
+}
+
+
+extern eOresult_t eov_rwlock_hid_SetVTABLE(EOVrwlock *p, eOres_fp_voidp_uint32_t v_takeshared, eOres_fp_voidp_uint32_t v_takeexclusive, 
+                                           eOres_fp_voidp_t v_release, eOres_fp_voidp_t v_delete)
+{
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != v_takeshared), "eov_rwlock_hid_SetVTABLE(): NULL v_takeshared", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != v_takeexclusive), "eov_rwlock_hid_SetVTABLE(): NULL v_takeexclusive", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != v_release), "eov_rwlock_hid_SetVTABLE(): NULL v_release", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != v_delete), "eov_rwlock_hid_SetVTABLE(): NULL v_delete", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    p->vtable[VF00_takeshared]      = (void*) v_takeshared;
+    p->vtable[VF01_takeexclusive]   = (void*) v_takeexclusive;
+    p->vtable[VF02_release]         = (void*) v_release;
+    p->vtable[VF03_delete]          = (void*) v_delete;
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+// empty section
+
+
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOVRWLOCK_H_
+#define _EOVRWLOCK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOVrwlock.h
+    @brief      This header file implements public interface to a reader-writer lock object.
+    @date       10/19/2026
+**/
+
+/** @defgroup eov_rwlock Object EOVrwlock
+    The EOVrwlock is an abstract object used to derive a reader-writer lock for the multitask execution environments.
+    It can be taken in shared mode by many tasks at the same time or in exclusive mode by a single task. It is the 
+    EOVmutex of data which is read much more often than it is written.
+    The EOVrwlock exposes only pure virtual methods which have to be defined inside the derived object.
+    
+    A task which holds the lock in exclusive mode must be able to take it again, in shared or exclusive mode, as it
+    happens with the recursive mutexes used by the embobj. A task which holds the lock in shared mode must not ask
+    the exclusive mode.
+    
+    An advanced user who wants to derive an object from EOVrwlock shall include its hidden interfaces and provide
+    function pointers to fill the hidden vtable.  As a reference, see the implementation of EOYrwlock.
+    
+    @{        
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+  
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+ 
+
+/** @typedef    typedef struct EOVrwlock_hid EOVrwlock
+    @brief      EOVrwlock is an opaque struct. It is used to implement data abstraction for the reader-writer lock 
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions. 
+ **/  
+typedef struct EOVrwlock_hid EOVrwlock;
+
+
+/** @typedef    typedef void EOVrwlockDerived
+    @brief      EOVrwlockDerived is used to implement polymorphism in the objects derived from EOVrwlock
+ **/
+typedef void EOVrwlockDerived;
+
+
+/** @typedef    typedef EOVrwlockDerived* (*eov_rwlock_fn_rwlockderived_new)(void)
+    @brief      eov_rwlock_fn_rwlockderived_new is used to represent a pointer to a function which allocates a derived 
+                reader-writer lock.
+ **/
+typedef EOVrwlockDerived* (*eov_rwlock_fn_rwlockderived_new)(void);
+
+    
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+ 
+
+/** @fn         extern eOpurevirtual eOresult_t eov_rwlock_TakeShared(EOVrwlockDerived *d, eOreltime_t tout)
+    @brief      Waits until the lock is either taken in shared mode or the timeout has expired. Other tasks can
+                hold it in shared mode at the same time.
+    @param      d               Pointer to the rwlock-derived object
+    @param      tout            Timeout in micro-seconds. for no-wait or infinite wait use proper values.
+    @return     eores_OK in case of success. eores_NOK_timeout upon failure to take the lock, or 
+                or eores_NOK_nullpointer if the lock is NULL.
+    @warning    This function cannot be used with a EOVrwlock object but only with one object derived
+                from it.
+ **/
+extern eOpurevirtual eOresult_t eov_rwlock_TakeShared(EOVrwlockDerived *d, eOreltime_t tout);
+
+
+/** @fn         extern eOpurevirtual eOresult_t eov_rwlock_TakeExclusive(EOVrwlockDerived *d, eOreltime_t tout)
+    @brief      Waits until the lock is either taken in exclusive mode or the timeout has expired.
+    @param      d               Pointer to the rwlock-derived object
+    @param      tout            Timeout in micro-seconds. for no-wait or infinite wait use proper values.
+    @return     eores_OK in case of success. eores_NOK_timeout upon failure to take the lock, or 
+                or eores_NOK_nullpointer if the lock is NULL.
+    @warning    This function cannot be used with a EOVrwlock object but only with one object derived
+                from it.
+ **/
+extern eOpurevirtual eOresult_t eov_rwlock_TakeExclusive(EOVrwlockDerived *d, eOreltime_t tout);
+
+
+/** @fn         extern eOpurevirtual eOresult_t eov_rwlock_Release(EOVrwlockDerived *d)
+    @brief      Releases the lock taken with eov_rwlock_TakeShared() or with eov_rwlock_TakeExclusive(). 
+    @param      d               Pointer to the rwlock-derived object
+    @return     eores_OK in case of success. eores_NOK_generic upon failure to release the lock, or 
+                or eores_NOK_nullpointer if the lock is NULL.
+    @warning    This function cannot be used with a EOVrwlock object but only with one object derived
+                from it.
+ **/
+extern eOpurevirtual eOresult_t eov_rwlock_Release(EOVrwlockDerived *d);
+
+
+/** @fn         extern eOpurevirtual void eov_rwlock_Delete(EOVrwlockDerived *d)
+    @brief      Deletes the lock. 
+    @param      d               Pointer to the rwlock-derived object
+    @warning    This function cannot be used with a EOVrwlock object but only with one object derived
+                from it.
+ **/
+extern eOpurevirtual void eov_rwlock_Delete(EOVrwlockDerived *d);
+
+
+
+/** @}            
+    end of group eov_rwlock  
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
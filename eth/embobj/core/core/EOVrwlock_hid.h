@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOVRWLOCK_HID_H_
+#define _EOVRWLOCK_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOVrwlock_hid.h
+    @brief      This header file implements hidden interface to a reader-writer lock object.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+ 
+#include "EOVrwlock.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define VF00_takeshared             0
+#define VF01_takeexclusive          1
+#define VF02_release                2
+#define VF03_delete                 3
+#define VTABLESIZE_rwlock           4
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+
+/** @struct     EOVrwlock_hid
+    @brief      Hidden definition. Implements private data used only internally by the 
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/  
+ 
+struct EOVrwlock_hid 
+{
+    // - vtable: must be on top of the struct
+    void * vtable[VTABLESIZE_rwlock];
+
+    // - other stuff
+    // empty-section
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+
+ 
+/** @fn         extern EOVrwlock* eov_rwlock_hid_New(void)
+    @brief      Creates a new reader-writer lock object 
+    @return     Pointer to the required object.
+    @warning    The EOVrwlock cannot be used by itself, but inside a derived object.
+ **/
+extern EOVrwlock* eov_rwlock_hid_New(void);
+
+
+/** @fn         extern void eov_rwlock_hid_Delete(EOVrwlock *p)
+    @brief      deletes a reader-writer lock object 
+    @param      p               the object
+ **/
+extern void eov_rwlock_hid_Delete(EOVrwlock *p);
+
+
+/** @fn         extern eOresult_t eov_rwlock_hid_SetVTABLE(EOVrwlock *p, eOres_fp_voidp_uint32_t v_takeshared, eOres_fp_voidp_uint32_t v_takeexclusive, 
+                                                       eOres_fp_voidp_t v_release, eOres_fp_voidp_t v_delete)
+    @brief      Specialise the virtual functions of the abstract object
+    @param      p               The object
+    @param      v_takeshared    the first virtual function
+    @param      v_takeexclusive the second virtual function        
+    @param      v_release       the third virtual function  
+    @param      v_delete        the fourth virtual function  
+    @return     eores_OK.
+ **/
+extern eOresult_t eov_rwlock_hid_SetVTABLE(EOVrwlock *p, eOres_fp_voidp_uint32_t v_takeshared, eOres_fp_voidp_uint32_t v_takeexclusive, 
+                                           eOres_fp_voidp_t v_release, eOres_fp_voidp_t v_delete);
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+ 
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
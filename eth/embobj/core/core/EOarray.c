@@ -63,7 +63,11 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the EOarray and the EOarrayWide differ only for the size of the fields of the head, hence they share these ones
+static void s_eo_array_clear(uint8_t *data, uint16_t itemsize, uint16_t first, uint16_t last);
+static eOresult_t s_eo_array_pushbackn(uint8_t *data, uint16_t itemsize, uint16_t capacity, uint16_t *size, const void *items, uint16_t nitems);
+static eOresult_t s_eo_array_assignrange(uint8_t *data, uint16_t itemsize, uint16_t capacity, uint16_t *size, const void *items, uint16_t nitems);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -367,6 +371,256 @@ extern void eo_array_Assign(EOarray *p, uint8_t pos, const void *items, uint8_t
     
 }
 
+
+extern eOresult_t eo_array_PushBackN(EOarray *p, const void *items, uint8_t nitems)
+{
+    eOresult_t res = eores_NOK_generic;
+    uint16_t size = 0;
+    
+    if((NULL == p) || (NULL == items))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    size = p->head.size;
+    res = s_eo_array_pushbackn(p->data, p->head.itemsize, p->head.capacity, &size, items, nitems);
+    p->head.size = (uint8_t)size;
+    
+    return(res);
+}
+
+
+extern eOresult_t eo_array_AssignRange(EOarray *p, const void *items, uint8_t nitems)
+{
+    eOresult_t res = eores_NOK_generic;
+    uint16_t size = 0;
+    
+    if((NULL == p) || ((NULL == items) && (0 != nitems)))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    size = p->head.size;
+    res = s_eo_array_assignrange(p->data, p->head.itemsize, p->head.capacity, &size, items, nitems);
+    p->head.size = (uint8_t)size;
+    
+    return(res);
+}
+
+
+extern EOarrayWide* eo_arraywide_New(uint16_t capacity, uint16_t itemsize, void *memory)
+{
+    EOarrayWide *retptr = NULL;   
+
+    if(NULL != memory)
+    {   // i use external memory
+        retptr = (EOarrayWide*) memory;
+        retptr->head.internalmem = eobool_false;
+    }
+    else
+    {   // i get the memory for the object
+        retptr = (EOarrayWide*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOarraywide_head_t) + (uint32_t)capacity*itemsize, 1);
+        retptr->head.internalmem = eobool_true;
+    }
+
+    retptr->head.capacity       = capacity;
+    retptr->head.itemsize       = itemsize;
+    retptr->head.size           = 0;
+    retptr->head.filler         = 0;
+    
+    eo_arraywide_Reset(retptr);
+
+    return(retptr);
+}
+
+
+extern void eo_arraywide_Delete(EOarrayWide *p)
+{
+    if((NULL == p) || (eobool_false == p->head.internalmem))
+    {
+        return;
+    }
+    
+    memset(p, 0, sizeof(EOarrayWide));    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern eOresult_t eo_arraywide_Reset(EOarrayWide *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    p->head.size = 0;
+    memset(p->data, 0, (uint32_t)p->head.capacity*p->head.itemsize);
+
+    return(eores_OK);
+}
+
+
+extern void eo_arraywide_Resize(EOarrayWide *p, uint16_t size)
+{
+    if((NULL == p) || (size == p->head.size) || (size > p->head.capacity))
+    {
+        return;
+    }
+    
+    // clear the removed elements or the added ones  
+    if(size < p->head.size)
+    {
+        s_eo_array_clear(p->data, p->head.itemsize, size, p->head.size);
+    }
+    else
+    {
+        s_eo_array_clear(p->data, p->head.itemsize, p->head.size, size);
+    }
+    
+    p->head.size = size;
+}
+
+
+extern uint16_t eo_arraywide_Capacity(EOarrayWide *p)
+{
+    return((NULL == p) ? (0) : (p->head.capacity));
+}
+
+
+extern uint16_t eo_arraywide_ItemSize(EOarrayWide *p)
+{
+    return((NULL == p) ? (0) : (p->head.itemsize));
+}
+
+
+extern uint16_t eo_arraywide_Size(EOarrayWide *p)
+{
+    return((NULL == p) ? (0) : (p->head.size));
+}
+
+
+extern uint16_t eo_arraywide_Available(EOarrayWide *p)
+{
+    return((NULL == p) ? (0) : (p->head.capacity - p->head.size));
+}
+
+
+extern eObool_t eo_arraywide_Full(EOarrayWide *p)
+{
+    if(NULL == p) 
+    {   // invalid array
+        return(eobool_true);    
+    }
+    
+    return((p->head.size == p->head.capacity) ? (eobool_true) : (eobool_false));   
+}
+
+
+extern uint32_t eo_arraywide_UsedBytes(EOarrayWide *p)
+{
+    if((NULL == p) || (p->head.capacity < p->head.size))
+    {
+        return(0);
+    }
+    
+    return(sizeof(eOarraywide_head_t) + (uint32_t)p->head.size*p->head.itemsize);
+}
+
+
+extern eOresult_t eo_arraywide_PushBack(EOarrayWide *p, const void *item)
+{
+    return(eo_arraywide_PushBackN(p, item, 1));
+}
+
+
+extern void * eo_arraywide_At(EOarrayWide *p, uint16_t pos)
+{
+    if((NULL == p) || (pos >= p->head.size))
+    {
+        return(NULL);
+    }
+
+    return(&(p->data[(uint32_t)pos*p->head.itemsize]));
+}
+
+
+extern eOresult_t eo_arraywide_PopBack(EOarrayWide *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == p->head.size)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    p->head.size--;
+
+    return(eores_OK);
+}
+
+
+extern void eo_arraywide_Assign(EOarrayWide *p, uint16_t pos, const void *items, uint16_t nitems)
+{
+    if((NULL == p) || (NULL == items) || (0 == nitems)) 
+    {    
+        return;    
+    }
+    
+    if(((uint32_t)pos+nitems) > p->head.capacity) 
+    { 
+        // beyond the capacity of the array
+        return;
+    }
+    
+    if(((uint32_t)pos+nitems) > p->head.size)
+    {
+        eo_arraywide_Resize(p, pos+nitems); 
+    }
+    
+    memcpy(&p->data[(uint32_t)pos*p->head.itemsize], items, (uint32_t)nitems*p->head.itemsize);
+}
+
+
+extern eOresult_t eo_arraywide_PushBackN(EOarrayWide *p, const void *items, uint16_t nitems)
+{
+    if((NULL == p) || (NULL == items))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(s_eo_array_pushbackn(p->data, p->head.itemsize, p->head.capacity, &p->head.size, items, nitems));
+}
+
+
+extern eOresult_t eo_arraywide_AssignRange(EOarrayWide *p, const void *items, uint16_t nitems)
+{
+    if((NULL == p) || ((NULL == items) && (0 != nitems)))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(s_eo_array_assignrange(p->data, p->head.itemsize, p->head.capacity, &p->head.size, items, nitems));
+}
+
+
+extern eOresult_t eo_arraywide_Append(EOarrayWide *p, EOarray *array)
+{
+    if((NULL == p) || (NULL == array))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(p->head.itemsize != array->head.itemsize)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    return(s_eo_array_pushbackn(p->data, p->head.itemsize, p->head.capacity, &p->head.size, array->data, array->head.size));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -376,7 +630,48 @@ extern void eo_array_Assign(EOarray *p, uint8_t pos, const void *items, uint8_t
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static void s_eo_array_clear(uint8_t *data, uint16_t itemsize, uint16_t first, uint16_t last)
+{   // clears the items in [first, last)
+    if(last > first)
+    {
+        memset(&data[(uint32_t)first*itemsize], 0, (uint32_t)(last-first)*itemsize);
+    }
+}
+
+
+static eOresult_t s_eo_array_pushbackn(uint8_t *data, uint16_t itemsize, uint16_t capacity, uint16_t *size, const void *items, uint16_t nitems)
+{
+    if(((uint32_t)*size + nitems) > capacity)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(&data[(uint32_t)*size*itemsize], items, (uint32_t)nitems*itemsize);
+    *size += nitems;
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_array_assignrange(uint8_t *data, uint16_t itemsize, uint16_t capacity, uint16_t *size, const void *items, uint16_t nitems)
+{
+    if(nitems > capacity)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(0 != nitems)
+    {
+        memcpy(data, items, (uint32_t)nitems*itemsize);
+    }
+    
+    // the items which were in use beyond the new size are cleared as eo_array_Reset() would do
+    s_eo_array_clear(data, itemsize, nitems, *size);
+    *size = nitems;
+    
+    return(eores_OK);
+}
 
 
 
@@ -75,6 +75,31 @@ typedef struct
 //typedef struct EOarray_hid EOarray;
 
 typedef EOarray_of EOarray;
+
+
+/** @typedef    typedef struct eOarraywide_head_t
+    @brief      The head of an EOarrayWide. It is never used on the wire, hence it does not replace eOarray_head_t.
+ **/  
+typedef struct
+{
+    uint16_t        capacity;       /**< it is the maximum possible value of size in array */
+    uint16_t        itemsize;       /**< it is the size of a single item in bytes */
+    uint16_t        size;           /**< it keeps the number of items in the array */
+    eObool_t        internalmem;    /**< if eobool_true the object use internally allocated memory, else it uses externally allocated memory */  
+    uint8_t         filler;
+} eOarraywide_head_t;   EO_VERIFYsizeof(eOarraywide_head_t, 8)
+
+
+/** @typedef    typedef struct EOarrayWide
+    @brief      EOarrayWide is an EOarray with 16-bit capacity, size and itemsize, to be used for aggregates on the host
+                which can exceed the 255 items of an EOarray. Its functions are those of the EOarray with prefix
+                eo_arraywide_ and they use uint16_t instead of uint8_t.
+ **/  
+typedef struct
+{
+    eOarraywide_head_t      head;
+    uint8_t                 data[8];
+} EOarrayWide;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -210,6 +235,189 @@ extern eOresult_t eo_array_PopBack(EOarray *p);
 extern void eo_array_Assign(EOarray *p, uint8_t pos, const void *items, uint8_t nitems);
 
 
+/** @fn         extern eOresult_t eo_array_PushBackN(EOarray *p, const void *items, uint8_t nitems)
+    @brief      Adds @e nitems items at the back of the array with a single copy. The items must be consecutive as in an
+                array. It adds them all or none.
+    @param      p               The pointer to the array object.
+    @param      items           Pointer to the items.
+    @param      nitems          Number of the items.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e items are NULL, eores_NOK_generic if there is
+                no room for all the items.
+ **/
+extern eOresult_t eo_array_PushBackN(EOarray *p, const void *items, uint8_t nitems);
+
+
+/** @fn         extern eOresult_t eo_array_AssignRange(EOarray *p, const void *items, uint8_t nitems)
+    @brief      Replaces the content of the array with the @e nitems items pointed by @e items, so that the size 
+                becomes @e nitems. It is equivalent to eo_array_Reset() followed by a eo_array_PushBack() for each item, 
+                but it clears only the items beyond @e nitems which were in use before.
+    @param      p               The pointer to the array object.
+    @param      items           Pointer to the items. It can be NULL only if @e nitems is zero.
+    @param      nitems          Number of the items.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e items are NULL, eores_NOK_generic if 
+                @e nitems is higher than capacity. In such a case the array is not changed.
+ **/
+extern eOresult_t eo_array_AssignRange(EOarray *p, const void *items, uint8_t nitems);
+
+
+/** @fn         extern EOarrayWide* eo_arraywide_New(uint16_t capacity, uint16_t itemsize, void *memory)
+    @brief      Creates a new EOarrayWide object. If the argument @e memory is not NULL, then it is used for storage
+                inside the object. The function resets the data.
+    @param      capacity        The capacity of the array.
+    @param      itemsize        If not zero, then the array contains fixed-sized items, otherwise error. 
+    @param      memory          If not NULL the memory to use for the object. It is required a size equal to:
+                                8 + @e capacity * @e itemsize and it must be 32-bit aligned.
+    @return     The pointer to the required object.
+ **/
+extern EOarrayWide* eo_arraywide_New(uint16_t capacity, uint16_t itemsize, void *memory);
+
+
+/** @fn         extern void eo_arraywide_Delete(EOarrayWide *p)
+    @brief      deletes the object but only if the ram is internally allocated.
+    @param      p               The pointer to the wide array object.
+ **/
+extern void eo_arraywide_Delete(EOarrayWide *p);
+
+
+/** @fn         extern eOresult_t eo_arraywide_Reset(EOarrayWide *p)
+    @brief      Resets the array. It sets its size to zero and memset to zero all the data for capacity * itemsize bytes.
+    @param      p               The pointer to the wide array object.
+    @return     eores_OK upon success, eores_NOK_nullpointer if p is NULL
+ **/
+extern eOresult_t eo_arraywide_Reset(EOarrayWide *p);
+
+
+/** @fn         extern void eo_arraywide_Resize(EOarrayWide *p, uint16_t size)
+    @brief      Resizes the array. It does actions only if the new size can be contained in the array. It clears the 
+                removed or added elements.
+    @param      p               The pointer to the wide array object.
+    @param      size            The new size.
+ **/
+extern void eo_arraywide_Resize(EOarrayWide *p, uint16_t size);
+
+
+/** @fn         extern uint16_t eo_arraywide_Capacity(EOarrayWide *p)
+    @brief      tells the capacity of the array.
+    @param      p               The pointer to the wide array object.
+    @return     the capacity
+ **/
+extern uint16_t eo_arraywide_Capacity(EOarrayWide *p);
+
+
+/** @fn         extern uint16_t eo_arraywide_ItemSize(EOarrayWide *p)
+    @brief      tells the item size of the array.
+    @param      p               The pointer to the wide array object.
+    @return     the item size
+ **/
+extern uint16_t eo_arraywide_ItemSize(EOarrayWide *p);
+
+
+/** @fn         extern uint16_t eo_arraywide_Size(EOarrayWide *p)
+    @brief      tells the size of the array.
+    @param      p               The pointer to the wide array object.
+    @return     the size
+ **/
+extern uint16_t eo_arraywide_Size(EOarrayWide *p);
+
+
+/** @fn         extern uint16_t eo_arraywide_Available(EOarrayWide *p)
+    @brief      tells the how many items can be stored in the array. the number is equal to capacity - size
+    @param      p               The pointer to the wide array object.
+    @return     the available free items
+ **/
+extern uint16_t eo_arraywide_Available(EOarrayWide *p);
+
+
+/** @fn         extern eObool_t eo_arraywide_Full(EOarrayWide *p)
+    @brief      tells if the array is full
+    @param      p               The pointer to the wide array object.
+    @return     eobool_true or eobool_false
+ **/
+extern eObool_t eo_arraywide_Full(EOarrayWide *p);
+
+
+/** @fn         extern uint32_t eo_arraywide_UsedBytes(EOarrayWide *p)
+    @brief      tells how much of the memory pointer by p is used (header + size*itemsize). As eo_array_UsedBytes(), 
+                but the result can exceed 16 bits.
+    @param      p               The pointer to the wide array object.
+    @return     the used bytes including header
+ **/
+extern uint32_t eo_arraywide_UsedBytes(EOarrayWide *p);
+
+
+/** @fn         extern eOresult_t eo_arraywide_PushBack(EOarrayWide *p, const void *item)
+    @brief      Adds an item at the back of the array.
+    @param      p               The pointer to the wide array object.
+    @param      item            The item to be pushed back
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e item are NULL, eores_NOK_generic if @e item
+                cannot be pushed inside.
+ **/
+extern eOresult_t eo_arraywide_PushBack(EOarrayWide *p, const void *item);
+
+
+/** @fn         extern void * eo_arraywide_At(EOarrayWide *p, uint16_t pos)
+    @brief      Gets a pointer to the item in position @e pos inside the object 
+    @param      p               The pointer to the wide array object.
+    @param      pos             The position of the item
+    @return     The pointer, or NULL upon failure.
+ **/
+extern void * eo_arraywide_At(EOarrayWide *p, uint16_t pos);
+
+
+/** @fn         extern eOresult_t eo_arraywide_PopBack(EOarrayWide *p)
+    @brief      Removes the item at the back of the array.
+    @param      p               The pointer to the wide array object.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p is NULL, eores_NOK_generic if the array is empty.
+ **/
+extern eOresult_t eo_arraywide_PopBack(EOarrayWide *p);
+
+
+/** @fn         extern void eo_arraywide_Assign(EOarrayWide *p, uint16_t pos, const void *items, uint16_t nitems)
+    @brief      puts nitems pointed by items in positions starting from pos, as eo_array_Assign(). if final position 
+                pos+nitems is higher than current size and lower equal than capacity, then it resizes the array. if it 
+                is higher that capacity it does nothing.
+    @param      p               The pointer to the wide array object.
+    @param      pos             The position where to put the first item
+    @param      items           pointer to the items
+    @param      nitems          number of the items
+ **/
+extern void eo_arraywide_Assign(EOarrayWide *p, uint16_t pos, const void *items, uint16_t nitems);
+
+
+/** @fn         extern eOresult_t eo_arraywide_PushBackN(EOarrayWide *p, const void *items, uint16_t nitems)
+    @brief      Adds @e nitems items at the back of the array with a single copy, as eo_array_PushBackN(). It adds them 
+                all or none.
+    @param      p               The pointer to the wide array object.
+    @param      items           Pointer to the items.
+    @param      nitems          Number of the items.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e items are NULL, eores_NOK_generic if there is
+                no room for all the items.
+ **/
+extern eOresult_t eo_arraywide_PushBackN(EOarrayWide *p, const void *items, uint16_t nitems);
+
+
+/** @fn         extern eOresult_t eo_arraywide_AssignRange(EOarrayWide *p, const void *items, uint16_t nitems)
+    @brief      Replaces the content of the array with the @e nitems items pointed by @e items, as eo_array_AssignRange().
+    @param      p               The pointer to the wide array object.
+    @param      items           Pointer to the items. It can be NULL only if @e nitems is zero.
+    @param      nitems          Number of the items.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e items are NULL, eores_NOK_generic if 
+                @e nitems is higher than capacity. In such a case the array is not changed.
+ **/
+extern eOresult_t eo_arraywide_AssignRange(EOarrayWide *p, const void *items, uint16_t nitems);
+
+
+/** @fn         extern eOresult_t eo_arraywide_Append(EOarrayWide *p, EOarray *array)
+    @brief      Adds at the back of the EOarrayWide all the items of the EOarray @e array with a single copy. It is 
+                used to aggregate the arrays received from the boards.
+    @param      p               The pointer to the wide array object.
+    @param      array           The array whose items are added.
+    @return     eores_OK upon success, eores_NOK_nullpointer if @e p or @e array are NULL, eores_NOK_generic if the 
+                item sizes differ or if there is no room for all the items.
+ **/
+extern eOresult_t eo_arraywide_Append(EOarrayWide *p, EOarray *array);
+
+
 
 /** @}            
     end of group eo_array  
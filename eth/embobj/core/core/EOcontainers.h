@@ -0,0 +1,394 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOCONTAINERS_H_
+#define _EOCONTAINERS_H_
+
+#if !defined(__cplusplus)
+    #error EOcontainers.h is a c++ header
+#endif
+
+/** @file       EOcontainers.h
+    @brief      This header file implements c++ templates over the containers of embobj.
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_containers C++ templates over the embobj containers
+    The templates embot::core::Vector<T, N>, Array<T, N>, Ring<T, N> and Fifo<T, N> contain the struct of an EOvector,
+    EOarray, EOdeque and EOfifo plus the memory of N items of type T. Their functions are inline and use sizeof(T) at
+    compile time, but they keep the status inside the struct of the C object. Hence vector(), array(), deque() and fifo()
+    give a pointer which can be passed to any eo_vector_*(), eo_array_*(), eo_deque_*() and eo_fifo_*() function, also
+    in between calls of the inline functions.
+    The type T must be trivially copyable because the C functions copy the items with memcpy() as they do for an
+    object created without item_copy and item_clear. The removal of an item does not touch its memory, as in the C
+    functions. Apart from Array, the objects cannot be copied because the struct of the C object points to their memory.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOarray.h"
+#include "EOvector_hid.h"
+#include "EOdeque_hid.h"
+#include "EOfifo_hid.h"
+
+#include <cstring>
+#include <cstddef>
+#include <type_traits>
+#include <iterator>
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+namespace embot { namespace core {
+
+    // a Vector is an EOvector with fixed capacity N
+    template<typename T, eOsizecntnr_t N>
+    class Vector
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Vector<T, N>: T must be trivially copyable");
+        static_assert((N > 0) && (N < eo_vectorcapacity_dynamic), "Vector<T, N>: N must be in [1, eo_vectorcapacity_dynamic)");
+        static_assert(sizeof(T) <= 0xffff, "Vector<T, N>: T is too big");
+
+    public:
+
+        using value_type        = T;
+        using iterator          = T*;
+        using const_iterator    = const T*;
+
+        Vector()
+        {
+            vec.capacity        = N;
+            vec.size            = 0;
+            vec.item_size       = sizeof(T);
+            vec.dummy           = 0;
+            vec.stored_items    = items;
+            vec.functions       = nullptr;
+            vec.first           = 0;
+            vec.circular        = eobool_false;
+            vec.filler          = 0;
+            std::memset(items, 0, sizeof(items));
+        }
+
+        Vector(const Vector &) = delete;
+        Vector & operator=(const Vector &) = delete;
+
+        EOvector * vector() { return &vec; }
+
+        constexpr eOsizecntnr_t capacity() const { return N; }
+        eOsizecntnr_t size() const { return vec.size; }
+        bool empty() const { return 0 == vec.size; }
+        bool full() const { return N == vec.size; }
+
+        T & operator[](eOsizecntnr_t pos) { return items[pos]; }
+        const T & operator[](eOsizecntnr_t pos) const { return items[pos]; }
+        // as eo_vector_At(): nullptr if pos is not in [0, size())
+        T * at(eOsizecntnr_t pos) { return (pos < vec.size) ? (&items[pos]) : (nullptr); }
+        T & front() { return items[0]; }
+        T & back() { return items[vec.size-1]; }
+        T * data() { return items; }
+
+        bool push_back(const T &item) { if(full()) { return false; } items[vec.size++] = item; return true; }
+        bool pop_back() { if(empty()) { return false; } vec.size--; return true; }
+        void clear() { vec.size = 0; }
+
+        iterator begin() { return items; }
+        iterator end() { return items + vec.size; }
+        const_iterator begin() const { return items; }
+        const_iterator end() const { return items + vec.size; }
+
+    private:
+        // the items always start at stored_items because only eo_vector_NewCircular() gives a circular EOvector
+        EOvector    vec;
+        T           items[N];
+    };
+
+
+    // an Array is an EOarray with capacity N. it is the EOarray itself, hence it can be copied and placed inside the
+    // structs of the protocol where there is an EOarray_of_xxx.
+    template<typename T, uint8_t N>
+    class Array
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Array<T, N>: T must be trivially copyable");
+        static_assert(N > 0, "Array<T, N>: N cannot be 0");
+        static_assert(sizeof(T) <= 0xff, "Array<T, N>: T is too big");
+        static_assert(alignof(T) <= sizeof(eOarray_head_t), "Array<T, N>: T cannot follow the head of the EOarray");
+
+    public:
+
+        using value_type        = T;
+        using iterator          = T*;
+        using const_iterator    = const T*;
+
+        Array()
+        {
+            static_assert(std::is_standard_layout<Array>::value, "Array<T, N>: layout is not the one of EOarray");
+            head.capacity       = N;
+            head.itemsize       = sizeof(T);
+            head.size           = 0;
+            head.internalmem    = eobool_false;
+            std::memset(items, 0, sizeof(items));
+        }
+
+        EOarray * array() { return reinterpret_cast<EOarray*>(this); }
+
+        constexpr uint8_t capacity() const { return N; }
+        uint8_t size() const { return head.size; }
+        bool empty() const { return 0 == head.size; }
+        bool full() const { return N == head.size; }
+        // as eo_array_UsedBytes()
+        uint16_t usedbytes() const { return sizeof(eOarray_head_t) + head.size*sizeof(T); }
+
+        T & operator[](uint8_t pos) { return items[pos]; }
+        const T & operator[](uint8_t pos) const { return items[pos]; }
+        T * at(uint8_t pos) { return (pos < head.size) ? (&items[pos]) : (nullptr); }
+        T * data() { return items; }
+
+        bool push_back(const T &item) { if(full()) { return false; } items[head.size++] = item; return true; }
+        bool pop_back() { if(empty()) { return false; } head.size--; return true; }
+        void resize(uint8_t size) { head.size = (size > N) ? (N) : (size); }
+        void reset() { head.size = 0; std::memset(items, 0, sizeof(items)); }
+
+        iterator begin() { return items; }
+        iterator end() { return items + head.size; }
+        const_iterator begin() const { return items; }
+        const_iterator end() const { return items + head.size; }
+
+    private:
+        eOarray_head_t  head;
+        T               items[N];
+    };
+
+
+    // a Ring is an EOdeque whose capacity N is a power of two, so that the position of an item is a mask and a shift
+    // known at compile time.
+    template<typename T, eOsizecntnr_t N>
+    class Ring
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Ring<T, N>: T must be trivially copyable");
+        static_assert((N > 0) && (0 == (N & (N - 1))), "Ring<T, N>: N must be a power of two");
+        static_assert(sizeof(T) <= 0xffff, "Ring<T, N>: T is too big");
+
+        static constexpr eOsizecntnr_t mask = N - 1;
+
+        static constexpr uint8_t itemshift()
+        {   // as in eo_deque_New()
+            uint8_t s = 0;
+            if(0 != (sizeof(T) & (sizeof(T) - 1)))
+            {
+                return EOK_uint08dummy;
+            }
+            while((static_cast<size_t>(1) << s) != sizeof(T))
+            {
+                s++;
+            }
+            return s;
+        }
+
+        static constexpr eOsizeitem_t sizeofstoreditem()
+        {   // as in eo_deque_New()
+            return (sizeof(T) <= 2) ? (sizeof(T)) : ((sizeof(T) <= 4) ? (4) : (8*((sizeof(T)+7)/8)));
+        }
+
+        template<typename R, typename V>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = V*;
+            using reference         = V&;
+
+            Iterator(R *r, eOsizecntnr_t p) : ring(r), pos(p) {}
+            reference operator*() const { return (*ring)[pos]; }
+            pointer operator->() const { return &(*ring)[pos]; }
+            Iterator & operator++() { pos++; return *this; }
+            Iterator operator++(int) { Iterator tmp = *this; pos++; return tmp; }
+            bool operator==(const Iterator &o) const { return (ring == o.ring) && (pos == o.pos); }
+            bool operator!=(const Iterator &o) const { return !(*this == o); }
+
+        private:
+            R               *ring;
+            eOsizecntnr_t   pos;
+        };
+
+    public:
+
+        using value_type        = T;
+        using iterator          = Iterator<Ring, T>;
+        using const_iterator    = Iterator<const Ring, const T>;
+
+        Ring()
+        {
+            dek.size                = 0;
+            dek.first               = 0;
+            dek.next                = 0;
+            dek.item_size           = sizeof(T);
+            dek.capacity            = N;
+            dek.sizeofstoreditem    = sizeofstoreditem();
+            dek.stored_items        = items;
+            dek.item_init_fn        = nullptr;
+            dek.item_init_par       = 0;
+            dek.item_copy_fn        = nullptr;
+            dek.item_clear_fn       = nullptr;
+            dek.pow2                = eobool_true;
+            dek.itemshift           = itemshift();
+            dek.mask                = mask;
+            std::memset(items, 0, sizeof(items));
+        }
+
+        Ring(const Ring &) = delete;
+        Ring & operator=(const Ring &) = delete;
+
+        EOdeque * deque() { return &dek; }
+
+        constexpr eOsizecntnr_t capacity() const { return N; }
+        eOsizecntnr_t size() const { return dek.size; }
+        bool empty() const { return 0 == dek.size; }
+        bool full() const { return N == dek.size; }
+
+        // pos is from the front, as in eo_deque_At()
+        T & operator[](eOsizecntnr_t pos) { return items[(dek.first + pos) & mask]; }
+        const T & operator[](eOsizecntnr_t pos) const { return items[(dek.first + pos) & mask]; }
+        T * at(eOsizecntnr_t pos) { return (pos < dek.size) ? (&(*this)[pos]) : (nullptr); }
+        T & front() { return items[dek.first]; }
+        T & back() { return items[(dek.next - 1) & mask]; }
+
+        bool push_back(const T &item)
+        {
+            if(full()) { return false; }
+            items[dek.next] = item;
+            dek.next = (dek.next + 1) & mask;
+            dek.size++;
+            return true;
+        }
+
+        bool push_front(const T &item)
+        {
+            if(full()) { return false; }
+            dek.first = (dek.first - 1) & mask;
+            items[dek.first] = item;
+            dek.size++;
+            return true;
+        }
+
+        bool pop_front()
+        {
+            if(empty()) { return false; }
+            dek.first = (dek.first + 1) & mask;
+            dek.size--;
+            return true;
+        }
+
+        bool pop_back()
+        {
+            if(empty()) { return false; }
+            dek.next = (dek.next - 1) & mask;
+            dek.size--;
+            return true;
+        }
+
+        void clear() { dek.size = 0; dek.first = 0; dek.next = 0; }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, dek.size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, dek.size); }
+
+    private:
+        EOdeque     dek;
+        T           items[N];
+    };
+
+
+    // a Fifo is an EOfifo without mutex over a Ring<T, N>. for a fifo shared amongst threads use eo_fifo_New()
+    // with a mutex or eo_fifo_NewLockFree().
+    template<typename T, eOsizecntnr_t N>
+    class Fifo
+    {
+    public:
+
+        using value_type        = T;
+        using iterator          = typename Ring<T, N>::iterator;
+        using const_iterator    = typename Ring<T, N>::const_iterator;
+
+        Fifo()
+        {
+            fif.dek             = ring.deque();
+            fif.mutex           = nullptr;
+            fif.concurrency     = eo_fifo_concurrency_mutex;
+            fif.ring            = nullptr;
+        }
+
+        Fifo(const Fifo &) = delete;
+        Fifo & operator=(const Fifo &) = delete;
+
+        EOfifo * fifo() { return &fif; }
+
+        constexpr eOsizecntnr_t capacity() const { return N; }
+        eOsizecntnr_t size() const { return ring.size(); }
+        bool empty() const { return ring.empty(); }
+        bool full() const { return ring.full(); }
+
+        // as eo_fifo_Put(), eo_fifo_Get(), eo_fifo_Rem() and eo_fifo_GetRem() but they return false instead of an error
+        bool put(const T &item) { return ring.push_back(item); }
+        T * get() { return empty() ? (nullptr) : (&ring.front()); }
+        bool rem() { return ring.pop_front(); }
+        bool getrem(T &item) { if(empty()) { return false; } item = ring.front(); return ring.pop_front(); }
+        void clear() { ring.clear(); }
+
+        // from the oldest to the newest
+        iterator begin() { return ring.begin(); }
+        iterator end() { return ring.end(); }
+        const_iterator begin() const { return ring.begin(); }
+        const_iterator end() const { return ring.end(); }
+
+    private:
+        Ring<T, N>  ring;
+        EOfifo      fif;
+    };
+
+}} // namespace embot { namespace core {
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+// empty-section
+
+
+/** @}
+    end of group eo_containers
+ **/
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -75,9 +75,28 @@ EO_static_inline void s_eo_deque_default_clear(void *item, EOdeque* deque)
 #endif
 }
 
-EO_static_inline void s_eo_deque_default_copy(void* item, void* p, EOdeque* deque)
+EO_static_inline void s_eo_deque_default_copy(void* item, const void* p, EOdeque* deque)
 {
-    memcpy(item, p, deque->item_size);
+    // the memcpy() of a constant size becomes a few loads and stores
+    switch(deque->item_size)
+    {
+        case 1:     *((uint8_t*)item) = *((const uint8_t*)p);   break;
+        case 2:     memcpy(item, p, 2);                         break;
+        case 4:     memcpy(item, p, 4);                         break;
+        case 8:     memcpy(item, p, 8);                         break;
+        case 16:    memcpy(item, p, 16);                        break;
+        default:    memcpy(item, p, deque->item_size);          break;
+    }
+}
+
+EO_static_inline eOsizecntnr_t s_eo_deque_wrap(EOdeque* deque, uint32_t pos)
+{   // pos is always less than 2*capacity
+    return((eOsizecntnr_t)((eobool_true == deque->pow2) ? (pos & deque->mask) : ((pos < deque->capacity) ? (pos) : (pos - deque->capacity))));
+}
+
+EO_static_inline uint8_t * s_eo_deque_item(EOdeque* deque, eOsizecntnr_t pos)
+{   // cast to uint32_t to tell the reader that the offset can be bigger than max eOsizecntnr_t
+    return(&((uint8_t*)deque->stored_items)[(EOK_uint08dummy == deque->itemshift) ? ((uint32_t)pos * deque->item_size) : ((uint32_t)pos << deque->itemshift)]);
 }
 
 EO_static_inline void s_eo_deque_default_init(void* item,  EOdeque* deque)
@@ -135,6 +154,16 @@ extern EOdeque * eo_deque_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     retptr->item_init_par       = init_par;    
     retptr->item_copy_fn        = item_copy;
     retptr->item_clear_fn       = item_clear;
+    
+    // with a capacity which is a power of two the indices wrap with a mask, with an item_size which is a power of two
+    // the position of an item is a shift
+    retptr->pow2                = (0 == (capacity & (capacity - 1))) ? (eobool_true) : (eobool_false);
+    retptr->mask                = capacity - 1;
+    retptr->itemshift           = EOK_uint08dummy;
+    if(0 == (item_size & (item_size - 1)))
+    {
+        for(retptr->itemshift = 0; (1 << retptr->itemshift) != item_size; retptr->itemshift++);
+    }
 
     // now we get memory for copying objects inside
     if(1 == item_size)
@@ -240,7 +269,6 @@ extern eObool_t eo_deque_Empty(EOdeque * deque)
 extern void eo_deque_PushBack(EOdeque * deque, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
         
     if((NULL == deque) || (NULL == p)) 
@@ -253,9 +281,7 @@ extern void eo_deque_PushBack(EOdeque * deque, void *p)
         return;
     }
        
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)deque->next * deque->item_size]; 
+    item = s_eo_deque_item(deque, deque->next); 
     
     if(NULL != deque->item_copy_fn) 
     {
@@ -266,7 +292,7 @@ extern void eo_deque_PushBack(EOdeque * deque, void *p)
         s_eo_deque_default_copy(item, p, deque);
     }
     
-    deque->next = (deque->next + 1) % (deque->capacity);
+    deque->next = s_eo_deque_wrap(deque, (uint32_t)deque->next + 1);
     deque->size ++;
     
     return; 
@@ -276,7 +302,6 @@ extern void eo_deque_PushBack(EOdeque * deque, void *p)
 extern void eo_deque_PushFront(EOdeque * deque, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     // we use uint32_t because .... see note xxx.
     uint32_t pos = 0;
@@ -298,10 +323,8 @@ extern void eo_deque_PushFront(EOdeque * deque, void *p)
     // - we want that 265 is correctly represented before it is extracted the remainder of division by 255, 
     // - thus we must use a larger variable for pos .... uint32_t is large enough. 
     // SIMILARLY IF WE USE uint16_t for eOsizecntnr_t, but capacity = 65535 is ... hard to manage
-    pos = (uint32_t)(deque->capacity + deque->first - 1) % deque->capacity;  
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * deque->item_size];
+    pos = s_eo_deque_wrap(deque, (uint32_t)deque->capacity + deque->first - 1);  
+    item = s_eo_deque_item(deque, (eOsizecntnr_t)pos);
     
     if(NULL != deque->item_copy_fn) 
     {
@@ -323,7 +346,6 @@ extern void eo_deque_PushFront(EOdeque * deque, void *p)
 extern void * eo_deque_Front(EOdeque * deque) 
 {
     // here uint8_t is required to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == deque) 
@@ -336,9 +358,7 @@ extern void * eo_deque_Front(EOdeque * deque)
         return(NULL);     
     }
     
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)deque->first * deque->item_size];
+    item = s_eo_deque_item(deque, deque->first);
     
     return((void*) item);         
 }
@@ -347,7 +367,6 @@ extern void * eo_deque_Front(EOdeque * deque)
 extern void eo_deque_PopFront(EOdeque * deque) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == deque) 
@@ -360,9 +379,7 @@ extern void eo_deque_PopFront(EOdeque * deque)
         return;     
     }
 
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)deque->first * deque->item_size];
+    item = s_eo_deque_item(deque, deque->first);
 
     if(NULL != deque->item_clear_fn) 
     {
@@ -378,7 +395,7 @@ extern void eo_deque_PopFront(EOdeque * deque)
     // suppose uint8_t: even if capacity is 255, deque->first can reach at most 254. 
     // thus 254+1 = 255 can still be managed. 
     // SIMILARLY IF WE USE uint16_t for eOsizecntnr_t, but capacity = 65535 is ... hard to manage
-    deque->first = (deque->first + 1) % (deque->capacity);
+    deque->first = s_eo_deque_wrap(deque, (uint32_t)deque->first + 1);
     deque->size --;        
 }
 
@@ -386,7 +403,6 @@ extern void eo_deque_PopFront(EOdeque * deque)
 extern void * eo_deque_Back(EOdeque * deque) 
 {    
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     // we use uint32_t because .... see note xxx.
     uint32_t pos = 0;
@@ -398,14 +414,12 @@ extern void * eo_deque_Back(EOdeque * deque)
     
     if(0 == deque->size) 
     {   // deque is empty. return NULL
-        return(start);     
+        return(NULL);     
     }
     
     // cast to uint32_t ... see note xxx
-    pos = (uint32_t)(deque->next + deque->capacity - 1) % deque->capacity; 
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * deque->item_size];
+    pos = s_eo_deque_wrap(deque, (uint32_t)deque->next + deque->capacity - 1); 
+    item = s_eo_deque_item(deque, (eOsizecntnr_t)pos);
     
     return((void*) item);         
 }
@@ -414,7 +428,6 @@ extern void * eo_deque_Back(EOdeque * deque)
 extern void eo_deque_PopBack(EOdeque * deque) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     // we use uint32_t because .... see note xxx.
     uint32_t pos = 0;
@@ -430,11 +443,9 @@ extern void eo_deque_PopBack(EOdeque * deque)
     }
 
     // cast to uint32_t. see note xxx.
-    pos = (uint32_t)(deque->next + deque->capacity - 1) % deque->capacity; 
+    pos = s_eo_deque_wrap(deque, (uint32_t)deque->next + deque->capacity - 1); 
 
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * deque->item_size];            
+    item = s_eo_deque_item(deque, (eOsizecntnr_t)pos);            
     
     if(NULL != deque->item_clear_fn) 
     {
@@ -466,7 +477,6 @@ extern eOsizecntnr_t eo_deque_Size(EOdeque * deque)
 extern void eo_deque_Clear(EOdeque * deque) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     // we use uint32_t because .... see note xxx.
     uint32_t pos = 0;
@@ -484,12 +494,10 @@ extern void eo_deque_Clear(EOdeque * deque)
     }
     
 
-    start = (uint8_t*) (deque->stored_items);
     pos = deque->first;     // i clear only deque->size items, thus i must start from deque->first position. I CANNOT loop from 0 to capacity because we would destroy also not-existing objects
     for(i=0; i<deque->size; i++) 
     {
-        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-        item = &start[(uint32_t)pos * deque->item_size];
+        item = s_eo_deque_item(deque, (eOsizecntnr_t)pos);
         if(NULL != deque->item_clear_fn)
         {
             deque->item_clear_fn(item);
@@ -498,7 +506,7 @@ extern void eo_deque_Clear(EOdeque * deque)
         {
             s_eo_deque_default_clear(item, deque);
         }
-        pos = (pos + 1) % (deque->capacity);
+        pos = s_eo_deque_wrap(deque, pos + 1);
     }
         
     deque->size     = 0;
@@ -510,7 +518,6 @@ extern void eo_deque_Clear(EOdeque * deque)
 extern void * eo_deque_At(EOdeque * deque, eOsizecntnr_t pos) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == deque) 
@@ -520,19 +527,120 @@ extern void * eo_deque_At(EOdeque * deque, eOsizecntnr_t pos)
     
     if(pos >= deque->size) 
     {   // deque does not have any element in pos
-        return(start);     
+        return(NULL);     
     }
     
     // we use uint32_t because .... see note xxx.
-    pos = (uint32_t)(pos + deque->first) % (deque->capacity);
+    pos = s_eo_deque_wrap(deque, (uint32_t)pos + deque->first);
     
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * deque->item_size];
+    item = s_eo_deque_item(deque, pos);
     
     return((void*) item);         
 }
 
+extern eOsizecntnr_t eo_deque_PushBackN(EOdeque * deque, const void *items, eOsizecntnr_t number)
+{
+    const uint8_t *src = (const uint8_t*)items;
+    eOsizecntnr_t i = 0;
+    eOsizecntnr_t span = 0;
+    
+    if((NULL == deque) || (NULL == items)) 
+    {   // invalid data
+        return(0);    
+    }
+    
+    number = EO_MIN(number, deque->capacity - deque->size);
+    
+    if(NULL != deque->item_copy_fn)
+    {
+        for(i=0; i<number; i++)
+        {
+            deque->item_copy_fn(s_eo_deque_item(deque, deque->next), (void*)&src[(uint32_t)i * deque->item_size]);
+            deque->next = s_eo_deque_wrap(deque, (uint32_t)deque->next + 1);
+        }
+    }
+    else if(number > 0)
+    {   // at first until the end of the storage, then from its start
+        span = EO_MIN(number, deque->capacity - deque->next);
+        memcpy(s_eo_deque_item(deque, deque->next), src, (uint32_t)span * deque->item_size);
+        if(number > span)
+        {
+            memcpy(deque->stored_items, &src[(uint32_t)span * deque->item_size], (uint32_t)(number - span) * deque->item_size);
+        }
+        deque->next = s_eo_deque_wrap(deque, (uint32_t)deque->next + number);
+    }
+    
+    deque->size += number;
+    
+    return(number);
+}
+
+
+extern eOsizecntnr_t eo_deque_PopFrontN(EOdeque * deque, void *items, eOsizecntnr_t number)
+{
+    uint8_t *dst = (uint8_t*)items;
+    uint8_t *item = NULL;
+    eOsizecntnr_t i = 0;
+    eOsizecntnr_t span = 0;
+    
+    if(NULL == deque) 
+    {   // invalid data
+        return(0);    
+    }
+    
+    number = EO_MIN(number, deque->size);
+    
+    if((NULL != deque->item_copy_fn) || (NULL != deque->item_clear_fn))
+    {
+        for(i=0; i<number; i++)
+        {
+            item = s_eo_deque_item(deque, deque->first);
+            if(NULL != dst)
+            {
+                if(NULL != deque->item_copy_fn)
+                {
+                    deque->item_copy_fn(&dst[(uint32_t)i * deque->item_size], item);
+                }
+                else
+                {
+                    s_eo_deque_default_copy(&dst[(uint32_t)i * deque->item_size], item, deque);
+                }
+            }
+            if(NULL != deque->item_clear_fn)
+            {
+                deque->item_clear_fn(item);
+            }
+            else
+            {
+                s_eo_deque_default_clear(item, deque);
+            }
+            deque->first = s_eo_deque_wrap(deque, (uint32_t)deque->first + 1);
+        }
+    }
+    else if(number > 0)
+    {   // at first until the end of the storage, then from its start
+        span = EO_MIN(number, deque->capacity - deque->first);
+        if(NULL != dst)
+        {
+            memcpy(dst, s_eo_deque_item(deque, deque->first), (uint32_t)span * deque->item_size);
+            if(number > span)
+            {
+                memcpy(&dst[(uint32_t)span * deque->item_size], deque->stored_items, (uint32_t)(number - span) * deque->item_size);
+            }
+        }
+#if !defined(EODEQUE_DEFAULTCLEAR_DOES_NOTHING)
+        memset(s_eo_deque_item(deque, deque->first), 0, (uint32_t)span * deque->item_size);
+        memset(deque->stored_items, 0, (uint32_t)(number - span) * deque->item_size);
+#endif
+        deque->first = s_eo_deque_wrap(deque, (uint32_t)deque->first + number);
+    }
+    
+    deque->size -= number;
+    
+    return(number);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -540,7 +648,6 @@ extern void * eo_deque_At(EOdeque * deque, eOsizecntnr_t pos)
 extern void eo_deque_hid_QuickPopFront(EOdeque * deque) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
 
 // remove controls in order to speed-up things    
@@ -556,9 +663,7 @@ extern void eo_deque_hid_QuickPopFront(EOdeque * deque)
 //        return;     
 //    }
 
-    start = (uint8_t*) (deque->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)deque->first * deque->item_size];
+    item = s_eo_deque_item(deque, deque->first);
 
     if(NULL != deque->item_clear_fn) 
     {   // destroy
@@ -572,7 +677,7 @@ extern void eo_deque_hid_QuickPopFront(EOdeque * deque)
     // in here there is no need to cast to a bigger integer. 
     // suppose uint8_t: even if capacity is 255, deque->first can reach at most 254. 
     // thus 254+1 = 255 can still be managed. 
-    deque->first = (deque->first + 1) % (deque->capacity);
+    deque->first = s_eo_deque_wrap(deque, (uint32_t)deque->first + 1);
     deque->size --;          
 }
 
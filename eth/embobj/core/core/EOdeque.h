@@ -83,14 +83,16 @@ typedef struct EOdeque_hid EOdeque;
     @brief      Creates a new EOdeque object and reserves memory for the items that will be stored in its
                 inside, taking it from the memory pool.
     @param      item_size       The size in bytes of the item object managed by the EOdeque.
-    @param      capacity        The max number of item objects stored by the EOdeque.
+    @param      capacity        The max number of item objects stored by the EOdeque. If it is a power of two, the
+                                indices wrap with a mask rather than with a division.
     @param      item_init       Pointer to a specialised init function for the item object to be called at
                                 creation of the object for each contained item with arguments item_init(item, item_par). 
                                 If NULL, memory is just set to zero.
     @param      item_par        Argument used for @e item_init(item, item_par).                                
     @param      item_copy       Pointer to a specialised copy function for the item object to be called 
                                 at each copy of an item object inside the EOdeque with arguments item_copy(dest, orig).
-                                If NULL it will be executed a simple memcpy of the size of the item object.                                
+                                If NULL it will be executed a simple memcpy of the size of the item object, which
+                                is inlined for items of 1, 2, 4, 8 and 16 bytes.                                
     @param      item_clear      Pointer to a specialised remove function for the item object to be called at each 
                                 removal of an item object from the EOdeque. If NULL the memory inside the container
                                 will be simply set to zero.
@@ -219,6 +221,28 @@ extern void eo_deque_Clear(EOdeque * deque);
 extern void* eo_deque_At(EOdeque * deque, eOsizecntnr_t pos);
 
 
+/** @fn         extern eOsizecntnr_t eo_deque_PushBackN(EOdeque * deque, const void *items, eOsizecntnr_t number)
+    @brief      Copies at the back of the deque up to @e number items which are contiguous in @e items, in the same
+                order. If the item has no copy function, the copy is done with at most two memcpy().
+    @param      deque           Pointer to the EOdeque object.
+    @param      items           The items.
+    @param      number          Their number.
+    @return     The number of items copied, which is less than @e number if there is not enough room.
+ **/
+extern eOsizecntnr_t eo_deque_PushBackN(EOdeque * deque, const void *items, eOsizecntnr_t number);
+
+
+/** @fn         extern eOsizecntnr_t eo_deque_PopFrontN(EOdeque * deque, void *items, eOsizecntnr_t number)
+    @brief      Copies the up to @e number items in front of the deque into the contiguous memory @e items and removes
+                them from the deque. If the item has no copy and clear functions, it is done with at most two memcpy().
+    @param      deque           Pointer to the EOdeque object.
+    @param      items           Where to copy, or NULL to just remove the items.
+    @param      number          The max number of items.
+    @return     The number of items removed.
+ **/
+extern eOsizecntnr_t eo_deque_PopFrontN(EOdeque * deque, void *items, eOsizecntnr_t number);
+
+
 
 /** @}            
     end of group eo_deque  
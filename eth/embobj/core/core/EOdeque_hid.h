@@ -65,6 +65,9 @@ struct EOdeque_hid
     uint32_t                    item_init_par;         
     eOres_fp_voidp_voidp_t      item_copy_fn;       /**< specialised copy for a single item object. It is called upon copy into the deque*/    
     eOres_fp_voidp_t            item_clear_fn;      /**< specialised remove for a single item object. It is called upon removal from the deque*/
+    eObool_t                    pow2;               /**< eobool_true if capacity is a power of two, so that the indices wrap with mask */
+    uint8_t                     itemshift;          /**< log2 of item_size if it is a power of two, otherwise EOK_uint08dummy */
+    eOsizecntnr_t               mask;               /**< capacity-1 if pow2 */
 };
 
 
@@ -29,6 +29,18 @@
 #include "EOdeque_hid.h"
 #include "EOVmutex_hid.h"
 
+#if defined(EO_atomic_load_acquire)
+    #include <sched.h>
+    #include <time.h>
+    #include <limits.h>
+    #if defined(EO_TAILOR_CODE_FOR_LINUX)
+        #define EOFIFO_USE_FUTEX
+        #include <unistd.h>
+        #include <sys/syscall.h>
+        #include <linux/futex.h>
+    #endif
+#endif
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -48,7 +60,12 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the number of attempts of a lock-free operation before the thread goes to sleep
+#define EOK_FIFO_spins                  256
+
+// the max capacity of the lock-free modes, so that the rounded one fits an eOsizecntnr_t
+#define EOK_FIFO_lockfreemaxcapacity    32768
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -61,13 +78,27 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// a put or a get on the ring which never waits
+typedef eOresult_t (*eOfifo_ring_op_t)(eOfifo_ring_t *ring, void *item);
 
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring);
+static eOresult_t s_eo_fifo_ring_peek(eOfifo_ring_t *ring, const void **ppitem);
+static eOresult_t s_eo_fifo_ring_transfer(EOfifo *fifo, eObool_t put, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *done, eOreltime_t tout);
+
+#if defined(EO_atomic_load_acquire)
+static eOresult_t s_eo_fifo_ring_spsc_push(eOfifo_ring_t *ring, void *item);
+static eOresult_t s_eo_fifo_ring_spsc_pop(eOfifo_ring_t *ring, void *item);
+static eOresult_t s_eo_fifo_ring_mpmc_push(eOfifo_ring_t *ring, void *item);
+static eOresult_t s_eo_fifo_ring_mpmc_pop(eOfifo_ring_t *ring, void *item);
+static eOresult_t s_eo_fifo_ring_wait(eOfifo_ring_t *ring, eOfifo_ring_op_t op, void *item, eOreltime_t tout);
+static void s_eo_fifo_ring_notify(eOfifo_ring_t *ring);
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -100,11 +131,89 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 
     // now i copy the passed mutex into mutexfifo. beware for future use, ... it may be NULL
     retptr->mutex = mutex;
+    
+    retptr->concurrency = eo_fifo_concurrency_mutex;
+    retptr->ring = NULL;
  
     // ok, done
     return(retptr);
 }
 
+
+extern EOfifo * eo_fifo_NewLockFree(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                    eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                    eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                    eOfifo_concurrency_t concurrency)
+{
+#if defined(EO_atomic_load_acquire)
+    EOfifo *retptr = NULL;
+    eOfifo_ring_t *ring = NULL;
+    uint32_t size = 1;
+    uint32_t i = 0;
+    uint8_t *slot = NULL;
+    
+    if(eo_fifo_concurrency_mutex == concurrency)
+    {
+        return(eo_fifo_New(item_size, capacity, item_init, init_arg, item_copy, item_clear, NULL));
+    }
+    
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_fifo_NewLockFree(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity) && (capacity <= EOK_FIFO_lockfreemaxcapacity), "eo_fifo_NewLockFree(): wrong capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eo_fifo_concurrency_mpmc >= concurrency), "eo_fifo_NewLockFree(): wrong concurrency", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    retptr = (EOfifo*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOfifo), 1);
+    ring = (eOfifo_ring_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOfifo_ring_t), 1);
+    
+    while(size < capacity)
+    {
+        size <<= 1;
+    }
+    
+    // every slot keeps its item at a multiple of 8 bytes. in mpmc mode it is preceded by the sequence number
+    ring->itemoffset    = (eo_fifo_concurrency_mpmc == concurrency) ? (8) : (0);
+    ring->slotsize      = ring->itemoffset + ((item_size + 7) & ~7);
+    ring->mask          = size - 1;
+    ring->item_size     = item_size;
+    ring->item_copy_fn  = item_copy;
+    ring->item_clear_fn = item_clear;
+    ring->slots         = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, ring->slotsize, size);
+    
+    for(i=0; i<size; i++)
+    {
+        slot = &ring->slots[i * ring->slotsize];
+        if(eo_fifo_concurrency_mpmc == concurrency)
+        {
+            *((uint32_t*)slot) = i;
+        }
+        if(NULL != item_init)
+        {
+            item_init(&slot[ring->itemoffset], init_arg);
+        }
+    }
+    
+    ring->head = 0;
+    ring->tail = 0;
+    ring->events = 0;
+    ring->waiters = 0;
+    // the other threads will see the ring after the release implied by the way they get the EOfifo
+    EO_atomic_thread_fence_release();
+    
+    retptr->dek = NULL;
+    retptr->mutex = NULL;
+    retptr->concurrency = concurrency;
+    retptr->ring = ring;
+    
+    return(retptr);
+#else
+    if(eo_fifo_concurrency_mutex == concurrency)
+    {
+        return(eo_fifo_New(item_size, capacity, item_init, init_arg, item_copy, item_clear, NULL));
+    }
+    // without atomic operations there is no lock-free mode
+    return(NULL);
+#endif
+}
+
 extern void eo_fifo_Delete(EOfifo * fifo)
 {
     if(NULL == fifo) 
@@ -112,6 +221,16 @@ extern void eo_fifo_Delete(EOfifo * fifo)
         return;    
     }   
     
+    if(NULL != fifo->ring)
+    {
+        eo_fifo_Clear(fifo, eok_reltimeZERO);
+        eo_mempool_Delete(eo_mempool_GetHandle(), fifo->ring->slots);
+        eo_mempool_Delete(eo_mempool_GetHandle(), fifo->ring);
+        memset(fifo, 0, sizeof(EOfifo));    
+        eo_mempool_Delete(eo_mempool_GetHandle(), fifo);
+        return;
+    }
+    
     if(NULL == fifo->dek)
     {
         return;
@@ -122,7 +241,8 @@ extern void eo_fifo_Delete(EOfifo * fifo)
         eov_mutex_Take(fifo->mutex, eok_reltimeINFINITE);
     }
 
-    eo_fifo_Clear(fifo, eok_reltimeINFINITE);
+    // we already hold the mutex: eo_fifo_Clear() would take it again and block forever on a non-recursive one
+    eo_deque_Clear(fifo->dek);
     
     eo_mempool_Delete(eo_mempool_GetHandle(), fifo->dek);
     fifo->dek = NULL;
@@ -150,6 +270,12 @@ extern eOresult_t eo_fifo_Capacity(EOfifo *fifo, eOsizecntnr_t *capacity, eOrelt
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        *capacity = (eOsizecntnr_t)(fifo->ring->mask + 1);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -188,6 +314,12 @@ extern eOresult_t eo_fifo_Size(EOfifo *fifo, eOsizecntnr_t *size, eOreltime_t to
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        *size = s_eo_fifo_ring_size(fifo->ring);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -225,6 +357,11 @@ extern eOresult_t eo_fifo_Put(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        return(s_eo_fifo_ring_transfer(fifo, eobool_true, (uint8_t*)pitem, 1, NULL, tout));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -282,6 +419,11 @@ extern eOresult_t eo_fifo_Get(EOfifo *fifo, const void **ppitem, eOreltime_t tou
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        return((eo_fifo_concurrency_spsc == fifo->concurrency) ? (s_eo_fifo_ring_peek(fifo->ring, ppitem)) : (eores_NOK_unsupported));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -333,6 +475,12 @@ extern eOresult_t eo_fifo_Rem(EOfifo *fifo, eOreltime_t tout) {
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        s_eo_fifo_ring_transfer(fifo, eobool_false, NULL, 1, NULL, eok_reltimeZERO);
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -371,6 +519,11 @@ extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        return(s_eo_fifo_ring_transfer(fifo, eobool_false, (uint8_t*)pitem, 1, NULL, tout));
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -449,6 +602,12 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
         return(eores_NOK_nullpointer);
     }
     
+    if(NULL != fifo->ring)
+    {
+        while(eores_OK == s_eo_fifo_ring_transfer(fifo, eobool_false, NULL, 1, NULL, eok_reltimeZERO));
+        return(eores_OK);
+    }
+    
     if(NULL == fifo->mutex)    
     {
         // the fifo is not protected with a mutex, thus it is simple.
@@ -476,6 +635,78 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 }
 
 
+extern eOresult_t eo_fifo_PutN(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+{
+    eOsizecntnr_t n = 0;
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != fifo->ring)
+    {
+        return(s_eo_fifo_ring_transfer(fifo, eobool_true, (uint8_t*)items, number, put, tout));
+    }
+    
+    if((NULL != fifo->mutex) && (eores_OK != eov_mutex_Take(fifo->mutex, tout)))
+    {
+        // unfortunately we did not get the mutex for timeout
+        return(eores_NOK_timeout);
+    }
+    
+    n = eo_deque_PushBackN(fifo->dek, items, number);
+    
+    if(NULL != fifo->mutex)
+    {
+        eov_mutex_Release(fifo->mutex);
+    }
+    
+    if(NULL != put)
+    {
+        *put = n;
+    }
+    
+    return((n == number) ? (eores_OK) : (eores_NOK_busy));
+}
+
+
+extern eOresult_t eo_fifo_GetRemN(EOfifo *fifo, void *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+{
+    eOsizecntnr_t n = 0;
+    
+    if((NULL == fifo) || (NULL == items)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != fifo->ring)
+    {
+        return(s_eo_fifo_ring_transfer(fifo, eobool_false, (uint8_t*)items, number, got, tout));
+    }
+    
+    if((NULL != fifo->mutex) && (eores_OK != eov_mutex_Take(fifo->mutex, tout)))
+    {
+        // unfortunately we did not get the mutex for timeout
+        return(eores_NOK_timeout);
+    }
+    
+    n = eo_deque_PopFrontN(fifo->dek, items, number);
+    
+    if(NULL != fifo->mutex)
+    {
+        eov_mutex_Release(fifo->mutex);
+    }
+    
+    if(NULL != got)
+    {
+        *got = n;
+    }
+    
+    return((n > 0) ? (eores_OK) : (eores_NOK_nodata));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -485,7 +716,361 @@ extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout)
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if defined(EO_atomic_load_acquire)
+
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring)
+{
+    // read head at first, so that tail cannot be behind it. in mpmc mode the size is only a snapshot
+    uint32_t head = EO_atomic_load_acquire(&ring->head);
+    uint32_t tail = EO_atomic_load_acquire(&ring->tail);
+    uint32_t size = tail - head;
+    
+    return((eOsizecntnr_t)EO_MIN(size, ring->mask + 1));
+}
+
+
+static eOresult_t s_eo_fifo_ring_peek(eOfifo_ring_t *ring, const void **ppitem)
+{
+    // only the consumer calls it, hence the head does not change meanwhile
+    uint32_t head = EO_atomic_load_relaxed(&ring->head);
+    uint32_t tail = EO_atomic_load_acquire(&ring->tail);
+    
+    if(tail == head)
+    {
+        *ppitem = NULL;
+        return(eores_NOK_nodata);
+    }
+    
+    *ppitem = &ring->slots[(head & ring->mask) * ring->slotsize];
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_fifo_ring_transfer(EOfifo *fifo, eObool_t put, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *done, eOreltime_t tout)
+{
+    eOfifo_ring_t *ring = fifo->ring;
+    eOfifo_ring_op_t op = NULL;
+    eOresult_t res = eores_NOK_generic;
+    eOsizecntnr_t n = 0;
+    
+    if(eo_fifo_concurrency_spsc == fifo->concurrency)
+    {
+        op = (eobool_true == put) ? (s_eo_fifo_ring_spsc_push) : (s_eo_fifo_ring_spsc_pop);
+    }
+    else
+    {
+        op = (eobool_true == put) ? (s_eo_fifo_ring_mpmc_push) : (s_eo_fifo_ring_mpmc_pop);
+    }
+    
+    if(0 == number)
+    {
+        res = eores_OK;
+    }
+    else
+    {
+        // only the first item may wait. then we move as many items as possible
+        res = op(ring, items);
+        if((eores_OK != res) && (eok_reltimeZERO != tout))
+        {
+            res = s_eo_fifo_ring_wait(ring, op, items, tout);
+        }
+        
+        if(eores_OK == res)
+        {
+            for(n=1; n<number; n++)
+            {
+                if(eores_OK != op(ring, (NULL == items) ? (NULL) : (&items[(uint32_t)n * ring->item_size])))
+                {
+                    break;
+                }
+            }
+            s_eo_fifo_ring_notify(ring);
+            
+            if((n < number) && (eobool_true == put))
+            {
+                res = eores_NOK_busy;
+            }
+        }
+    }
+    
+    if(NULL != done)
+    {
+        *done = n;
+    }
+    
+    return(res);
+}
+
+
+static eOresult_t s_eo_fifo_ring_spsc_push(eOfifo_ring_t *ring, void *item)
+{
+    uint32_t tail = EO_atomic_load_relaxed(&ring->tail);
+    uint32_t head = EO_atomic_load_acquire(&ring->head);
+    uint8_t *slot = NULL;
+    
+    if((tail - head) > ring->mask)
+    {
+        return(eores_NOK_busy);
+    }
+    
+    slot = &ring->slots[(tail & ring->mask) * ring->slotsize];
+    if(NULL != ring->item_copy_fn)
+    {
+        ring->item_copy_fn(slot, item);
+    }
+    else
+    {
+        memcpy(slot, item, ring->item_size);
+    }
+    
+    // the item is visible to the consumer only after it is written 
+    EO_atomic_store_release(&ring->tail, tail + 1);
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_fifo_ring_spsc_pop(eOfifo_ring_t *ring, void *item)
+{
+    uint32_t head = EO_atomic_load_relaxed(&ring->head);
+    uint32_t tail = EO_atomic_load_acquire(&ring->tail);
+    uint8_t *slot = NULL;
+    
+    if(tail == head)
+    {
+        return(eores_NOK_nodata);
+    }
+    
+    slot = &ring->slots[(head & ring->mask) * ring->slotsize];
+    if(NULL != item)
+    {
+        if(NULL != ring->item_copy_fn)
+        {
+            ring->item_copy_fn(item, slot);
+        }
+        else
+        {
+            memcpy(item, slot, ring->item_size);
+        }
+    }
+    if(NULL != ring->item_clear_fn)
+    {
+        ring->item_clear_fn(slot);
+    }
+    
+    // the slot goes back to the producer only after it has been read
+    EO_atomic_store_release(&ring->head, head + 1);
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_fifo_ring_mpmc_push(eOfifo_ring_t *ring, void *item)
+{
+    uint32_t pos = EO_atomic_load_relaxed(&ring->tail);
+    uint8_t *slot = NULL;
+    uint32_t seq = 0;
+    int32_t diff = 0;
+    
+    for(;;)
+    {
+        slot = &ring->slots[(pos & ring->mask) * ring->slotsize];
+        seq = EO_atomic_load_acquire((uint32_t*)slot);
+        diff = (int32_t)(seq - pos);
+        if(0 == diff)
+        {   // the slot is free: we own it if no other producer took the position meanwhile
+            if(EO_atomic_compare_exchange_relaxed(&ring->tail, &pos, pos + 1))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {   // the slot still holds the item of the previous lap
+            return(eores_NOK_busy);
+        }
+        else
+        {   // another producer took the position
+            pos = EO_atomic_load_relaxed(&ring->tail);
+        }
+    }
+    
+    if(NULL != ring->item_copy_fn)
+    {
+        ring->item_copy_fn(&slot[ring->itemoffset], item);
+    }
+    else
+    {
+        memcpy(&slot[ring->itemoffset], item, ring->item_size);
+    }
+    
+    EO_atomic_store_release((uint32_t*)slot, pos + 1);
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_fifo_ring_mpmc_pop(eOfifo_ring_t *ring, void *item)
+{
+    uint32_t pos = EO_atomic_load_relaxed(&ring->head);
+    uint8_t *slot = NULL;
+    uint32_t seq = 0;
+    int32_t diff = 0;
+    
+    for(;;)
+    {
+        slot = &ring->slots[(pos & ring->mask) * ring->slotsize];
+        seq = EO_atomic_load_acquire((uint32_t*)slot);
+        diff = (int32_t)(seq - (pos + 1));
+        if(0 == diff)
+        {
+            if(EO_atomic_compare_exchange_relaxed(&ring->head, &pos, pos + 1))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {   // no producer has written the slot yet
+            return(eores_NOK_nodata);
+        }
+        else
+        {
+            pos = EO_atomic_load_relaxed(&ring->head);
+        }
+    }
+    
+    if(NULL != item)
+    {
+        if(NULL != ring->item_copy_fn)
+        {
+            ring->item_copy_fn(item, &slot[ring->itemoffset]);
+        }
+        else
+        {
+            memcpy(item, &slot[ring->itemoffset], ring->item_size);
+        }
+    }
+    if(NULL != ring->item_clear_fn)
+    {
+        ring->item_clear_fn(&slot[ring->itemoffset]);
+    }
+    
+    // the slot is free for the producer of the next lap
+    EO_atomic_store_release((uint32_t*)slot, pos + ring->mask + 1);
+    
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eo_fifo_ring_wait(eOfifo_ring_t *ring, eOfifo_ring_op_t op, void *item, eOreltime_t tout)
+{
+    eOresult_t res = eores_NOK_generic;
+    uint32_t i = 0;
+    uint32_t events = 0;
+    struct timespec now;
+    struct timespec deadline;
+    int64_t remaining = 0;
+    
+    // at first we spin, as the other side is usually fast
+    for(i=0; i<EOK_FIFO_spins; i++)
+    {
+    #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #endif
+        if(eores_OK == (res = op(ring, item)))
+        {
+            return(res);
+        }
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    if(eok_reltimeINFINITE != tout)
+    {
+        deadline.tv_sec  += tout / 1000000;
+        deadline.tv_nsec += (tout % 1000000) * 1000;
+        if(deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+    
+    for(;;)
+    {
+        // we declare ourselves as waiters before the last attempt, so that a thread which succeeds after it
+        // surely sees us and changes events. the seq_cst pairs with the fence in s_eo_fifo_ring_notify()
+        events = EO_atomic_load_acquire(&ring->events);
+        EO_atomic_fetch_add_seqcst(&ring->waiters, 1);
+        res = op(ring, item);
+        
+        if(eores_OK != res)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            remaining = (int64_t)(deadline.tv_sec - now.tv_sec) * 1000000000 + (deadline.tv_nsec - now.tv_nsec);
+            if((eok_reltimeINFINITE != tout) && (remaining <= 0))
+            {
+                res = eores_NOK_timeout;
+            }
+            else
+            {
+            #if defined(EOFIFO_USE_FUTEX)
+                struct timespec rel;
+                rel.tv_sec = remaining / 1000000000;
+                rel.tv_nsec = remaining % 1000000000;
+                // it returns at once if events has changed since we read it
+                syscall(SYS_futex, &ring->events, FUTEX_WAIT_PRIVATE, events, (eok_reltimeINFINITE == tout) ? (NULL) : (&rel), NULL, 0);
+            #else
+                if(events == EO_atomic_load_acquire(&ring->events))
+                {
+                    sched_yield();
+                }
+            #endif
+            }
+        }
+        
+        EO_atomic_fetch_sub_relaxed(&ring->waiters, 1);
+        
+        if(eores_NOK_busy != res && eores_NOK_nodata != res)
+        {
+            return(res);
+        }
+    }
+}
+
+
+static void s_eo_fifo_ring_notify(eOfifo_ring_t *ring)
+{
+    // cheap when nobody waits: a fence and a read
+    EO_atomic_thread_fence_seqcst();
+    if(0 != EO_atomic_load_relaxed(&ring->waiters))
+    {
+        EO_atomic_fetch_add_seqcst(&ring->events, 1);
+    #if defined(EOFIFO_USE_FUTEX)
+        syscall(SYS_futex, &ring->events, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    #endif
+    }
+}
+
+#else
+
+static eOsizecntnr_t s_eo_fifo_ring_size(eOfifo_ring_t *ring)
+{
+    return(0);
+}
+
+
+static eOresult_t s_eo_fifo_ring_peek(eOfifo_ring_t *ring, const void **ppitem)
+{
+    return(eores_NOK_unsupported);
+}
+
+
+static eOresult_t s_eo_fifo_ring_transfer(EOfifo *fifo, eObool_t put, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *done, eOreltime_t tout)
+{
+    return(eores_NOK_unsupported);
+}
+
+#endif
 
 
 
@@ -35,6 +35,10 @@ extern "C" {
     It contains an object EOdeque and an object derived from EOVmutex.
     It can be used alone with void * items or can be used inside another object to act such as
     a template in C++.  For example see EOfifoByte.
+    On hosts, an EOfifo created with eo_fifo_NewLockFree() has no mutex: it uses a ring of atomic positions for
+    a single producer and a single consumer (eo_fifo_concurrency_spsc) or a bounded queue for any number of 
+    them (eo_fifo_concurrency_mpmc). Its functions have the same items semantics, but the timeout is the time 
+    they wait for a free slot or for an item: at first they spin, then they sleep (on a futex in linux).
    
    @{        
  */
@@ -60,6 +64,17 @@ extern "C" {
 typedef struct EOfifo_hid EOfifo;
 
 
+/** @typedef    typedef enum eOfifo_concurrency_t
+    @brief      Tells how the EOfifo is protected from concurrent access.
+ **/ 
+typedef enum
+{
+    eo_fifo_concurrency_mutex   = 0,    /**< an EOdeque protected by the optional mutex given to eo_fifo_New() */
+    eo_fifo_concurrency_spsc    = 1,    /**< lock-free ring for one producer thread and one consumer thread */
+    eo_fifo_concurrency_mpmc    = 2     /**< lock-free bounded queue for many producer and consumer threads */
+} eOfifo_concurrency_t;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 // empty-section
@@ -99,6 +114,30 @@ extern EOfifo * eo_fifo_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 extern void eo_fifo_Delete(EOfifo * fifo);
 
 
+/** @fn         extern EOfifo * eo_fifo_NewLockFree(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                                    eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                                    eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                                    eOfifo_concurrency_t concurrency)
+    @brief      Creates a new EOfifo object as eo_fifo_New() does but without mutex. The capacity is rounded up to 
+                a power of two, so that eo_fifo_Capacity() may give a bigger value.
+                With eo_fifo_concurrency_spsc every function which puts items must be called by the same thread, 
+                and every function which gets or removes items must be called by another single thread.
+                With eo_fifo_concurrency_mpmc there is no such limit, but eo_fifo_Get() returns 
+                eores_NOK_unsupported because the item could be removed by another thread.
+                In both modes the timeout of eo_fifo_Put(), eo_fifo_GetRem(), eo_fifo_PutN() and eo_fifo_GetRemN()
+                is the time they wait for a free slot or for an item, and eores_NOK_timeout is returned when it 
+                expires. With zero timeout they return eores_NOK_busy or eores_NOK_nodata as the mutex mode does.
+                The other functions never wait.
+    @param      concurrency     eo_fifo_concurrency_spsc or eo_fifo_concurrency_mpmc. eo_fifo_concurrency_mutex
+                                gives the same object as eo_fifo_New() with NULL mutex.
+    @return     Pointer to the required EOfifo object or NULL if the system does not support atomic operations.
+ **/
+extern EOfifo * eo_fifo_NewLockFree(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                    eOres_fp_voidp_uint32_t item_init, uint32_t init_arg, 
+                                    eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear,
+                                    eOfifo_concurrency_t concurrency);
+
+
 /** @fn         extern eOresult_t eo_fifo_Capacity(EOfifo *fifo, eOsizecntnr_t *capacity, eOreltime_t tout)
     @brief      Returns the maximum number of items that the fifo queue can contain.
     @param      fifo            Pointer to the EOfifo object.
@@ -179,6 +218,34 @@ extern eOresult_t eo_fifo_GetRem(EOfifo *fifo, void *pitem, eOreltime_t tout);
 extern eOresult_t eo_fifo_Clear(EOfifo *fifo, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifo_PutN(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Copies inside the fifo as many as possible of the @e number items contiguous in @e items, with a single
+                lock of the mutex and at most two memcpy() if the items have no copy function.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           The items.
+    @param      number          Their number.
+    @param      put             If not NULL, it gets the number of items copied.
+    @param      tout            Timeout in micro-seconds for the mutex, if any.
+    @return     eores_OK if all the items were copied, eores_NOK_busy if the fifo could not contain all of them (and
+                some may have been copied), eores_NOK_timeout or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_fifo_PutN(EOfifo *fifo, const void *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifo_GetRemN(EOfifo *fifo, void *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Copies up to @e number items from the front of the fifo into @e items and removes them, with a single
+                lock of the mutex and at most two memcpy() if the items have no copy and clear functions.
+    @param      fifo            Pointer to the EOfifo object.
+    @param      items           Where to copy.
+    @param      number          The max number of items.
+    @param      got             If not NULL, it gets the number of items copied.
+    @param      tout            Timeout in micro-seconds for the mutex, if any.
+    @return     eores_OK if at least one item was copied, eores_NOK_nodata if the fifo was empty, eores_NOK_timeout or 
+                eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_fifo_GetRemN(EOfifo *fifo, void *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 
 /** @}            
     end of group eo_fifo  
@@ -196,6 +196,27 @@ extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout)
     return(eo_fifo_Clear(fifobyte->fifo, tout));
 }
 
+extern eOresult_t eo_fifobyte_PutN(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PutN(fifobyte->fifo, items, number, put, tout));
+}
+
+
+extern eOresult_t eo_fifobyte_GetRemN(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+{
+    if(NULL == fifobyte)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_GetRemN(fifobyte->fifo, items, number, got, tout));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
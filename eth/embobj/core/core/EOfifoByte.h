@@ -155,6 +155,18 @@ extern eOresult_t eo_fifobyte_Rem(EOfifoByte *fifobyte, eOreltime_t tout);
 extern eOresult_t eo_fifobyte_Clear(EOfifoByte *fifobyte, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifobyte_PutN(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Puts @e number items in the fifo with a single lock, as eo_fifo_PutN().
+ **/
+extern eOresult_t eo_fifobyte_PutN(EOfifoByte *fifobyte, const uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifobyte_GetRemN(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Gets and removes up to @e number items from the fifo with a single lock, as eo_fifo_GetRemN().
+ **/
+extern eOresult_t eo_fifobyte_GetRemN(EOfifoByte *fifobyte, uint8_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifobyte  
  **/
@@ -198,6 +198,27 @@ extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifoword, eOreltime_t tout)
 
 
 
+extern eOresult_t eo_fifoword_PutN(EOfifoWord *fifoword, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_PutN(fifoword->fifo, items, number, put, tout));
+}
+
+
+extern eOresult_t eo_fifoword_GetRemN(EOfifoWord *fifoword, uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+{
+    if(NULL == fifoword)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(eo_fifo_GetRemN(fifoword->fifo, items, number, got, tout));
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
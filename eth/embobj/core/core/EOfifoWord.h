@@ -154,6 +154,18 @@ extern eOresult_t eo_fifoword_Rem(EOfifoWord *fifo, eOreltime_t tout);
 extern eOresult_t eo_fifoword_Clear(EOfifoWord *fifo, eOreltime_t tout);
 
 
+/** @fn         extern eOresult_t eo_fifoword_PutN(EOfifoWord *fifo, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout)
+    @brief      Puts @e number items in the fifo with a single lock, as eo_fifo_PutN().
+ **/
+extern eOresult_t eo_fifoword_PutN(EOfifoWord *fifo, const uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *put, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eo_fifoword_GetRemN(EOfifoWord *fifo, uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout)
+    @brief      Gets and removes up to @e number items from the fifo with a single lock, as eo_fifo_GetRemN().
+ **/
+extern eOresult_t eo_fifoword_GetRemN(EOfifoWord *fifo, uint32_t *items, eOsizecntnr_t number, eOsizecntnr_t *got, eOreltime_t tout);
+
+
 /** @}            
     end of group eo_fifoword  
  **/
@@ -42,6 +42,31 @@ extern "C" {
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 
+/* @struct     eOfifo_ring_t
+    @brief      The ring of the lock-free modes. The positions are free-running counters, hence the index of a slot is 
+                the position masked by capacity - 1. The producers and the consumers write different cache lines. In
+                mode eo_fifo_concurrency_mpmc every slot starts with a sequence number, as in the bounded queue of 
+                D. Vyukov: the slot is free for the producer of position pos when it holds pos, and it holds the item 
+                of position pos for the consumers when it holds pos + 1.
+ **/ 
+typedef struct
+{
+    volatile uint32_t       tail;           // next position to be written
+    uint8_t                 filler0[60];
+    volatile uint32_t       head;           // next position to be read
+    uint8_t                 filler1[60];
+    volatile uint32_t       events;         // it changes after a put or a get if somebody waits for it
+    volatile uint32_t       waiters;
+    uint32_t                mask;
+    uint16_t                slotsize;
+    uint16_t                itemoffset;     // 0 in mode eo_fifo_concurrency_spsc, 8 in mode eo_fifo_concurrency_mpmc
+    uint8_t                 *slots;
+    eOsizeitem_t            item_size;
+    eOres_fp_voidp_voidp_t  item_copy_fn;
+    eOres_fp_voidp_t        item_clear_fn;
+} eOfifo_ring_t;
+
+
 /* @struct     EOfifo_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -54,6 +79,8 @@ struct EOfifo_hid
     EOdeque                 *dek;
     EOVmutexDerived         *mutex;
     // other stuff
+    eOfifo_concurrency_t    concurrency;
+    eOfifo_ring_t           *ring;          // only in the lock-free modes, where dek and mutex are NULL
 };
 
 #ifdef __cplusplus
@@ -87,9 +87,29 @@ EO_static_inline void s_eo_list_default_init(void* item,  EOlist* list)
 
 
 
+// in an indexed list an EOlistIter is the address of its node inside the array of nodes
+EO_static_inline EOlistIter* s_eo_list_node(EOlist *list, uint16_t index)
+{
+    return((EOlistIter*)&list->nodes[(uint32_t)index * list->nodesize]);
+}
+
+EO_static_inline uint16_t s_eo_list_node_index(EOlist *list, EOlistIter *li)
+{
+    return((uint16_t)((uint32_t)((uint8_t*)li - list->nodes) / list->nodesize));
+}
+
+EO_static_inline eOlist_nodelinks_t* s_eo_list_node_links(EOlistIter *li)
+{
+    return((eOlist_nodelinks_t*)li);
+}
+
 EO_static_inline void* s_eo_list_get_data(EOlist *list, EOlistIter *li)
 {
-    if(list->item_size > sizeof(void*))
+    if(NULL != list->nodes)
+    {
+        return(&((uint8_t*)li)[list->itemoffset]);
+    }
+    else if(list->item_size > sizeof(void*))
     {
         return(li->data);
     }
@@ -108,8 +128,14 @@ static EOlistIter * s_eo_list_rem_back(EOlistIter *tail);
 static void s_eo_list_rem_any(EOlist *list, EOlistIter *li);
 static EOlistIter * s_eo_list_front(EOlist *list);
 static EOlistIter * s_eo_list_back(EOlist *list);
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li);
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li);
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li);
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li);
+
+static void s_eo_list_indexed_link_front(EOlist *list, EOlistIter *li);
+static void s_eo_list_indexed_link_back(EOlist *list, EOlistIter *li);
+static void s_eo_list_indexed_link_before(EOlist *list, EOlistIter *iter, EOlistIter *li);
+static void s_eo_list_indexed_unlink(EOlist *list, EOlistIter *li);
+static void s_eo_list_indexed_swap(EOlist *list, uint16_t a, uint16_t b);
 
 static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p);
 static void s_eo_list_clean_iterator(EOlist *list, EOlistIter *li);
@@ -149,6 +175,10 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     retptr->head            = NULL;
     retptr->tail            = NULL;
     retptr->size            = 0;
+    retptr->nodes           = NULL;
+    retptr->nodesize        = 0;
+    retptr->itemoffset      = 0;
+    retptr->freenode        = EOK_uint16dummy;
  
     eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_list_New(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
     eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity), "eo_list_New(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
@@ -162,7 +192,7 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     
     if(eo_listcapacity_dynamic == retptr->capacity)
     {
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanRelease(eo_mempool_GetHandle())), "eo_list_New(): eo_vectorcapacity_dynamic only if eo_mempool_alloc_dynamic or _slab", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
         retptr->freeiters = NULL;        
     }
     else
@@ -179,6 +209,114 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 }
 
 
+extern EOlist* eo_list_NewIndexed(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                  eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                  eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+{
+    EOlist *retptr = NULL;
+    EOlistIter *li = NULL;
+    uint16_t i = 0;
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != item_size), "eo_list_NewIndexed(): 0 item_size", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != capacity) && (eo_listcapacity_dynamic != capacity), "eo_list_NewIndexed(): wrong capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    // i get the memory for the object
+    retptr = (EOlist*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOlist), 1);
+
+    retptr->head            = NULL;
+    retptr->tail            = NULL;
+    retptr->size            = 0;
+    retptr->capacity        = capacity;
+    retptr->item_size       = item_size;
+    retptr->item_init_fn    = item_init;
+    retptr->item_init_par   = init_par;    
+    retptr->item_copy_fn    = item_copy;
+    retptr->item_clear_fn   = item_clear;
+    retptr->freeiters       = NULL;
+    
+    // the nodes are in a single array: the links and then the item. items up to 4 bytes follow the links, the others
+    // start at 8 bytes so that they keep the alignment of the array. 
+    retptr->itemoffset      = (item_size <= 4) ? (4) : (8);
+    retptr->nodesize        = retptr->itemoffset + ((item_size + retptr->itemoffset - 1) & ~(retptr->itemoffset - 1));
+    retptr->nodes           = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, retptr->nodesize, capacity);
+    
+    // at start every node is free and they are linked in order
+    for(i=0; i<capacity; i++)
+    {
+        li = s_eo_list_node(retptr, i);
+        s_eo_list_node_links(li)->prev = EOK_uint16dummy;
+        s_eo_list_node_links(li)->next = (i == (capacity - 1)) ? (EOK_uint16dummy) : (i + 1);
+        
+        if(NULL != item_init)
+        {
+            item_init(s_eo_list_get_data(retptr, li), init_par);
+        }
+        else
+        {
+            s_eo_list_default_init(s_eo_list_get_data(retptr, li), retptr);
+        }
+    }
+    retptr->freenode        = 0;
+
+    return(retptr);
+}
+
+
+extern void eo_list_Compact(EOlist *list)
+{
+    EOlistIter *tmpiter = NULL;
+    eOlist_nodelinks_t *links = NULL;
+    uint16_t rank = 0;
+    uint16_t i = 0;
+    
+    if((NULL == list) || (NULL == list->nodes)) 
+    {
+        return;    
+    }
+    
+    // at first i write inside the prev of every node the position it must go to: the nodes of the list in their 
+    // order and then the free nodes. the prev are not needed anymore because at the end i rebuild all the links.
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
+    {
+        s_eo_list_node_links(tmpiter)->prev = rank++;
+    }
+    
+    for(i = list->freenode; EOK_uint16dummy != i; i = links->next)
+    {
+        links = s_eo_list_node_links(s_eo_list_node(list, i));
+        links->prev = rank++;
+    }
+    
+    // then i follow the cycles of the permutation: every swap moves a node into its final position
+    for(i=0; i<list->capacity; i++)
+    {
+        while(i != s_eo_list_node_links(s_eo_list_node(list, i))->prev)
+        {
+            s_eo_list_indexed_swap(list, i, s_eo_list_node_links(s_eo_list_node(list, i))->prev);
+        }
+    }
+    
+    // and finally the links
+    for(i=0; i<list->capacity; i++)
+    {
+        links = s_eo_list_node_links(s_eo_list_node(list, i));
+        if(i < list->size)
+        {
+            links->prev = (0 == i) ? (EOK_uint16dummy) : (i - 1);
+            links->next = (i == (list->size - 1)) ? (EOK_uint16dummy) : (i + 1);
+        }
+        else
+        {
+            links->prev = EOK_uint16dummy;
+            links->next = (i == (list->capacity - 1)) ? (EOK_uint16dummy) : (i + 1);
+        }
+    }
+    
+    list->head      = (0 == list->size) ? (NULL) : (s_eo_list_node(list, 0));
+    list->tail      = (0 == list->size) ? (NULL) : (s_eo_list_node(list, list->size - 1));
+    list->freenode  = (list->size == list->capacity) ? (EOK_uint16dummy) : (list->size);
+}
+
 
 extern eOsizecntnr_t eo_list_Size(EOlist *list) 
 {
@@ -246,14 +384,21 @@ extern void eo_list_PushFront(EOlist *list, void *p)
         // copy the passed obj inside the iter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the tail.
-        if(0 == list->size) 
+        if(NULL != list->nodes)
         {
-            list->tail = tmpiter;
+            s_eo_list_indexed_link_front(list, tmpiter);
         }
+        else
+        {
+            // if it is the first element in the list, set the tail.
+            if(0 == list->size) 
+            {
+                list->tail = tmpiter;
+            }
 
-        // insert the iter in front of the head
-        list->head = s_eo_list_push_front(list->head, tmpiter);
+            // insert the iter in front of the head
+            list->head = s_eo_list_push_front(list->head, tmpiter);
+        }
 
         // increment size of the list    
         list->size ++;
@@ -308,14 +453,21 @@ extern void eo_list_PushBack(EOlist *list, void *p)
         // copy the passed obj inside the iter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the head.
-        if(0 == list->size) 
+        if(NULL != list->nodes)
         {
-             list->head = tmpiter;
+            s_eo_list_indexed_link_back(list, tmpiter);
         }
+        else
+        {
+            // if it is the first element in the list, set the head.
+            if(0 == list->size) 
+            {
+                 list->head = tmpiter;
+            }
 
-        // insert the iter after the tail
-        list->tail = s_eo_list_push_back(list->tail, tmpiter);
+            // insert the iter after the tail
+            list->tail = s_eo_list_push_back(list->tail, tmpiter);
+        }
 
         // increment size of the list    
         list->size ++;
@@ -369,13 +521,20 @@ extern void eo_list_Insert(EOlist *list, EOlistIter *li, void *p)
         // copy the passed obj inside the iter tmpiter or store it directly if size is small
         s_eo_list_copy_item_into_iterator(list, tmpiter, p);
         
-        // if it is the first element in the list, set the tail.
-        if(0 == list->size) 
+        if(NULL != list->nodes)
+        {
+            s_eo_list_indexed_link_before(list, li, tmpiter);
+        }
+        else
         {
-             list->tail = tmpiter;
+            // if it is the first element in the list, set the tail.
+            if(0 == list->size) 
+            {
+                 list->tail = tmpiter;
+            }
+            // insert the element tmpiter in front of the iter li
+            list->head = s_eo_list_insert_before(list->head, li, tmpiter);
         }
-        // insert the element tmpiter in front of the iter li
-        list->head = s_eo_list_insert_before(list->head, li, tmpiter);
         // increment size of the list    
         list->size ++;
     }
@@ -413,7 +572,7 @@ extern EOlistIter* eo_list_Next(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_next(li));         
+    return(s_eo_list_iter_next(list, li));         
     
 }
 
@@ -427,7 +586,7 @@ extern EOlistIter* eo_list_Prev(EOlist *list, EOlistIter *li)
     {
         return(NULL);
     }
-    return(s_eo_list_iter_prev(li));         
+    return(s_eo_list_iter_prev(list, li));         
 }
 
 
@@ -443,7 +602,7 @@ extern EOlistIter* eo_list_FindItem(EOlist *list, void *p)
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         // data is a pointer to what is contained inside the list.
@@ -481,7 +640,7 @@ extern EOlistIter* eo_list_FindItem(EOlist *list, void *p)
 //    
 //    
 //    // i navigate from beginning to end until i find a NULL pointer or i break
-//    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+//    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
 //    {
 //        data = s_eo_list_get_data(list, tmpiter);
 //
@@ -519,7 +678,7 @@ extern EOlistIter* eo_list_Find(EOlist *list, eOresult_t (matching_rule)(void *i
     }
     
     // i navigate from beginning to end until i find a NULL pointer or i break
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
 
@@ -555,7 +714,7 @@ extern void eo_list_Execute(EOlist *list, void (execute)(void *item, void *param
     }
     
     // i navigate from beginning to end until i find a NULL pointer
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -576,7 +735,7 @@ extern void eo_list_ExecuteFromIter(EOlist *list, void (execute)(void *item, voi
     }
     
     // i navigate from li to end until i find a NULL pointer
-    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = li; NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         data = s_eo_list_get_data(list, tmpiter);
         execute(data, param);
@@ -596,7 +755,7 @@ extern eObool_t eo_list_IsIterInside(EOlist *list, EOlistIter *li)
     }
     
     // i navigate from beginning to end until we find li pointer or we return
-    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(tmpiter)) 
+    for(tmpiter = s_eo_list_front(list); NULL != tmpiter; tmpiter = s_eo_list_iter_next(list, tmpiter)) 
     {
         if(li == tmpiter) 
         {
@@ -623,7 +782,14 @@ extern void eo_list_PopFront(EOlist *list)
     if(NULL != tmpiter) 
     {
         // i remove it from front of the list
-        list->head = s_eo_list_rem_front(list->head);
+        if(NULL != list->nodes)
+        {
+            s_eo_list_indexed_unlink(list, tmpiter);
+        }
+        else
+        {
+            list->head = s_eo_list_rem_front(list->head);
+        }
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
@@ -658,7 +824,14 @@ extern void eo_list_PopBack(EOlist *list)
     if(NULL != tmpiter) 
     {
         // i remove it from end of the list
-        list->tail = s_eo_list_rem_back(list->tail);
+        if(NULL != list->nodes)
+        {
+            s_eo_list_indexed_unlink(list, tmpiter);
+        }
+        else
+        {
+            list->tail = s_eo_list_rem_back(list->tail);
+        }
 
         // release it
         s_eo_list_iterator_release(list, tmpiter);
@@ -701,7 +874,14 @@ extern void eo_list_Erase(EOlist *list, EOlistIter *li)
     {
         // i have a valid head and a valid list iter li, thus i can i remove it
         //list->head = s_eo_list_rem_iter(list->head, li);
-        s_eo_list_rem_any(list, li);
+        if(NULL != list->nodes)
+        {
+            s_eo_list_indexed_unlink(list, li);
+        }
+        else
+        {
+            s_eo_list_rem_any(list, li);
+        }
 
         // release it
         s_eo_list_iterator_release(list, li);
@@ -741,7 +921,7 @@ extern void eo_list_Delete(EOlist *list)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanRelease(eo_mempool_GetHandle())), "eo_list_Delete(): only if eo_mempool_alloc_dynamic or _slab", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // destroy every item. in case of eo_listcapacity_dynamic, each internal listiter is properly deleted and freeiters is NULL
     eo_list_Clear(list);
@@ -763,6 +943,11 @@ extern void eo_list_Delete(EOlist *list)
         }         
     }
     
+    if(NULL != list->nodes)
+    {   // the indexed list has all its nodes in a single array
+        eo_mempool_Delete(eo_mempool_GetHandle(), list->nodes);
+    }
+    
     // reset all things inside vector
     memset(list, 0, sizeof(EOlist));
     
@@ -993,28 +1178,143 @@ static EOlistIter * s_eo_list_back(EOlist *list)
 }
 
 
-static EOlistIter * s_eo_list_iter_next(EOlistIter *li) 
+static EOlistIter * s_eo_list_iter_next(EOlist *list, EOlistIter *li) 
 {
     if(NULL == li) 
     {
          return(NULL);
     }
+    
+    if(NULL != list->nodes)
+    {
+        return((EOK_uint16dummy == s_eo_list_node_links(li)->next) ? (NULL) : (s_eo_list_node(list, s_eo_list_node_links(li)->next)));
+    }
 
     return(li->next);
 }  
 
 
-static EOlistIter * s_eo_list_iter_prev(EOlistIter *li) 
+static EOlistIter * s_eo_list_iter_prev(EOlist *list, EOlistIter *li) 
 {
     if(NULL == li) 
     {
          return(NULL);
     }
+    
+    if(NULL != list->nodes)
+    {
+        return((EOK_uint16dummy == s_eo_list_node_links(li)->prev) ? (NULL) : (s_eo_list_node(list, s_eo_list_node_links(li)->prev)));
+    }
 
     return(li->prev);
 }  
 
 
+static void s_eo_list_indexed_link_front(EOlist *list, EOlistIter *li)
+{
+    uint16_t index = s_eo_list_node_index(list, li);
+    
+    s_eo_list_node_links(li)->prev = EOK_uint16dummy;
+    
+    if(NULL == list->head)
+    {
+        s_eo_list_node_links(li)->next = EOK_uint16dummy;
+        list->tail = li;
+    }
+    else
+    {
+        s_eo_list_node_links(li)->next = s_eo_list_node_index(list, list->head);
+        s_eo_list_node_links(list->head)->prev = index;
+    }
+    
+    list->head = li;
+}
+
+
+static void s_eo_list_indexed_link_back(EOlist *list, EOlistIter *li)
+{
+    uint16_t index = s_eo_list_node_index(list, li);
+    
+    s_eo_list_node_links(li)->next = EOK_uint16dummy;
+    
+    if(NULL == list->tail)
+    {
+        s_eo_list_node_links(li)->prev = EOK_uint16dummy;
+        list->head = li;
+    }
+    else
+    {
+        s_eo_list_node_links(li)->prev = s_eo_list_node_index(list, list->tail);
+        s_eo_list_node_links(list->tail)->next = index;
+    }
+    
+    list->tail = li;
+}
+
+
+static void s_eo_list_indexed_link_before(EOlist *list, EOlistIter *iter, EOlistIter *li)
+{
+    uint16_t index = s_eo_list_node_index(list, li);
+    uint16_t pre = EOK_uint16dummy;
+    
+    if(iter == list->head)
+    {
+        s_eo_list_indexed_link_front(list, li);
+        return;
+    }
+    
+    // iter is not the head, thus it has a prev
+    pre = s_eo_list_node_links(iter)->prev;
+    
+    s_eo_list_node_links(li)->prev = pre;
+    s_eo_list_node_links(li)->next = s_eo_list_node_index(list, iter);
+    s_eo_list_node_links(s_eo_list_node(list, pre))->next = index;
+    s_eo_list_node_links(iter)->prev = index;
+}
+
+
+static void s_eo_list_indexed_unlink(EOlist *list, EOlistIter *li)
+{
+    uint16_t prev = s_eo_list_node_links(li)->prev;
+    uint16_t next = s_eo_list_node_links(li)->next;
+    
+    if(EOK_uint16dummy == prev)
+    {
+        list->head = (EOK_uint16dummy == next) ? (NULL) : (s_eo_list_node(list, next));
+    }
+    else
+    {
+        s_eo_list_node_links(s_eo_list_node(list, prev))->next = next;
+    }
+    
+    if(EOK_uint16dummy == next)
+    {
+        list->tail = (EOK_uint16dummy == prev) ? (NULL) : (s_eo_list_node(list, prev));
+    }
+    else
+    {
+        s_eo_list_node_links(s_eo_list_node(list, next))->prev = prev;
+    }
+}
+
+
+static void s_eo_list_indexed_swap(EOlist *list, uint16_t a, uint16_t b)
+{
+    // byte by byte, so that the compiler knows that also the links are changed
+    uint8_t *na = (uint8_t*)s_eo_list_node(list, a);
+    uint8_t *nb = (uint8_t*)s_eo_list_node(list, b);
+    uint8_t tmp = 0;
+    uint16_t i = 0;
+    
+    for(i=0; i<list->nodesize; i++)
+    {
+        tmp = na[i];
+        na[i] = nb[i];
+        nb[i] = tmp;
+    }
+}
+
+
 static void s_eo_list_copy_item_into_iterator(EOlist *list, EOlistIter *li, void *p)
 {
     void* data = s_eo_list_get_data(list, li);
@@ -1131,6 +1431,14 @@ static EOlistIter* s_eo_list_iterator_get(EOlist* list)
     {   // create it
         li = s_eo_list_iterator_create(list);
     }
+    else if(NULL != list->nodes)
+    {   // get the first free node
+        if(EOK_uint16dummy != list->freenode)
+        {
+            li = s_eo_list_node(list, list->freenode);
+            list->freenode = s_eo_list_node_links(li)->next;
+        }
+    }
     else
     {   // get the first free iter
         li = list->freeiters;
@@ -1150,6 +1458,12 @@ static void s_eo_list_iterator_release(EOlist* list, EOlistIter* li)
     {   // destroy it
         s_eo_list_iterator_destroy(list, li);
     }
+    else if(NULL != list->nodes)
+    {   // i put the node back into the free nodes
+        s_eo_list_node_links(li)->prev = EOK_uint16dummy;
+        s_eo_list_node_links(li)->next = list->freenode;
+        list->freenode = s_eo_list_node_index(list, li);
+    }
     else
     {   // i put li back into the free iters
         list->freeiters = s_eo_list_push_front(list->freeiters, li);
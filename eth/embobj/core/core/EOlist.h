@@ -104,6 +104,36 @@ extern EOlist* eo_list_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                            eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
                            eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
 
+
+/** @fn         extern EOlist* eo_list_NewIndexed(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                                  eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                                  eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+    @brief      Creates a new list object as eo_list_New() does, but it keeps all the items in a single contiguous array 
+                of nodes which are linked by 16-bit indices rather than by pointers. The list uses one allocation only 
+                and a walk of it (e.g., eo_list_Execute()) touches adjacent memory, moreover so after eo_list_Compact().
+                All other functions work as in a list created by eo_list_New().
+    @param      item_size       The size in bytes of the item object managed by the EOlist.
+    @param      capacity        The max number of item objects stored by the EOlist. It cannot be eo_listcapacity_dynamic.
+    @param      item_init       As in eo_list_New().
+    @param      item_par        As in eo_list_New().                                
+    @param      item_copy       As in eo_list_New().
+    @param      item_clear      As in eo_list_New().
+    @return     Pointer to the required EOlist object. 
+ **/ 
+extern EOlist* eo_list_NewIndexed(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                  eOres_fp_voidp_uint32_t item_init, uint32_t init_par,
+                                  eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+
+
+/** @fn         extern void eo_list_Compact(EOlist *list)
+    @brief      Moves the nodes of a list created with eo_list_NewIndexed() so that the items stay in the array in the
+                same order they have in the list. It does nothing for the other lists. After many insertions and 
+                removals it restores the sequential access to memory of eo_list_Begin() / eo_list_Next().
+                Every EOlistIter of the list obtained before the call is not valid anymore.
+    @param      list            Pointer to the EOlist object.
+ **/ 
+extern void eo_list_Compact(EOlist *list);
+
 /** @fn         extern eOsizecntnr_t eo_list_Capacity(EOlist *list)
     @brief      Returns the maximum number of item objects that the EOlist is able to contain.
     @param      list           Pointer to the EOlist object.
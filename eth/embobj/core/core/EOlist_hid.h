@@ -59,6 +59,17 @@ struct EOlistIter_hid
 };
 
 
+/* @struct     eOlist_nodelinks_t
+    @brief      the start of every node of an indexed list. the item follows at offset itemoffset. the indices are
+                positions in the array of nodes, and EOK_uint16dummy means none. the free nodes are linked by next.
+ **/ 
+typedef struct
+{
+    uint16_t    prev;
+    uint16_t    next;
+} eOlist_nodelinks_t;
+
+
 /* @struct     EOlist_hid
     @brief      hidden definition. implements private data used only internally by the 
                 public or private (static) functions of the list object
@@ -75,6 +86,11 @@ struct EOlist_hid
     eOres_fp_voidp_voidp_t      item_copy_fn;           /*< copy constructor used on inserted data         */ 
     eOres_fp_voidp_t            item_clear_fn;             /*< destructor used on removed data                */ 
     EOlistIter                  *freeiters;             /*< pool of free iterators for the list            */
+    uint8_t                     *nodes;                 /*< the array of nodes of an indexed list, else NULL */
+    uint16_t                    nodesize;
+    uint16_t                    itemoffset;
+    uint16_t                    freenode;               /*< the first free node of an indexed list         */
+    uint16_t                    filler;
 };
 
  
@@ -24,6 +24,7 @@
 #include "EoCommon.h"
 #include "string.h"
 #include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
 
 
 
@@ -65,14 +66,15 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static void s_eo_packet_destroy(EOpacket *p);
 
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
 
-//static const char s_eobj_ownname[] = "EOpacket";
+static const char s_eobj_ownname[] = "EOpacket";
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -100,6 +102,8 @@ extern EOpacket* eo_packet_New(uint16_t capacity)
                                   ((uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, capacity, 1));
 
     retptr->externaldatastorage = (0 == capacity) ? (1) : (0);
+    retptr->refcount            = 1;
+    retptr->owner               = NULL;
 
     return(retptr);
 }
@@ -111,15 +115,8 @@ extern void eo_packet_Delete(EOpacket *p)
         return;
     } 
 
-    if(0 == p->externaldatastorage)
-    {   // the packet may contain a pointer to externally allocated data. but this is not the case, thus i delete  
-        eo_mempool_Delete(eo_mempool_GetHandle(), p->data);
-    }
-    
-    memset(p, 0, sizeof(EOpacket));
-    
-    eo_mempool_Delete(eo_mempool_GetHandle(), p);
-    return;
+    // the packet is deleted, or given back to its pool, only when its other holders have released it as well
+    eo_packet_Release(p);
 }
 
 
@@ -422,6 +419,77 @@ extern eOresult_t eo_packet_Copy(EOpacket *p, const EOpacket *source)
 }
 
 
+extern eOresult_t eo_packet_Buffer_Get(EOpacket *p, uint8_t **data, uint16_t *capacity)
+{
+    if((NULL == p) || (NULL == data) || (NULL == capacity)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 != p->externaldatastorage)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    *data = p->data;
+    *capacity = p->capacity;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_packet_Retain(EOpacket *p)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+#if defined(EO_atomic_load_acquire)
+    EO_atomic_fetch_add_relaxed(&p->refcount, 1);
+#else
+    p->refcount++;
+#endif
+    
+    return(eores_OK);
+}
+
+
+extern void eo_packet_Release(EOpacket *p)
+{
+    uint32_t refcount = 0;
+    
+    if(NULL == p) 
+    {
+        return;
+    }
+    
+    // the release order makes the writes of this holder visible to the one which reuses the packet
+#if defined(EO_atomic_load_acquire)
+    refcount = EO_atomic_fetch_sub_acqrel(&p->refcount, 1);
+#else
+    refcount = p->refcount--;
+#endif
+    
+    // a packet without references is already deleted or back in its pool: a further release would put it twice
+    eo_errman_Assert(eo_errman_GetHandle(), 0 != refcount, "eo_packet_Release(): no references", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    
+    if(1 != refcount)
+    {
+        return;
+    }
+    
+    if(NULL != p->owner)
+    {
+        p->owner->put(p->owner, p);
+    }
+    else
+    {
+        s_eo_packet_destroy(p);
+    }
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -441,6 +509,8 @@ extern eOresult_t eo_packet_hid_DefInit(void *p, uint32_t a)
     dtg->capacity           = a;
     dtg->data               = (0 ==a ) ? (NULL) : ((uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), a));
     dtg->externaldatastorage = (0 == a) ? (1) : (0);
+    dtg->refcount           = 1;
+    dtg->owner              = NULL;
 
     return(eores_OK);
 }
@@ -512,6 +582,8 @@ extern EOpacket* eo_packet_hid_Initialise(EOpacket *p, void *data, uint16_t capa
     retptr->data                = (uint8_t*) data;
 
     retptr->externaldatastorage = (0 == capacity) ? (1) : (0);
+    retptr->refcount            = 1;
+    retptr->owner               = NULL;
 
     return(retptr);
 }
@@ -522,7 +594,18 @@ extern EOpacket* eo_packet_hid_Initialise(EOpacket *p, void *data, uint16_t capa
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static void s_eo_packet_destroy(EOpacket *p)
+{
+    if(0 == p->externaldatastorage)
+    {   // the packet may contain a pointer to externally allocated data. but this is not the case, thus i delete  
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->data);
+    }
+    
+    memset(p, 0, sizeof(EOpacket));
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
 
 
 
@@ -36,6 +36,8 @@ extern "C" {
     The EOpacket can be created in two different modes. In the first mode the object has internal storage for the payload
     that is allocated at creation of the object. In such a way, data is copied to and from the internal buffer. 
     In the second mode, the object just cointains a reference to an externally allocated payload.
+    A packet has also a reference count, which starts at one. Its holders can add references with eo_packet_Retain() 
+    and drop them with eo_packet_Release(): the last release deletes the packet, or gives it back to its EOpacketPool.
          
     @{        
  **/
@@ -82,7 +84,8 @@ extern EOpacket* eo_packet_New(uint16_t capacity);
 
 
 /** @fn         extern void eo_packet_Delete(EOpacket *p)
-    @brief      Deletes the packet object, and in case of internal storage mode also the storage.
+    @brief      Drops the reference of the caller with eo_packet_Release(). When no other holder keeps the packet, it
+                is deleted, and in case of internal storage mode also the storage, or it goes back to its EOpacketPool.
     @param      p       The packet.
  **/
 extern void eo_packet_Delete(EOpacket *p);
@@ -229,6 +232,34 @@ extern uint16_t eo_packet_Payload_Pad(EOpacket *p, uint16_t finalsize, uint8_t v
 extern eOresult_t eo_packet_Copy(EOpacket *p, const EOpacket *source);
 
 
+/** @fn         extern eOresult_t eo_packet_Buffer_Get(EOpacket *p, uint8_t **data, uint16_t *capacity)
+    @brief      Gives the internal buffer of the packet so that it can be written in place, for instance by a recvfrom()
+                on a socket. Then the size must be set with eo_packet_Size_Set().
+    @param      p               The packet.
+    @param      data            Pointer to the internal buffer
+    @param      capacity        Pointer to the capacity of the buffer
+    @return     eores_OK, eores_NOK_nullpointer if any passed pointer is NULL, eores_NOK_generic if the packet has
+                external storage.
+ **/
+extern eOresult_t eo_packet_Buffer_Get(EOpacket *p, uint8_t **data, uint16_t *capacity);
+
+
+/** @fn         extern eOresult_t eo_packet_Retain(EOpacket *p)
+    @brief      Adds a reference to a packet created with eo_packet_New() or taken with eo_packetpool_Get().
+    @param      p               The packet.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_packet_Retain(EOpacket *p);
+
+
+/** @fn         extern void eo_packet_Release(EOpacket *p)
+    @brief      Drops a reference to a packet. When the last reference is dropped, a packet of a EOpacketPool goes back
+                to its pool and any other packet is deleted. A release of a packet without references is an error.
+    @param      p               The packet.
+ **/
+extern void eo_packet_Release(EOpacket *p);
+
+
 
 /** @}            
     end of group eo_packet  
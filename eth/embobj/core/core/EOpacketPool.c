@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOpacket_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOpacketPool.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOpacketPool_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define EOPACKETPOOL_top_index(t)           ((uint32_t)((t) & 0xffffffff))
+#define EOPACKETPOOL_top_make(tag, index)   ((((uint64_t)(tag)) << 32) | (uint64_t)(index))
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint16_t s_eo_packetpool_pop(EOpacketPool *p);
+static void s_eo_packetpool_push(EOpacketPool *p, uint16_t index);
+static void s_eo_packetpool_put(void *owner, EOpacket *pkt);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOpacketPool";
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern EOpacketPool* eo_packetpool_New(uint16_t number, uint16_t capacity, EOVmutexDerived *mutex)
+{
+    EOpacketPool *retptr = NULL;
+    uint32_t stride = 0;
+    uint8_t *payload = NULL;
+    uint16_t i = 0;
+
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != number) && (0 != capacity), "eo_packetpool_New(): 0 number or capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    retptr = (EOpacketPool*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(EOpacketPool), 1);
+
+    // every payload starts at a new cache line, so that packets used by different threads do not share lines
+    stride = (capacity + EOPACKETPOOL_ALIGNMENT - 1) & ~(EOPACKETPOOL_ALIGNMENT - 1);
+    retptr->storage = (uint8_t*) eo_mempool_New(eo_mempool_GetHandle(), number * stride + EOPACKETPOOL_ALIGNMENT);
+    payload = (uint8_t*) (((uintptr_t)retptr->storage + EOPACKETPOOL_ALIGNMENT - 1) & ~(uintptr_t)(EOPACKETPOOL_ALIGNMENT - 1));
+
+    retptr->packets = (EOpacket*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(EOpacket), number);
+    retptr->next = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), number);
+    retptr->owner.put = s_eo_packetpool_put;
+
+    for(i=0; i<number; i++)
+    {
+        eo_packet_hid_Initialise(&retptr->packets[i], &payload[i * stride], capacity);
+        retptr->packets[i].refcount = 0;
+        retptr->packets[i].owner = &retptr->owner;
+        retptr->next[i] = (i+1 < number) ? (i+2) : (0);
+    }
+
+    retptr->mutex = mutex;
+    retptr->top = EOPACKETPOOL_top_make(0, 1);
+    retptr->number = number;
+    retptr->capacity = capacity;
+    memset(&retptr->stats, 0, sizeof(eOpacketpool_stats_t));
+    retptr->stats.number = number;
+
+    return(retptr);
+}
+
+
+extern void eo_packetpool_Delete(EOpacketPool *p)
+{
+    eOpacketpool_stats_t stats;
+
+    if(NULL == p)
+    {
+        return;
+    }
+
+    eo_packetpool_Stats_Get(p, &stats);
+    eo_errman_Assert(eo_errman_GetHandle(), stats.available == stats.number, "eo_packetpool_Delete(): packets still in use", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->storage);
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->packets);
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->next);
+    memset(p, 0, sizeof(EOpacketPool));
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern EOpacket* eo_packetpool_Get(EOpacketPool *p)
+{
+    EOpacket *pkt = NULL;
+    uint16_t index = 0;
+
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    index = s_eo_packetpool_pop(p);
+
+#if defined(EO_atomic_load_acquire)
+    EO_atomic_fetch_add_relaxed((0 == index) ? (&p->stats.exhausted) : (&p->stats.gets), 1);
+#else
+    if(0 == index) { p->stats.exhausted++; } else { p->stats.gets++; }
+#endif
+
+    if(0 == index)
+    {
+        return(NULL);
+    }
+
+    pkt = &p->packets[index-1];
+    eo_packet_hid_DefClear(pkt);
+    pkt->refcount = 1;
+
+    return(pkt);
+}
+
+
+extern eOresult_t eo_packetpool_Stats_Get(EOpacketPool *p, eOpacketpool_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+#if defined(EO_atomic_load_acquire)
+    stats->gets         = EO_atomic_load_relaxed(&p->stats.gets);
+    stats->puts         = EO_atomic_load_relaxed(&p->stats.puts);
+    stats->exhausted    = EO_atomic_load_relaxed(&p->stats.exhausted);
+#else
+    stats->gets         = p->stats.gets;
+    stats->puts         = p->stats.puts;
+    stats->exhausted    = p->stats.exhausted;
+#endif
+    stats->number       = p->number;
+    stats->available    = (uint16_t)(p->number - (stats->gets - stats->puts));
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// the free packets are a stack of indices+1 linked by p->next. with atomics the top carries a tag incremented at
+// every pop, so that a pop which has read an old top and its next fails its CAS even if the same index is on top again.
+
+static uint16_t s_eo_packetpool_pop(EOpacketPool *p)
+{
+    uint16_t index = 0;
+#if defined(EO_atomic_load_acquire)
+    uint64_t top = EO_atomic_load_acquire(&p->top);
+    uint64_t newtop = 0;
+
+    do
+    {
+        index = (uint16_t)EOPACKETPOOL_top_index(top);
+        if(0 == index)
+        {
+            return(0);
+        }
+        newtop = EOPACKETPOOL_top_make((top >> 32) + 1, EO_atomic_load_relaxed(&p->next[index-1]));
+    } while(!EO_atomic_compare_exchange_acquire(&p->top, &top, newtop));
+#else
+    if(NULL != p->mutex)
+    {
+        eov_mutex_Take(p->mutex, eok_reltimeINFINITE);
+    }
+
+    index = (uint16_t)EOPACKETPOOL_top_index(p->top);
+    if(0 != index)
+    {
+        p->top = p->next[index-1];
+    }
+
+    if(NULL != p->mutex)
+    {
+        eov_mutex_Release(p->mutex);
+    }
+#endif
+
+    return(index);
+}
+
+
+static void s_eo_packetpool_push(EOpacketPool *p, uint16_t index)
+{
+#if defined(EO_atomic_load_acquire)
+    uint64_t top = EO_atomic_load_relaxed(&p->top);
+    uint64_t newtop = 0;
+
+    do
+    {
+        EO_atomic_store_relaxed(&p->next[index-1], (uint16_t)EOPACKETPOOL_top_index(top));
+        newtop = EOPACKETPOOL_top_make(top >> 32, index);
+    } while(!EO_atomic_compare_exchange_release(&p->top, &top, newtop));
+#else
+    if(NULL != p->mutex)
+    {
+        eov_mutex_Take(p->mutex, eok_reltimeINFINITE);
+    }
+
+    p->next[index-1] = (uint16_t)EOPACKETPOOL_top_index(p->top);
+    p->top = index;
+
+    if(NULL != p->mutex)
+    {
+        eov_mutex_Release(p->mutex);
+    }
+#endif
+}
+
+
+// it is called by eo_packet_Release() when the last reference is dropped
+static void s_eo_packetpool_put(void *owner, EOpacket *pkt)
+{
+    EOpacketPool *p = (EOpacketPool*) owner;
+
+    eo_errman_Assert(eo_errman_GetHandle(), (pkt >= p->packets) && (pkt < &p->packets[p->number]), "s_eo_packetpool_put(): not of this pool", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), 0 == pkt->refcount, "s_eo_packetpool_put(): still referenced", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+
+    s_eo_packetpool_push(p, (uint16_t)(pkt - p->packets) + 1);
+
+#if defined(EO_atomic_load_acquire)
+    EO_atomic_fetch_add_relaxed(&p->stats.puts, 1);
+#else
+    p->stats.puts++;
+#endif
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
+
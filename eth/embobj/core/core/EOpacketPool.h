@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPACKETPOOL_H_
+#define _EOPACKETPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOpacketPool.h
+    @brief      This header file implements public interface to a pool of packets.
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_packetpool Object EOpacketPool
+    The EOpacketPool keeps a fixed number of EOpacket objects with internal storage of the same capacity. All the
+    payloads are allocated at creation in a single block, each one starting at a 64-byte boundary.
+    A packet taken with eo_packetpool_Get() has one reference. Other holders can add references with eo_packet_Retain()
+    and every holder drops its own with eo_packet_Release(): when the last one is dropped the packet goes back to the
+    pool. Hence the receiver of a UDP datagram can do without any copy:
+
+        pkt = eo_packetpool_Get(pool);
+        eo_packet_Buffer_Get(pkt, &data, &capacity);
+        size = recvfrom(socket, data, capacity, ...);
+        eo_packet_Size_Set(pkt, size);
+        eo_packet_Addressing_Set(pkt, addr, port);
+        eo_transceiver_Receive(transceiver, pkt, &numberofrops, &txtime);
+        eo_packet_Release(pkt);
+
+    On hosts the free packets are kept in a lock-free stack, so that any thread can get or release a packet. Elsewhere
+    the pool uses the mutex passed to eo_packetpool_New(), if any.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVmutex.h"
+#include "EOpacket.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct EOpacketPool_hid EOpacketPool
+    @brief      EOpacketPool is an opaque struct. It is used to implement data abstraction for the pool
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOpacketPool_hid EOpacketPool;
+
+
+/** @typedef    typedef struct eOpacketpool_stats_t
+    @brief      Contains the counters of a EOpacketPool.
+ **/
+typedef struct
+{
+    uint32_t        gets;           /**< the packets given by eo_packetpool_Get() */
+    uint32_t        puts;           /**< the packets returned to the pool */
+    uint32_t        exhausted;      /**< the calls of eo_packetpool_Get() which found the pool empty */
+    uint16_t        available;      /**< the packets inside the pool now */
+    uint16_t        number;         /**< the packets of the pool */
+} eOpacketpool_stats_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOpacketPool* eo_packetpool_New(uint16_t number, uint16_t capacity, EOVmutexDerived *mutex)
+    @brief      Creates a new pool of packets.
+    @param      number      The number of packets.
+    @param      capacity    The capacity of each packet.
+    @param      mutex       The mutex used where atomic operations are not available. It can be NULL.
+    @return     The pointer to the required object.
+ **/
+extern EOpacketPool* eo_packetpool_New(uint16_t number, uint16_t capacity, EOVmutexDerived *mutex);
+
+
+/** @fn         extern void eo_packetpool_Delete(EOpacketPool *p)
+    @brief      Deletes the pool and all its packets. All the packets must have been returned to the pool.
+    @param      p           The pool.
+ **/
+extern void eo_packetpool_Delete(EOpacketPool *p);
+
+
+/** @fn         extern EOpacket* eo_packetpool_Get(EOpacketPool *p)
+    @brief      Takes a packet from the pool. The packet is cleared, it has size zero and one reference.
+    @param      p           The pool.
+    @return     The packet or NULL if the pool is empty.
+ **/
+extern EOpacket* eo_packetpool_Get(EOpacketPool *p);
+
+
+/** @fn         extern eOresult_t eo_packetpool_Stats_Get(EOpacketPool *p, eOpacketpool_stats_t *stats)
+    @brief      Gives the counters of the pool.
+    @param      p           The pool.
+    @param      stats       Where to copy the counters.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eo_packetpool_Stats_Get(EOpacketPool *p, eOpacketpool_stats_t *stats);
+
+
+
+/** @}
+    end of group eo_packetpool
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
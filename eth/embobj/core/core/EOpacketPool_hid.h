@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOPACKETPOOL_HID_H_
+#define _EOPACKETPOOL_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOpacketPool_hid.h
+    @brief      This header file implements hidden interface to a pool of packets.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVmutex.h"
+#include "EOpacket.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOpacketPool.h"
+#include "EOpacket_hid.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define EOPACKETPOOL_ALIGNMENT          64
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+/** @struct     EOpacketPool_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+struct EOpacketPool_hid
+{
+    eOpacket_owner_t        owner;          // it must be the first member: the packets are given back through it
+    EOpacket                *packets;       // the number packets
+    uint16_t                *next;          // the index+1 of the next free packet. 0 ends the stack
+    uint8_t                 *storage;       // the block of the payloads as given by the memory pool
+    EOVmutexDerived         *mutex;
+    uint64_t                top;            // the index+1 of the first free packet in the low 32 bits, a tag in the high ones
+    uint16_t                number;
+    uint16_t                capacity;
+    eOpacketpool_stats_t    stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
@@ -47,6 +47,13 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+// the owner of packets which are given back to it with put() when their last reference is dropped, rather than deleted.
+// it is the first member of the owner, such as the EOpacketPool, thus EOpacket does not depend on the owner's code
+typedef struct
+{
+    void (*put)(void *owner, EOpacket *pkt);
+} eOpacket_owner_t;
+
 /** @struct     EOpacket_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -64,6 +71,8 @@ struct EOpacket_hid
     uint16_t            write_index;
     uint16_t            read_index;
     uint8_t             *data;
+    uint32_t            refcount;
+    eOpacket_owner_t    *owner;             // the owner which takes the packet back, or NULL
 }; 
 
 
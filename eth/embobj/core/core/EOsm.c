@@ -132,7 +132,6 @@ extern eOresult_t eo_sm_Start(EOsm *p)
 
 extern eOresult_t eo_sm_ProcessEvent(EOsm *p, eOsmEvent_t ev) 
 {
-    EOsmStateQuickInfo_t *quickinfoonstate = NULL;
     const eOsmState_t *currstate = NULL;
     const eOsmState_t *nextstate = NULL;
     const eOsmTransition_t *transition = NULL;
@@ -153,10 +152,7 @@ extern eOresult_t eo_sm_ProcessEvent(EOsm *p, eOsmEvent_t ev)
         eo_sm_Start(p);
     }
     
-    quickinfoonstate = &(p->statequickinfo[p->activestate]);
-    
-   
-    if(0 == (quickinfoonstate->evtmask & (0x00000001 << ev)))
+    if(0 == (p->evtmasks[p->activestate] & (0x00000001 << ev)))
     {
         // no event for this state.
         return(eores_NOK_nodata);
@@ -166,7 +162,7 @@ extern eOresult_t eo_sm_ProcessEvent(EOsm *p, eOsmEvent_t ev)
     p->latestevent = ev;
     
     // there is a transition. 
-    transition = &(p->cfg->transitions[quickinfoonstate->transindices[ev]]);
+    transition = &(p->cfg->transitions[p->transindices[p->activestate * p->cfg->maxevts + ev]]);
 
     // the current state is 
     currstate = &(p->cfg->states[p->activestate]);
@@ -265,7 +261,8 @@ static void s_eo_sm_Specialise(EOsm *p, const eOsm_cfg_t * c)
 {
  
     const eOsmTransition_t *tr = NULL;
-    EOsmStateQuickInfo_t *st = NULL;
+    uint32_t *evtmasks = NULL;
+    uint8_t *transindices = NULL;
     uint8_t i = 0;
     
     
@@ -282,32 +279,41 @@ static void s_eo_sm_Specialise(EOsm *p, const eOsm_cfg_t * c)
     
 
 
-    // statequickinfo: get memory. the memory is zero initialised. 
-    // IMPORTANT: every evtmask must be zero.
-    p->statequickinfo = (EOsmStateQuickInfo_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOsmStateQuickInfo_t), c->nstates);
-    // also for transindices
-    for(i=0; i<c->nstates; i++)
+    if(NULL != c->quickinfo)
     {
-        p->statequickinfo[i].evtmask = 0; // it is a redundant instruction.
-        p->statequickinfo[i].transindices = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, 1, c->maxevts);
-    }
-    
-
-    // we map the transitions in ram into the statequickinfo
-    for(i=0; i<c->ntrans; i++)
-    {
-        tr = &c->transitions[i];
-        // tr must point to a valid location .... we cannot do much to verify that. however, we verify its content.
+        // the tables were computed in advance (e.g., at compile time by EOsmTable.h): nothing to build, but they must
+        // have been computed for the same states, events and transitions
         eo_errman_Assert(eo_errman_GetHandle(), 
-                         (tr->curr < c->nstates) && (tr->next < c->nstates) && (tr->evt < c->maxevts), 
-                         "s_eo_sm_Specialise(): wrong cfg", s_eobj_ownname, &eo_errman_DescrWrongParamLocal); 
-        
-        st = &p->statequickinfo[tr->curr];
+                         (c->quickinfo->nstates == c->nstates) && (c->quickinfo->maxevts == c->maxevts) && (c->quickinfo->transitions == c->transitions), 
+                         "s_eo_sm_Specialise(): quickinfo of another cfg", s_eobj_ownname, &eo_errman_DescrWrongParamLocal); 
         
-        // the evtmask keeps a bit in pos j-th if the j-th event triggers a transition
-        st->evtmask |= (0x00000001 << tr->evt);
-        // the j-th event triggers transition number st->transindices[j] in cfg->transitions.
-        st->transindices[tr->evt] = i; 
+        p->evtmasks = c->quickinfo->evtmasks;
+        p->transindices = c->quickinfo->transindices;
+    }
+    else
+    {
+        // quickinfo: get memory for all the states at once. the memory is zero initialised. 
+        // IMPORTANT: every evtmask must be zero.
+        evtmasks = (uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), c->nstates);
+        transindices = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, 1, c->nstates * c->maxevts);
+
+        // we map the transitions in ram into the quickinfo
+        for(i=0; i<c->ntrans; i++)
+        {
+            tr = &c->transitions[i];
+            // tr must point to a valid location .... we cannot do much to verify that. however, we verify its content.
+            eo_errman_Assert(eo_errman_GetHandle(), 
+                             (tr->curr < c->nstates) && (tr->next < c->nstates) && (tr->evt < c->maxevts), 
+                             "s_eo_sm_Specialise(): wrong cfg", s_eobj_ownname, &eo_errman_DescrWrongParamLocal); 
+            
+            // the evtmask keeps a bit in pos j-th if the j-th event triggers a transition
+            evtmasks[tr->curr] |= (0x00000001 << tr->evt);
+            // the j-th event triggers transition number transindices[curr*maxevts+j] in cfg->transitions.
+            transindices[tr->curr * c->maxevts + tr->evt] = i; 
+        }
+
+        p->evtmasks = evtmasks;
+        p->transindices = transindices;
     }
     
     
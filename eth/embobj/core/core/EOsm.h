@@ -39,6 +39,10 @@ extern "C" {
     The EOsm is less complex than its friend the EOumlsm (which is fully UML2.2-compliant),
     but processes events with a guaranteed time (except the time required for on-transition callback).
 
+    The lookup tables used to process the events are built in RAM by eo_sm_New(). In C++14 they can be instead
+    computed at compile time from the same states and transitions with EOsmTable.h, and passed to eo_sm_New() with
+    the field quickinfo of the configuration.
+
     @warning    The EOsm must be used by a single task because it does not have protection
                 versus concurrency.
     
@@ -94,7 +98,7 @@ typedef enum
 /** @typedef    typedef struct eOsmState_t
     @brief      State of a EOsm.
  **/ 
-typedef const struct
+typedef const struct eOsmState_struct
 {
     char                    name[EOSM_STATENAMESIZE];       /**< Name of the state  */
     eOsm_void_fp_smp_t      on_entry_fn;                    /**< Action on entry. It accepts the EOsm pointer as argument.  */
@@ -105,7 +109,7 @@ typedef const struct
 /** @typedef    typedef struct eOsmTransition_t
     @brief      Transition of a EOsm.
  **/ 
-typedef const struct
+typedef const struct eOsmTransition_struct
 {
     uint8_t                 curr;                           /**< Index of current state     */
     uint8_t                 next;                           /**< Index of next state        */
@@ -114,10 +118,27 @@ typedef const struct
 } eOsmTransition_t;
 
 
+/** @typedef    typedef struct eOsm_quickinfo_t
+    @brief      The lookup tables which give for each state the valid events and the transitions they trigger. The
+                transitions and the dimensions are those the tables were computed for: eo_sm_New() verifies that they
+                are the same of its eOsm_cfg_t.
+ **/ 
+typedef const struct eOsm_quickinfo_struct
+{
+    const uint32_t          *evtmasks;              /**< Array of @e nstates masks. Bit j is 1 if the j-th event triggers a transition */
+    const uint8_t           *transindices;          /**< Array of @e nstates x @e maxevts indices in the transitions array. The 
+                                                         transition of the j-th event in the i-th state is at position i*maxevts+j */
+    const eOsmTransition_t  *transitions;           /**< The transitions array the indices refer to */
+    uint8_t                 nstates;                /**< Number of states of the tables */
+    uint8_t                 maxevts;                /**< Number of events of the tables */
+} eOsm_quickinfo_t;
+
+
 /** @typedef    typedef const struct eOsm_cfg_t
-    @brief      Contains the configuration for the EOsm object
+    @brief      Contains the configuration for the EOsm object. It and the structs it points to have a tag, so that
+                they have linkage also in the C++ units which see the hidden struct, as the ones using EOsmTable.h.
  **/ 
-typedef const struct  
+typedef const struct eOsm_cfg_struct
 {
     uint8_t                 nstates;                /**< Total number of states. Up to 255 */  
     uint8_t                 ntrans;                 /**< Total number of transitions. Up to to 255 */
@@ -128,6 +149,7 @@ typedef const struct
     eOsmTransition_t*       transitions;            /**< Array containing all the @e ntrans transitions  */
     eOsm_void_fp_smp_t      init_fn;                /**< Called on creation of the EOsm. It accepts the EOsm pointer as argument  */                 
     eOsm_void_fp_smp_t      resetdynamicdata_fn;    /**< Resets the dynamic data of the EOsm. It accepts the EOsm pointer as argument  */
+    eOsm_quickinfo_t*       quickinfo;              /**< The lookup tables computed in advance, or NULL to have them built by eo_sm_New() */
 } eOsm_cfg_t;
 
 
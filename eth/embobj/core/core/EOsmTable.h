@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOSMTABLE_H_
+#define _EOSMTABLE_H_
+
+#if !defined(__cplusplus) || ((__cplusplus < 201402L) && !(defined(_MSVC_LANG) && (_MSVC_LANG >= 201402L)))
+    #error EOsmTable.h requires C++14
+#endif
+
+/** @file       EOsmTable.h
+    @brief      This header file computes at compile time the lookup tables of a EOsm.
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_smtable C++14 tables for EOsm
+    embot::core::sm::compile() takes the same states and transitions of a eOsm_cfg_t and computes at compile time
+    the lookup tables which eo_sm_New() would otherwise build in RAM. The tables are constexpr, thus they stay in ROM,
+    and they are given to the EOsm with the field quickinfo of its configuration. The EOsm remains a normal EOsm: its
+    callbacks, eo_sm_ProcessEvent() and the other functions of EOsm.h work as before.
+
+    The same compilation verifies the configuration. It stops with an error naming one of the functions inside
+    embot::core::sm::error if the initial state or a transition is out of range, if a state has two transitions with
+    the same event (eo_sm_New() would silently keep the latest), or if a state cannot be reached from the initial state.
+
+        enum { stIDLE = 0, stRUN = 1 };
+        enum { evGO = 0, evSTOP = 1, evNUMBEROF = 2 };
+
+        static constexpr eOsmState_t states[] = { {"idle", NULL, NULL}, {"run", on_entry_run, on_exit_run} };
+        static constexpr eOsmTransition_t transitions[] = { {stIDLE, stRUN, evGO, NULL}, {stRUN, stIDLE, evSTOP, NULL} };
+
+        static constexpr auto table = embot::core::sm::compile<evNUMBEROF>(states, transitions, stIDLE);
+        static constexpr eOsm_quickinfo_t quickinfo = table.quickinfo();
+
+        static const eOsm_cfg_t cfg = { 2, 2, evNUMBEROF, stIDLE, 0, states, transitions, NULL, NULL, &quickinfo };
+
+        EOsm *sm = eo_sm_New(&cfg);
+        embot::core::sm::process(sm, table, evGO);
+
+    embot::core::sm::process() does what eo_sm_ProcessEvent() does, but it takes the tables and the number of events
+    from the compiled table rather than from the configuration of the object. It reaches the state of the object with
+    the inline functions of EOsm_hid.h, thus the compiler can inline the whole dispatch.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+
+#include "EoCommon.h"
+#include "EOsm.h"
+#include "EOsm_hid.h"
+
+
+// - declaration of public user-defined types and functions -----------------------------------------------------------
+
+namespace embot { namespace core { namespace sm {
+
+    // compile() calls one of them only when the configuration is wrong. they are not constexpr, thus the compilation
+    // of a constexpr table stops there. they are never defined, thus compile() cannot be used at runtime either.
+    namespace error {
+        void initstate_out_of_range();
+        void transition_out_of_range();
+        void ambiguous_transition();
+        void unreachable_state();
+    }
+
+
+    // the lookup tables for NS states, NT transitions and NE events. evtmasks and transindices are as in eOsm_quickinfo_t
+    template<std::size_t NS, std::size_t NT, std::size_t NE>
+    struct Table
+    {
+        static_assert((NS > 0) && (NS <= 255), "EOsmTable: from 1 up to 255 states");
+        static_assert((NT > 0) && (NT <= 255), "EOsmTable: from 1 up to 255 transitions");
+        static_assert((NE > 0) && (NE <= 32), "EOsmTable: from 1 up to 32 events");
+
+        const eOsmState_t           *states;
+        const eOsmTransition_t      *transitions;
+        std::uint8_t                initstate;
+        std::uint32_t               evtmasks[NS];
+        std::uint8_t                transindices[NS*NE];
+
+        // it must be called on a table with static storage, so that the pointers stay valid
+        constexpr eOsm_quickinfo_t quickinfo() const
+        {
+            return eOsm_quickinfo_t { evtmasks, transindices, transitions, static_cast<std::uint8_t>(NS), static_cast<std::uint8_t>(NE) };
+        }
+    };
+
+
+    // NE is the number of events, the same as eOsm_cfg_t::maxevts. the result must be assigned to a static constexpr
+    template<std::size_t NE, std::size_t NS, std::size_t NT>
+    constexpr Table<NS, NT, NE> compile(const eOsmState_t (&states)[NS], const eOsmTransition_t (&transitions)[NT], std::uint8_t initstate)
+    {
+        Table<NS, NT, NE> t {};
+        bool reached[NS] {};
+        bool grown = true;
+
+        t.states = states;
+        t.transitions = transitions;
+        t.initstate = initstate;
+
+        if(initstate >= NS)
+        {
+            error::initstate_out_of_range();
+        }
+
+        for(std::size_t i=0; i<NT; i++)
+        {
+            const eOsmTransition_t &tr = transitions[i];
+
+            if((tr.curr >= NS) || (tr.next >= NS) || (tr.evt >= NE))
+            {
+                error::transition_out_of_range();
+            }
+
+            if(0 != (t.evtmasks[tr.curr] & (static_cast<std::uint32_t>(1) << tr.evt)))
+            {
+                error::ambiguous_transition();
+            }
+
+            t.evtmasks[tr.curr] |= (static_cast<std::uint32_t>(1) << tr.evt);
+            t.transindices[tr.curr*NE + tr.evt] = static_cast<std::uint8_t>(i);
+        }
+
+        // every state must be reached by a chain of transitions from the initial one
+        reached[initstate] = true;
+        while(true == grown)
+        {
+            grown = false;
+            for(std::size_t i=0; i<NT; i++)
+            {
+                if((true == reached[transitions[i].curr]) && (false == reached[transitions[i].next]))
+                {
+                    reached[transitions[i].next] = true;
+                    grown = true;
+                }
+            }
+        }
+
+        for(std::size_t s=0; s<NS; s++)
+        {
+            if(false == reached[s])
+            {
+                error::unreachable_state();
+            }
+        }
+
+        return t;
+    }
+
+
+    // the same as eo_sm_ProcessEvent(). p must have been created with a cfg whose quickinfo comes from t
+    template<std::size_t NS, std::size_t NT, std::size_t NE>
+    inline eOresult_t process(EOsm *p, const Table<NS, NT, NE> &t, eOsmEvent_t ev)
+    {
+        if(nullptr == p)
+        {
+            return(eores_NOK_nullpointer);
+        }
+
+        if(ev >= NE)
+        {
+            return(eores_NOK_generic);
+        }
+
+        const std::uint8_t active = eo_sm_hid_ActiveState(p);
+
+        if(0 == (t.evtmasks[active] & (static_cast<std::uint32_t>(1) << ev)))
+        {
+            // no event for this state.
+            return(eores_NOK_nodata);
+        }
+
+        eo_sm_hid_SetLatestEvent(p, ev);
+
+        const eOsmTransition_t &transition = t.transitions[t.transindices[active*NE + ev]];
+        const eOsmState_t &currstate = t.states[active];
+        const eOsmState_t &nextstate = t.states[transition.next];
+
+        if((&currstate != &nextstate) && (nullptr != currstate.on_exit_fn))
+        {
+            currstate.on_exit_fn(p);
+        }
+
+        if(nullptr != transition.on_transition_fn)
+        {
+            transition.on_transition_fn(p);
+        }
+
+        eo_sm_hid_SetActiveState(p, transition.next);
+
+        if((&currstate != &nextstate) && (nullptr != nextstate.on_entry_fn))
+        {
+            nextstate.on_entry_fn(p);
+        }
+
+        return(eores_OK);
+    }
+
+}}} // namespace embot { namespace core { namespace sm {
+
+
+/** @}
+    end of group eo_smtable
+ **/
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
@@ -47,15 +47,6 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
-/* @struct     EOsmStateQuickInfo_t
-    @brief      Keeps info about current state which are used in runtime to speed up the processing of events.
- **/ 
-typedef struct
-{
-    uint32_t                evtmask;                // mask of valid events for the state
-    uint8_t                 *transindices;          // indices of transitions in rom-mapped config for each event 
-} EOsmStateQuickInfo_t;
-
 /* @struct     EOeo_sm_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -68,7 +59,8 @@ struct EOsm_hid
     uint8_t                 started; 
     uint8_t                 activestate;            // current state of the state machine 
     uint8_t                 latestevent;            // the latest event received by the state machine 
-    EOsmStateQuickInfo_t    *statequickinfo;        // keeps an array of states in ram.
+    const uint32_t          *evtmasks;              // the lookup tables as in eOsm_quickinfo_t: either the ones of the 
+    const uint8_t           *transindices;          // cfg or built in ram
     void                    *ram;                   // private ram
 };
 
@@ -77,6 +69,39 @@ struct EOsm_hid
 // empty-section
 
 
+// - definition of hidden inline functions ----------------------------------------------------------------------------
+// they are used by embot::core::sm::process() of EOsmTable.h, which so is inlined together with them.
+
+/** @fn         EO_static_inline uint8_t eo_sm_hid_ActiveState(EOsm *p)
+    @brief      Starts the EOsm if it is not started yet and gives its active state.
+ **/
+EO_static_inline uint8_t eo_sm_hid_ActiveState(EOsm *p)
+{
+    if(0 == p->started)
+    {
+        eo_sm_Start(p);
+    }
+
+    return(p->activestate);
+}
+
+/** @fn         EO_static_inline void eo_sm_hid_SetLatestEvent(EOsm *p, eOsmEvent_t ev)
+    @brief      Records the event which triggers a transition, as eo_sm_ProcessEvent() does before any callback.
+ **/
+EO_static_inline void eo_sm_hid_SetLatestEvent(EOsm *p, eOsmEvent_t ev)
+{
+    p->latestevent = ev;
+}
+
+/** @fn         EO_static_inline void eo_sm_hid_SetActiveState(EOsm *p, uint8_t state)
+    @brief      Moves the EOsm into a state, as eo_sm_ProcessEvent() does after the on-transition callback.
+ **/
+EO_static_inline void eo_sm_hid_SetActiveState(EOsm *p, uint8_t state)
+{
+    p->activestate = state;
+}
+
+
 #ifdef __cplusplus
 }       // closing brace for extern "C"
 #endif 
@@ -26,6 +26,13 @@
 #include "string.h"
 #include "EOVtheSystem.h"
 #include "EOVtask.h"
+#include "EOtheMemoryPool.h"
+
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EO_ERRMAN_USE_ASYNC
+    #include <pthread.h>
+    #include <time.h>
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -45,7 +52,16 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EO_ERRMAN_ASYNC_RATE_entries        32
+
+// the rate limiter is set-associative: a key can use any of the ways of the set chosen by its hash
+#define EO_ERRMAN_ASYNC_RATE_ways           4
+
+#define EO_ERRMAN_ASYNC_RATE_sets           (EO_ERRMAN_ASYNC_RATE_entries / EO_ERRMAN_ASYNC_RATE_ways)
+
+// it gives the set of a key
+#define EO_ERRMAN_ASYNC_RATE_hash(key)      (((((key) ^ ((key) >> 16)) * 0x9E3779B1u) >> 16) & (EO_ERRMAN_ASYNC_RATE_sets - 1))
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -62,6 +78,15 @@ const eOerrman_cfg_t eo_errman_DefaultCfg =
     }
 };
 
+const eOerrman_async_cfg_t eo_errman_async_DefaultCfg = 
+{
+    EO_INIT(.capacity)      256,
+    EO_INIT(.ratelimit)     10,
+    EO_INIT(.ratewindow)    1000000,
+    EO_INIT(.drainperiod)   10000,
+    EO_INIT(.onrecord)      NULL
+};
+
 
 const eOerrmanDescriptor_t eo_errman_DescrUnspecified = 
 {
@@ -130,7 +155,42 @@ const eOerrmanDescriptor_t eo_errman_DescrRuntimeFatalErrorState =
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if defined(EO_ERRMAN_USE_ASYNC)
+
+// a slot of the ring of the async mode. sequence is equal to the position when the slot is free for the producer which
+// takes that position, and to position+1 when the record is ready for the consumer.
+typedef struct
+{
+    uint32_t                sequence;
+    eOerrman_record_t       record;
+} eOerrman_async_slot_t;
+
+// an entry of the rate limiter, inside the set chosen by a hash of its key. the key is the code of the descriptor or,
+// for the records without a descriptor, the name of the caller object
+typedef struct
+{
+    uint32_t                code;
+    const char*             eobjstr;
+    uint32_t                count;
+    eOabstime_t             windowstart;
+} eOerrman_async_rate_t;
+
+typedef struct
+{
+    eOerrman_async_cfg_t    cfg;
+    eOerrman_async_slot_t   *slots;
+    uint32_t                capacity;       // the number of allocated slots
+    uint32_t                enabled;
+    uint32_t                draining;
+    uint32_t                running;        // the drain thread is running
+    uint32_t                tail;           // next position for the producers
+    uint32_t                head;           // next position for the consumer
+    eOerrman_async_stats_t  stats;
+    eOerrman_async_rate_t   rate[EO_ERRMAN_ASYNC_RATE_entries];
+} eOerrman_async_t;
+
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -139,6 +199,12 @@ const eOerrmanDescriptor_t eo_errman_DescrRuntimeFatalErrorState =
 
 static void s_eo_errman_OnError(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des);
 
+#if defined(EO_ERRMAN_USE_ASYNC)
+static eObool_t s_eo_errman_async_Push(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des);
+static eObool_t s_eo_errman_async_RateAllows(const eOerrman_record_t *record, eOabstime_t now);
+static void * s_eo_errman_async_Thread(void *arg);
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -164,6 +230,12 @@ static EOtheErrorManager s_errman_singleton =
     }
 };
 
+#if defined(EO_ERRMAN_USE_ASYNC)
+// the async mode lives outside the singleton, so that it costs nothing where it does not exist. it is off by default
+static eOerrman_async_t s_eo_errman_async = {{0}};
+static pthread_t s_eo_errman_async_thread;
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -321,6 +393,172 @@ extern void eo_errman_Trace(EOtheErrorManager *p, const char *info, const char *
 #endif
 }
 
+
+extern eOresult_t eo_errman_Async_Start(EOtheErrorManager *p, const eOerrman_async_cfg_t *cfg)
+{
+#if !defined(EODEF_DONT_USE_THE_ERRORMAN) && defined(EO_ERRMAN_USE_ASYNC)
+    eOerrman_async_t *async = &s_eo_errman_async;
+    uint32_t i = 0;
+    
+    if(NULL == cfg)
+    {
+        cfg = &eo_errman_async_DefaultCfg;
+    }
+    
+    if((0 != async->enabled) || (0 != async->running) || (0 == cfg->capacity) || (0 != (cfg->capacity & (cfg->capacity - 1))))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(cfg->capacity != async->capacity)
+    {
+        if(NULL != async->slots)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), async->slots);
+        }
+        async->slots = (eOerrman_async_slot_t*) eo_mempool_New(eo_mempool_GetHandle(), cfg->capacity * sizeof(eOerrman_async_slot_t));
+        async->capacity = cfg->capacity;
+        for(i=0; i<async->capacity; i++)
+        {
+            async->slots[i].sequence = i;
+        }
+        async->head = async->tail = 0;
+    }
+    
+    memcpy(&async->cfg, cfg, sizeof(eOerrman_async_cfg_t));
+    memset(async->rate, 0, sizeof(async->rate));
+    
+    if(0 != cfg->drainperiod)
+    {
+        EO_atomic_store_release(&async->running, 1);
+        if(0 != pthread_create(&s_eo_errman_async_thread, NULL, s_eo_errman_async_Thread, async))
+        {
+            EO_atomic_store_release(&async->running, 0);
+            return(eores_NOK_generic);
+        }
+    }
+    
+    EO_atomic_store_release(&async->enabled, 1);
+    
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_errman_Async_Stop(EOtheErrorManager *p)
+{
+#if !defined(EODEF_DONT_USE_THE_ERRORMAN) && defined(EO_ERRMAN_USE_ASYNC)
+    eOerrman_async_t *async = &s_eo_errman_async;
+    
+    if(0 == async->enabled)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // a producer which has already seen enabled equal to 1 may still push its record after the last drain. 
+    // that record stays in the ring until the next start.
+    EO_atomic_store_release(&async->enabled, 0);
+    
+    if(0 != async->running)
+    {
+        EO_atomic_store_release(&async->running, 0);
+        pthread_join(s_eo_errman_async_thread, NULL);
+    }
+    
+    eo_errman_Async_Drain(p, 0);
+    
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern uint32_t eo_errman_Async_Drain(EOtheErrorManager *p, uint32_t maxrecords)
+{
+#if !defined(EODEF_DONT_USE_THE_ERRORMAN) && defined(EO_ERRMAN_USE_ASYNC)
+    eOerrman_async_t *async = &s_eo_errman_async;
+    eOerrman_async_slot_t *slot = NULL;
+    eOerrmanCaller_t caller = {0};
+    uint32_t removed = 0;
+    uint32_t head = 0;
+    eOabstime_t now = 0;
+    
+    if((NULL == async->slots) || (0 != EO_atomic_exchange_acquire(&async->draining, 1)))
+    {
+        return(0);
+    }
+    
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    head = async->head;
+    
+    while((0 == maxrecords) || (removed < maxrecords))
+    {
+        slot = &async->slots[head & (async->capacity - 1)];
+        if(EO_atomic_load_acquire(&slot->sequence) != (head + 1))
+        {   // empty
+            break;
+        }
+        
+        if((0 == async->cfg.ratelimit) || (eobool_true == s_eo_errman_async_RateAllows(&slot->record, now)))
+        {
+            if(NULL != async->cfg.onrecord)
+            {
+                async->cfg.onrecord(&slot->record);
+            }
+            else if(NULL != s_errman_singleton.cfg.extfn.usr_on_error)
+            {
+                caller.taskid = slot->record.taskid;
+                caller.eobjstr = slot->record.eobjstr;
+                s_errman_singleton.cfg.extfn.usr_on_error((eOerrmanErrorType_t)slot->record.errtype, slot->record.info, &caller, (1 == slot->record.hasdes) ? (&slot->record.des) : (NULL));
+            }
+            EO_atomic_fetch_add_relaxed(&async->stats.delivered, 1);
+        }
+        else
+        {
+            EO_atomic_fetch_add_relaxed(&async->stats.droppedrate, 1);
+        }
+        
+        // gives the slot back to the producer which will take position head+capacity
+        EO_atomic_store_release(&slot->sequence, head + async->capacity);
+        head++;
+        removed++;
+    }
+    
+    async->head = head;
+    EO_atomic_store_release(&async->draining, 0);
+    
+    return(removed);
+#else
+    return(0);
+#endif
+}
+
+
+extern eOresult_t eo_errman_Async_Stats_Get(EOtheErrorManager *p, eOerrman_async_stats_t *stats)
+{
+#if !defined(EODEF_DONT_USE_THE_ERRORMAN) && defined(EO_ERRMAN_USE_ASYNC)
+    eOerrman_async_t *async = &s_eo_errman_async;
+    
+    if(NULL == stats)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    stats->pushed       = EO_atomic_load_relaxed(&async->stats.pushed);
+    stats->delivered    = EO_atomic_load_relaxed(&async->stats.delivered);
+    stats->droppedfull  = EO_atomic_load_relaxed(&async->stats.droppedfull);
+    stats->droppedrate  = EO_atomic_load_relaxed(&async->stats.droppedrate);
+    stats->evictedrate  = EO_atomic_load_relaxed(&async->stats.evictedrate);
+    
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -335,6 +573,14 @@ extern void eo_errman_Trace(EOtheErrorManager *p, const char *info, const char *
 static void s_eo_errman_OnError(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des)
 {
 #ifndef EODEF_DONT_USE_THE_ERRORMAN
+#if defined(EO_ERRMAN_USE_ASYNC)
+    if((errtype < eo_errortype_fatal) && (0 != EO_atomic_load_acquire(&s_eo_errman_async.enabled)))
+    {
+        s_eo_errman_async_Push(errtype, info, caller, des);
+        return;
+    }
+#endif
+
     if(NULL != s_errman_singleton.cfg.extfn.usr_on_error)
     {
         s_errman_singleton.cfg.extfn.usr_on_error(errtype, info, caller, des);
@@ -355,6 +601,150 @@ static void s_eo_errman_OnError(eOerrmanErrorType_t errtype, const char *info, e
 }
 
 
+#if defined(EO_ERRMAN_USE_ASYNC)
+
+static eObool_t s_eo_errman_async_Push(eOerrmanErrorType_t errtype, const char *info, eOerrmanCaller_t *caller, const eOerrmanDescriptor_t *des)
+{
+    eOerrman_async_t *async = &s_eo_errman_async;
+    eOerrman_async_slot_t *slot = NULL;
+    uint32_t pos = EO_atomic_load_relaxed(&async->tail);
+    int32_t diff = 0;
+    uint32_t i = 0;
+    
+    for(;;)
+    {
+        slot = &async->slots[pos & (async->capacity - 1)];
+        diff = (int32_t)(EO_atomic_load_acquire(&slot->sequence) - pos);
+        if(0 == diff)
+        {   // the slot is free: try to take position pos. if it fails, pos is updated with the current tail
+            if(EO_atomic_compare_exchange_relaxed(&async->tail, &pos, pos + 1))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {   // the consumer has not yet released the slot: the ring is full
+            EO_atomic_fetch_add_relaxed(&async->stats.droppedfull, 1);
+            return(eobool_false);
+        }
+        else
+        {   // another producer has taken pos in the meantime
+            pos = EO_atomic_load_relaxed(&async->tail);
+        }
+    }
+    
+    slot->record.timestamp = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    slot->record.errtype = (uint8_t)errtype;
+    slot->record.taskid = caller->taskid;
+    slot->record.eobjstr = caller->eobjstr;
+    slot->record.hasdes = (NULL == des) ? (0) : (1);
+    if(NULL != des)
+    {
+        slot->record.des = *des;
+    }
+    else
+    {
+        memset(&slot->record.des, 0, sizeof(eOerrmanDescriptor_t));
+    }
+    
+    if(NULL != info)
+    {
+        for(i=0; (i<(EO_ERRMAN_ASYNC_INFOSIZE-1)) && ('\0' != info[i]); i++)
+        {
+            slot->record.info[i] = info[i];
+        }
+    }
+    slot->record.info[i] = '\0';
+    
+    EO_atomic_store_release(&slot->sequence, pos + 1);
+    EO_atomic_fetch_add_relaxed(&async->stats.pushed, 1);
+    
+    return(eobool_true);
+}
+
+
+static eObool_t s_eo_errman_async_RateAllows(const eOerrman_record_t *record, eOabstime_t now)
+{
+    eOerrman_async_t *async = &s_eo_errman_async;
+    // the records without a descriptor all have code 0: they are told apart by the caller object
+    uint32_t code = (0 != record->hasdes) ? (record->des.code) : (0);
+    const char *eobjstr = (0 != record->hasdes) ? (NULL) : (record->eobjstr);
+    uint32_t key = code ^ (uint32_t)(uintptr_t)eobjstr;
+    eOerrman_async_rate_t *set = &async->rate[EO_ERRMAN_ASYNC_RATE_hash(key) * EO_ERRMAN_ASYNC_RATE_ways];
+    eOerrman_async_rate_t *rate = NULL;
+    eOerrman_async_rate_t *victim = NULL;
+    uint8_t w = 0;
+    
+    // the entry of the key or, if it has none, a free entry or the entry with the oldest window
+    for(w=0; w<EO_ERRMAN_ASYNC_RATE_ways; w++)
+    {
+        eOerrman_async_rate_t *e = &set[w];
+        
+        if((0 != e->count) && (code == e->code) && (eobjstr == e->eobjstr))
+        {
+            rate = e;
+            break;
+        }
+        
+        if((0 != e->count) && ((now - e->windowstart) >= async->cfg.ratewindow))
+        {   // an expired window is free as well
+            e->count = 0;
+        }
+        
+        if((NULL == victim) || ((0 != victim->count) && ((0 == e->count) || (e->windowstart < victim->windowstart))))
+        {
+            victim = e;
+        }
+    }
+    
+    if(NULL == rate)
+    {   // a new window for the key
+        if(0 != victim->count)
+        {   // the window of another key is closed early
+            EO_atomic_fetch_add_relaxed(&async->stats.evictedrate, 1);
+        }
+        rate = victim;
+        rate->code = code;
+        rate->eobjstr = eobjstr;
+        rate->count = 0;
+        rate->windowstart = now;
+    }
+    else if((now - rate->windowstart) >= async->cfg.ratewindow)
+    {   // the window of the key has expired
+        rate->count = 0;
+        rate->windowstart = now;
+    }
+    
+    if(rate->count >= async->cfg.ratelimit)
+    {
+        return(eobool_false);
+    }
+    
+    rate->count++;
+    return(eobool_true);
+}
+
+
+static void * s_eo_errman_async_Thread(void *arg)
+{
+    eOerrman_async_t *async = (eOerrman_async_t*) arg;
+    struct timespec ts;
+    
+    ts.tv_sec = async->cfg.drainperiod / 1000000;
+    ts.tv_nsec = (async->cfg.drainperiod % 1000000) * 1000;
+    
+    while(0 != EO_atomic_load_acquire(&async->running))
+    {
+        eo_errman_Async_Drain(&s_errman_singleton, 0);
+        nanosleep(&ts, NULL);
+    }
+    
+    return(NULL);
+}
+
+#endif
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
@@ -34,6 +34,14 @@ extern "C" {
     
     The error manager singleton is used by the embOBJ to report errors and to enter in the appropriate error mode.
     This singleton can work in the SEE or MEE by means of some virtual objects: the EOVtheSystem and the EOVtask.  
+
+    By default an error is reported synchronously: the usr_on_error() is called inside the context of the caller, hence
+    the caller pays the formatting and the I/O done by the handler. With eo_errman_Async_Start() the non-fatal errors
+    are instead copied as a compact record of type eOerrman_record_t into a lock-free ring with one consumer and many
+    producers, and they are delivered later by eo_errman_Async_Drain(), which also limits the rate of records of the same
+    code, or of the same caller object for the records without a descriptor. The rate limiter keeps 32 of them in sets of
+    4 entries: when the 4 entries of a set hold open windows of others, the oldest one is closed early and counted in eOerrman_async_stats_t::evictedrate. The drain can be done by a dedicated thread (only on POSIX systems) or by the application. Fatal errors are
+    always reported synchronously. The async mode requires the atomic builtins of gcc or clang and the EOtheMemoryPool.
   
     @{		
  **/
@@ -48,6 +56,8 @@ extern "C" {
 // - public #define  --------------------------------------------------------------------------------------------------
 
 #define EO_ERRMAN_VERSION   2
+
+#define EO_ERRMAN_ASYNC_INFOSIZE    48
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -160,12 +170,61 @@ typedef struct
 } eOerrman_cfg_t;
 
 
+/** @typedef    typedef struct eOerrman_record_t
+    @brief      Contains an error as it is kept inside the ring of the async mode. The info string is copied and truncated
+                to EO_ERRMAN_ASYNC_INFOSIZE-1 characters, whereas the eobjstr is kept as a pointer because it is always
+                the constant name of an object.
+ **/
+typedef struct
+{
+    eOabstime_t             timestamp;      /**< the lifetime of the system when the error was reported */
+    eOerrmanDescriptor_t    des;            /**< a copy of the descriptor. it is meaningful only if hasdes is 1 */
+    const char*             eobjstr;        /**< the name of the caller object */
+    uint8_t                 errtype;        /**< use values in eOerrmanErrorType_t */
+    eOid08_t                taskid;         /**< the id of the caller task */
+    uint8_t                 hasdes;         /**< 1 if the caller passed a descriptor, 0 otherwise */
+    uint8_t                 filler;
+    char                    info[EO_ERRMAN_ASYNC_INFOSIZE];
+} eOerrman_record_t;
+
+
+typedef     void (*eOerrman_fp_onrecord_t)(const eOerrman_record_t *rec);
+
+
+/** @typedef    typedef struct eOerrman_async_cfg_t
+    @brief      Contains the configuration of the async mode of the EOtheErrorManager.
+ **/
+typedef struct
+{
+    uint16_t                capacity;       /**< the number of records inside the ring. it must be a power of two */
+    uint16_t                ratelimit;      /**< the max number of records of the same code (or caller object if without descriptor) delivered in a ratewindow. 0 means no limit */
+    eOreltime_t             ratewindow;     /**< the window of the rate limiter in micro-seconds */
+    eOreltime_t             drainperiod;    /**< if not 0, a thread calls eo_errman_Async_Drain() with this period in micro-seconds */
+    eOerrman_fp_onrecord_t  onrecord;       /**< called for every delivered record. if NULL it is called the usr_on_error() */
+} eOerrman_async_cfg_t;
+
+
+/** @typedef    typedef struct eOerrman_async_stats_t
+    @brief      Contains the counters of the async mode of the EOtheErrorManager.
+ **/
+typedef struct
+{
+    uint32_t        pushed;         /**< the records put inside the ring */
+    uint32_t        delivered;      /**< the records given to the handler */
+    uint32_t        droppedfull;    /**< the records lost because the ring was full */
+    uint32_t        droppedrate;    /**< the records removed from the ring but not delivered because of the rate limiter */
+    uint32_t        evictedrate;    /**< the windows of the rate limiter closed early to give their entry to another code or caller object */
+} eOerrman_async_stats_t;
+
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
 
 extern const eOerrman_cfg_t eo_errman_DefaultCfg; // = {.extfn = { .usr_on_error = NULL}};
 
+extern const eOerrman_async_cfg_t eo_errman_async_DefaultCfg; // = { 256, 10, 1000000, 10000, NULL };
+
 
 extern const eOerrmanDescriptor_t eo_errman_DescrUnspecified;
 
@@ -280,6 +339,46 @@ extern void eo_errman_Warning(EOtheErrorManager *p, const char *info, const char
 
 extern void eo_errman_Trace(EOtheErrorManager *p, const char *info, const char *eobjstr);
 
+
+/** @fn         extern eOresult_t eo_errman_Async_Start(EOtheErrorManager *p, const eOerrman_async_cfg_t *cfg)
+    @brief      Starts the async mode: from now on the non-fatal errors are put inside the ring. The ring is allocated
+                from the EOtheMemoryPool. If cfg->drainperiod is not 0 it also starts the drain thread. A start after
+                a stop with a different capacity reallocates the ring, hence no thread must report errors meanwhile.
+    @param      p               The singleton
+    @param      cfg             The configuration. If NULL, it is used eo_errman_async_DefaultCfg.
+    @return     eores_OK, eores_NOK_generic if already started or if the capacity is not a power of two, 
+                eores_NOK_unsupported if the platform does not support the async mode.
+ **/
+extern eOresult_t eo_errman_Async_Start(EOtheErrorManager *p, const eOerrman_async_cfg_t *cfg);
+
+
+/** @fn         extern eOresult_t eo_errman_Async_Stop(EOtheErrorManager *p)
+    @brief      Stops the async mode: it stops the drain thread and it delivers the records still inside the ring.
+                From now on the errors are reported synchronously.
+    @param      p               The singleton
+    @return     eores_OK, eores_NOK_generic if not started, eores_NOK_unsupported if the platform does not support it.
+ **/
+extern eOresult_t eo_errman_Async_Stop(EOtheErrorManager *p);
+
+
+/** @fn         extern uint32_t eo_errman_Async_Drain(EOtheErrorManager *p, uint32_t maxrecords)
+    @brief      Removes up to maxrecords records from the ring and delivers those allowed by the rate limiter. Only one
+                caller at a time drains: if the function is already running in another thread, it returns 0.
+    @param      p               The singleton
+    @param      maxrecords      The max number of records to remove. 0 means all of them.
+    @return     The number of records removed from the ring.
+ **/
+extern uint32_t eo_errman_Async_Drain(EOtheErrorManager *p, uint32_t maxrecords);
+
+
+/** @fn         extern eOresult_t eo_errman_Async_Stats_Get(EOtheErrorManager *p, eOerrman_async_stats_t *stats)
+    @brief      Gives the counters of the async mode since the first eo_errman_Async_Start().
+    @param      p               The singleton
+    @param      stats           Where to copy the counters.
+    @return     eores_OK, eores_NOK_nullpointer if stats is NULL, eores_NOK_unsupported if the platform does not support it.
+ **/
+extern eOresult_t eo_errman_Async_Stats_Get(EOtheErrorManager *p, eOerrman_async_stats_t *stats);
+
 /** @}            
     end of group eo_theerrormanager  
  **/
@@ -26,6 +26,7 @@
 #include "EoCommon.h"
 #include "EOtheErrorManager.h"
 #include "EOVmutex.h"
+#include "EOVtheSystem.h"
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -34,6 +35,11 @@
 
 #include "EOtheMemoryPool.h"
 
+// the functions are defined here with their own names
+#undef eo_mempool_GetMemory
+#undef eo_mempool_New
+#undef eo_mempool_Realloc
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern hidden interface 
@@ -45,7 +51,19 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EO_MEMPOOL_SLAB_bytesperslab        4096
+#define EO_MEMPOOL_SLAB_minblocksperslab    4
+#define EO_MEMPOOL_SLAB_magic               0x5a
+
+// the bytes of free blocks a thread keeps for every class. when it has more, it gives back half of them
+#define EO_MEMPOOL_SLAB_cachedbytes         2048
+#define EO_MEMPOOL_SLAB_mincachedblocks     2
+
+#if !defined(EO_TAILOR_CODE_FOR_ARM) && !defined(EO_TAILOR_CODE_FOR_DSPIC)
+    // the hosts have thread local storage, thus every thread keeps some free blocks of every class for itself
+    #define EO_MEMPOOL_SLAB_USE_CACHES
+#endif
 
  // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -77,6 +95,32 @@ static void s_memfree(void *p);
 
 static void * s_memrealloc(void *p, uint32_t s);
 
+static void s_eo_mempool_stats_update(int32_t deltapool, int32_t deltaheap);
+
+static void * s_eo_mempool_slab_get(uint32_t size);
+static void s_eo_mempool_slab_release(void *m);
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size);
+static eObool_t s_eo_mempool_slab_refill(uint8_t sizeclass);
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+static eObool_t s_eo_mempool_slab_cache_fill(uint8_t sizeclass, eOmempool_slab_cache_t *cache);
+static void s_eo_mempool_slab_cache_drain(uint8_t sizeclass, eOmempool_slab_cache_t *cache, uint32_t number);
+static void s_eo_mempool_slab_cache_flush(uint8_t sizeclass, eOmempool_slab_cache_t *cache);
+#endif
+
+static void * s_eo_mempool_arena_get(uint32_t size);
+static eOmempool_arena_t * s_eo_mempool_arena_owner(void *m);
+static void * s_eo_mempool_arena_realloc(eOmempool_arena_t *arena, void *m, uint32_t size);
+
+static void * s_eo_mempool_getmemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number);
+static void * s_eo_mempool_new(EOtheMemoryPool *p, uint32_t size);
+static void * s_eo_mempool_realloc(EOtheMemoryPool *p, void *m, uint32_t size);
+
+static void s_eo_mempool_profiler_track(void *m, uint32_t size, const char *tag, uint8_t tagindex);
+static uint8_t s_eo_mempool_profiler_untrack(void *m);
+static void s_eo_mempool_profiler_untrack_range(uint8_t *from, uint8_t *to);
+static void s_eo_mempool_profiler_remove(uint32_t slot);
+static uint8_t s_eo_mempool_profiler_tag_get(const char *tag);
+
 //static size_t s_eo_mempool_heap_sizeof_allocated_pointer(void* p);
 
 //static uint16_t s_align_size(eOmempool_alignment_t alignmode, uint16_t size);
@@ -87,6 +131,11 @@ static void * s_memrealloc(void *p, uint32_t s);
 
 static const char s_eobj_ownname[] = "EOtheMemoryPool";
 
+static const uint16_t s_eo_mempool_slab_blocksizes[eo_mempool_slab_classes_numberof] = 
+{
+    16, 32, 64, 128, 256, 512, 1024, 2048
+};
+
 
 static EOtheMemoryPool s_the_mempool = 
 { 
@@ -130,9 +179,22 @@ static EOtheMemoryPool s_the_mempool =
     {
         EO_INIT(.usedbytesheap)     0,
         EO_INIT(.usedbytespool)     0
-    }
+    },
+    EO_INIT(.slab)          {{{NULL}}},
+    EO_INIT(.arenas)        NULL,
+    EO_INIT(.profiler)      {0}
 };
 
+static const char s_eo_mempool_profiler_unknown[] = "unknown";
+
+// the arena entered by the running thread, if any
+static EO_threadlocal eOmempool_arena_t * s_eo_mempool_arena_active = NULL;
+
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+// the free blocks of the running thread
+static EO_threadlocal eOmempool_slab_cache_t s_eo_mempool_slab_caches[eo_mempool_slab_classes_numberof] = {{NULL}};
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -170,6 +232,16 @@ extern EOtheMemoryPool * eo_mempool_Initialise(const eOmempool_cfg_t *cfg)
     
     switch(cfg->mode)
     {
+        case eo_mempool_alloc_slab:
+        {
+            uint8_t i = 0;
+            memset(&s_the_mempool.slab, 0, sizeof(s_the_mempool.slab));
+            for(i=0; i<eo_mempool_slab_classes_numberof; i++)
+            {
+                s_the_mempool.slab.classes[i].stats.blocksize = s_eo_mempool_slab_blocksizes[i];
+            }
+        } // and now we also get the heap functions in the same way as the dynamic mode    
+        // fall through
         case eo_mempool_alloc_dynamic:
         {
             if(NULL != cfg->conf)
@@ -249,8 +321,8 @@ extern EOtheMemoryPool * eo_mempool_Initialise(const eOmempool_cfg_t *cfg)
     
     return(&s_the_mempool);
 }
- 
-    
+
+
 extern EOtheMemoryPool* eo_mempool_GetHandle(void) 
 {
     return((1==s_the_mempool.initted) ? (&s_the_mempool) : (NULL));
@@ -274,89 +346,34 @@ extern eOresult_t eo_mempool_SetMutex(EOtheMemoryPool *p, EOVmutexDerived *mutex
 
 extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number)
 {
-    void *ret = NULL;
-    uint32_t usedbytespool = 0;
-    uint32_t usedbytesheap = 0;
-    eOmempool_alloc_mode_t mode = s_the_mempool.config.mode;
-          
-    if((0 == size) || (0 == number)) 
-    {
-        // manage the ... warning 
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_zerorequested;
-        errdes.par16            = 0;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_GetMemory() is asked 0 bytes", s_eobj_ownname, &errdes);        
-        return(NULL);
-    }
-   
+    return(eo_mempool_GetMemoryTagged(p, alignmode, size, number, NULL));
+}
 
-    if(NULL == p)
-    {
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_notinitialised;
-        errdes.par16            = 0;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;    
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_info, "eo_mempool_GetMemory() not initted uses dyn alloc", s_eobj_ownname, &errdes); 
-        mode = eo_mempool_alloc_dynamic;       
-    }    
-      
-    
-    // ok, using the singleton
-        
-    switch(mode)
-    {
-        case eo_mempool_alloc_dynamic:
-        {
-            ret = s_the_mempool.theheap.allocate(number*size);
-            usedbytesheap = eo_common_msize(ret);
-        } break;
-        
-        case eo_mempool_alloc_mixed:
-        {        
-            if(0 == (p->thepool.status.poolsmask & (uint8_t)alignmode))
-                {   // dont have a pool for the alignmode: use heap
-                ret = s_the_mempool.theheap.allocate(number*size);
-                usedbytesheap = eo_common_msize(ret);             
-            }
-            else
-            {   // i have a proper pool 
-                //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
-                ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);   
-            }
 
-        } break;
-        
-        case eo_mempool_alloc_static:
-        {   // dont care if i dont have a proper pool for teh requested align mode. if not found ... error
-            //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
-            ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);
-        } break;
-    
-    }
+extern void * eo_mempool_GetMemoryTagged(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *tag)
+{
+    void *ret = s_eo_mempool_getmemory(p, alignmode, size, number);
     
-    if(NULL == ret)
-    {   // manage the fatal error in case memory could not achieved
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_missing;
-        errdes.par16            = number*size;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;         
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_GetMemory() no more memory", s_eobj_ownname, &errdes);
+    if((eobool_true == s_the_mempool.profiler.started) && (NULL != ret))
+    {
+        s_eo_mempool_profiler_track(ret, (uint32_t)number*size, tag, EOK_uint08dummy);
     }
     
-    s_the_mempool.stats.usedbytespool += usedbytespool; 
-    s_the_mempool.stats.usedbytesheap += usedbytesheap;
-    
-    return(ret);   
+    return(ret);
 }
 
-
 extern uint32_t eo_mempool_SizeOfAllocated(EOtheMemoryPool *p)
 {
-    return(s_the_mempool.stats.usedbytespool+s_the_mempool.stats.usedbytesheap);
+    uint32_t size = s_the_mempool.stats.usedbytespool+s_the_mempool.stats.usedbytesheap;
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+    uint8_t i = 0;
+    // what the calling thread has not yet added to usedbytesheap
+    for(i=0; i<eo_mempool_slab_classes_numberof; i++)
+    {
+        size += (uint32_t)s_eo_mempool_slab_caches[i].usedbytes;
+    }
+#endif
+    return(size);
 }
 
 extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p)
@@ -365,119 +382,663 @@ extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p)
 }
 
 
-extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
+extern eObool_t eo_mempool_CanRelease(EOtheMemoryPool *p)
 {
-    void *ret = s_the_mempool.theheap.allocate(size);
+    return(((eo_mempool_alloc_dynamic == s_the_mempool.config.mode) || (eo_mempool_alloc_slab == s_the_mempool.config.mode)) ? (eobool_true) : (eobool_false));
+}
 
-    if(NULL == ret)
-    {   // manage the fatal error in case memory could not be achieved
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_missing;
-        errdes.par16            = size;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0; 
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
+
+extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_slab_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);      
-
-    return(ret);   
+    if((eo_mempool_alloc_slab != s_the_mempool.config.mode) || (sizeclass >= eo_mempool_slab_classes_numberof))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+    // the other threads add what they have done at their next exchange of blocks
+    s_eo_mempool_slab_cache_flush(sizeclass, &s_eo_mempool_slab_caches[sizeclass]);
+#endif
+    memcpy(stats, &s_the_mempool.slab.classes[sizeclass].stats, sizeof(eOmempool_slab_stats_t));
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
 }
 
 
-extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
-{  
-    void *ret = NULL;
-    if(0 == size)
+extern eOmempool_arena_t * eo_mempool_Arena_New(EOtheMemoryPool *p, uint32_t capacity)
+{
+    eOmempool_arena_t *arena = NULL;
+    
+    if((NULL == p) || (0 == capacity) || (eobool_false == eo_mempool_CanRelease(p)))
     {
-        eo_mempool_Delete(p, m);
         return(NULL);
     }
     
+    capacity = (capacity + 7) & ~7;
     
-    if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
+    arena = (eOmempool_arena_t*) s_the_mempool.theheap.allocate(sizeof(eOmempool_arena_t));
+    if(NULL == arena)
     {
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_wrongusage;
-        errdes.par16            = 0;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;         
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() used when non dyn", s_eobj_ownname, &errdes);
-        
         return(NULL);
-    }            
+    }
     
-    if(NULL != m)
+    // i get memory for one more cache line so that i can align the base
+    arena->memory = (uint8_t*) s_the_mempool.theheap.allocate(capacity + EOK_MEMPOOL_arenaalignment);
+    if(NULL == arena->memory)
     {
-        s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
-    }    
+        s_the_mempool.theheap.release(arena);
+        return(NULL);
+    }
     
-    ret = s_the_mempool.theheap.reallocate(m, size);
+    // the first block given (e.g., the object which owns the arena) starts on a cache line
+    arena->base         = (uint8_t*) (((uintptr_t)arena->memory + sizeof(eOmempool_arena_blockheader_t) + EOK_MEMPOOL_arenaalignment - 1) & ~((uintptr_t)EOK_MEMPOOL_arenaalignment - 1)) - sizeof(eOmempool_arena_blockheader_t);
+    arena->capacity     = capacity;
+    arena->used         = 0;
+    arena->lastoffset   = 0;
+    arena->overflows    = 0;
     
-    if(NULL == ret)
-    {   // manage the fatal error in case memory could not be achieved
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_missing;
-        errdes.par16            = size;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;         
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
+    // the heap functions are calloc-like, but the user can change them
+    memset(arena->base, 0, capacity);
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    arena->next = s_the_mempool.arenas;
+#if defined(EO_atomic_store_release)
+    EO_atomic_store_release(&s_the_mempool.arenas, arena);
+#else
+    s_the_mempool.arenas = arena;
+#endif
+    s_the_mempool.stats.usedbytesheap += capacity;
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(arena);
+}
+
+
+extern eOresult_t eo_mempool_Arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    if((NULL == p) || (NULL == arena))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != s_eo_mempool_arena_active)
+    {
+        return(eores_NOK_generic);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);  
+    s_eo_mempool_arena_active = arena;
     
-    return(ret);   
+    return(eores_OK);
 }
 
 
-extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
+extern eOresult_t eo_mempool_Arena_Exit(EOtheMemoryPool *p)
 {
-    if(NULL == m)
+    if(NULL == p)
     {
-        return;
+        return(eores_NOK_nullpointer);
     }
     
-    if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
-    {        
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): only w/ eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
+    if(NULL == s_eo_mempool_arena_active)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    s_eo_mempool_arena_active = NULL;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_mempool_Arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats)
+{
+    if((NULL == p) || (NULL == arena) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    stats->capacity     = arena->capacity;
+    stats->used         = arena->used;
+    stats->overflows    = arena->overflows;
+    
+    return(eores_OK);
+}
+
+
+extern void eo_mempool_Arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+{
+    eOmempool_arena_t **pp = NULL;
+    
+    if((NULL == p) || (NULL == arena))
+    {
         return;
-    }        
-        
-    s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
+    }
+    
+    if(arena == s_eo_mempool_arena_active)
+    {
+        s_eo_mempool_arena_active = NULL;
+    }
+    
+    if(eobool_true == s_the_mempool.profiler.started)
+    {   // the blocks of the arena are released now
+        s_eo_mempool_profiler_untrack_range(arena->base, arena->base + arena->capacity);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    for(pp = &s_the_mempool.arenas; NULL != *pp; pp = &(*pp)->next)
+    {
+        if(arena == *pp)
+        {
+#if defined(EO_atomic_store_release)
+            EO_atomic_store_release(pp, arena->next);
+#else
+            *pp = arena->next;
+#endif
+            s_the_mempool.stats.usedbytesheap -= arena->capacity;
+            break;
+        }
+    }
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    s_the_mempool.theheap.release(arena->memory);
+    s_the_mempool.theheap.release(arena);
+}
 
-    s_the_mempool.theheap.release(m);          
+
+extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
+{
+    return(eo_mempool_NewTagged(p, size, NULL));
 }
 
 
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of extern hidden functions 
-// --------------------------------------------------------------------------------------------------------------------
-// empty-section
+extern void * eo_mempool_NewTagged(EOtheMemoryPool *p, uint32_t size, const char *tag)
+{
+    void *ret = s_eo_mempool_new(p, size);
+    
+    if((eobool_true == s_the_mempool.profiler.started) && (NULL != ret))
+    {
+        s_eo_mempool_profiler_track(ret, size, tag, EOK_uint08dummy);
+    }
+    
+    return(ret);
+}
 
 
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of static functions 
-// --------------------------------------------------------------------------------------------------------------------
+extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
+{
+    return(eo_mempool_ReallocTagged(p, m, size, NULL));
+}
 
 
-static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, uint32_t* usedbytes)
+extern void * eo_mempool_ReallocTagged(EOtheMemoryPool *p, void *m, uint32_t size, const char *tag)
 {
-    uint32_t numentries = 0;
     void *ret = NULL;
+    uint8_t tagindex = EOK_uint08dummy;
     
-    eOmempool_the_pool_t* pool = &s_the_mempool.thepool;
+    if((eobool_true == s_the_mempool.profiler.started) && (NULL != m))
+    {   // the new block keeps the tag of the old one, if it was tracked
+        tagindex = s_eo_mempool_profiler_untrack(m);
+    }
+    
+    ret = s_eo_mempool_realloc(p, m, size);
+    
+    if((eobool_true == s_the_mempool.profiler.started) && (NULL != ret))
+    {
+        s_eo_mempool_profiler_track(ret, size, tag, tagindex);
+    }
+    
+    return(ret);
+}
 
-    // attempt to lock mutex if it is null it will return nok_nullpointer, else ok or nok_timeout.
-    if(eores_NOK_timeout == eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout))
+extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
+{
+    if(NULL == m)
     {
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_mutex_timeout;
-        errdes.par16            = s_the_mempool.tout / 1000;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_get_static(): mutex_take() tout", s_eobj_ownname, &errdes);
+        return;
     }
-     
+    
+    if(eobool_true == s_the_mempool.profiler.started)
+    {
+        s_eo_mempool_profiler_untrack(m);
+    }
+    
+    if(NULL != s_eo_mempool_arena_owner(m))
+    {   // it is released by eo_mempool_Arena_Delete()
+        return;
+    }
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        s_eo_mempool_slab_release(m);
+        return;
+    }
+    
+    if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
+    {        
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): only w/ eo_mempool_alloc_dynamic or _slab", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
+        return;
+    }        
+        
+    s_eo_mempool_stats_update(0, -(int32_t)eo_common_msize(m)); 
+
+    s_the_mempool.theheap.release(m);          
+}
+
+
+extern eOresult_t eo_mempool_Profiler_Start(EOtheMemoryPool *p, uint16_t maxblocks)
+{
+    eOmempool_profiler_entry_t *tags = NULL;
+    eOmempool_profiler_block_t *blocks = NULL;
+    uint32_t slots = 1;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // the hash table is never more than half full
+    while(slots < 2*(uint32_t)maxblocks)
+    {
+        slots <<= 1;
+    }
+    
+    tags = (eOmempool_profiler_entry_t*) s_the_mempool.theheap.allocate(EOK_MEMPOOL_profilermaxtags*sizeof(eOmempool_profiler_entry_t));
+    blocks = (eOmempool_profiler_block_t*) s_the_mempool.theheap.allocate(slots*sizeof(eOmempool_profiler_block_t));
+    
+    if((NULL == tags) || (NULL == blocks))
+    {
+        s_the_mempool.theheap.release(tags);
+        s_the_mempool.theheap.release(blocks);
+        return(eores_NOK_generic);
+    }
+    
+    memset(tags, 0, EOK_MEMPOOL_profilermaxtags*sizeof(eOmempool_profiler_entry_t));
+    memset(blocks, 0, slots*sizeof(eOmempool_profiler_block_t));
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_true == s_the_mempool.profiler.started)
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        s_the_mempool.theheap.release(tags);
+        s_the_mempool.theheap.release(blocks);
+        return(eores_NOK_generic);
+    }
+    
+    s_the_mempool.profiler.tags         = tags;
+    s_the_mempool.profiler.blocks       = blocks;
+    s_the_mempool.profiler.mask         = slots - 1;
+    s_the_mempool.profiler.numberoftags = 0;
+    s_the_mempool.profiler.untracked    = 0;
+    s_the_mempool.profiler.start        = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    s_the_mempool.profiler.started      = eobool_true;
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_mempool_Profiler_Stop(EOtheMemoryPool *p)
+{
+    eOmempool_profiler_entry_t *tags = NULL;
+    eOmempool_profiler_block_t *blocks = NULL;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_false == s_the_mempool.profiler.started)
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        return(eores_NOK_generic);
+    }
+    
+    tags    = s_the_mempool.profiler.tags;
+    blocks  = s_the_mempool.profiler.blocks;
+    memset(&s_the_mempool.profiler, 0, sizeof(eOmempool_profiler_t));
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    s_the_mempool.theheap.release(tags);
+    s_the_mempool.theheap.release(blocks);
+    
+    return(eores_OK);
+}
+
+
+extern uint8_t eo_mempool_Profiler_Snapshot(EOtheMemoryPool *p, eOmempool_profiler_tag_t *tags, uint8_t capacity, eOreltime_t *duration, uint32_t *untracked)
+{
+    uint8_t i = 0;
+    
+    if((NULL == p) || (NULL == tags))
+    {
+        return(0);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_true == s_the_mempool.profiler.started)
+    {
+        for(i=0; (i<s_the_mempool.profiler.numberoftags) && (i<capacity); i++)
+        {
+            memcpy(&tags[i], &s_the_mempool.profiler.tags[i].data, sizeof(eOmempool_profiler_tag_t));
+        }
+        
+        if(NULL != duration)
+        {
+            *duration = (eOreltime_t)(eov_sys_LifeTimeGet(eov_sys_GetHandle()) - s_the_mempool.profiler.start);
+        }
+        
+        if(NULL != untracked)
+        {
+            *untracked = s_the_mempool.profiler.untracked;
+        }
+    }
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(i);
+}
+
+
+extern uint16_t eo_mempool_Profiler_Print(EOtheMemoryPool *p, char *str, uint16_t size)
+{
+    // the snapshot is big: it is better to keep it off the stack of small embedded threads 
+    eOmempool_profiler_tag_t *tags = NULL;
+    eOreltime_t duration = 0;
+    uint32_t untracked = 0;
+    uint32_t secs = 0;
+    uint8_t number = 0;
+    uint8_t i = 0;
+    int n = 0;
+    uint16_t written = 0;
+    
+    if((NULL == p) || (NULL == str) || (0 == size))
+    {
+        return(0);
+    }
+    
+    str[0] = 0;
+    
+    tags = (eOmempool_profiler_tag_t*) s_the_mempool.theheap.allocate(EOK_MEMPOOL_profilermaxtags*sizeof(eOmempool_profiler_tag_t));
+    if(NULL == tags)
+    {
+        return(0);
+    }
+    
+    number = eo_mempool_Profiler_Snapshot(p, tags, EOK_MEMPOOL_profilermaxtags, &duration, &untracked);
+    // the rates are per second, and in the first second they are the counts
+    secs = EO_MAX(duration / 1000000, 1);
+    
+    n = snprintf(str, size, "mempool profiler: %d tags, %u untracked blocks, %u sec\n", number, untracked, secs);
+    
+    for(i=0; (i<number) && (n > 0) && (written+n < size); i++)
+    {
+        written += n;
+        n = snprintf(&str[written], size-written, "%s: live %u B in %u blocks, peak %u B, %u allocs (%u/s), %u frees (%u/s)\n", 
+                     tags[i].tag, tags[i].livebytes, tags[i].liveblocks, tags[i].peakbytes, 
+                     tags[i].allocations, tags[i].allocations/secs, tags[i].releases, tags[i].releases/secs);
+    }
+    
+    if((n > 0) && (written+n < size))
+    {
+        written += n;
+    }
+    else
+    {   // the last line did not fit
+        str[written] = 0;
+    }
+    
+    s_the_mempool.theheap.release(tags);
+    
+    return(written);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static void * s_eo_mempool_getmemory(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number)
+{
+    void *ret = NULL;
+    uint32_t usedbytespool = 0;
+    uint32_t usedbytesheap = 0;
+    eOmempool_alloc_mode_t mode = s_the_mempool.config.mode;
+          
+    if((0 == size) || (0 == number)) 
+    {
+        // manage the ... warning 
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_zerorequested;
+        errdes.par16            = 0;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_GetMemory() is asked 0 bytes", s_eobj_ownname, &errdes);        
+        return(NULL);
+    }
+   
+
+    if(NULL == p)
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_notinitialised;
+        errdes.par16            = 0;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;    
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_info, "eo_mempool_GetMemory() not initted uses dyn alloc", s_eobj_ownname, &errdes); 
+        mode = eo_mempool_alloc_dynamic;       
+    }    
+      
+    
+    // ok, using the singleton
+    
+    if(NULL != s_eo_mempool_arena_active)
+    {
+        ret = s_eo_mempool_arena_get((uint32_t)number*size);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
+        
+    switch(mode)
+    {
+        case eo_mempool_alloc_dynamic:
+        {
+            ret = s_the_mempool.theheap.allocate(number*size);
+            usedbytesheap = eo_common_msize(ret);
+        } break;
+        
+        case eo_mempool_alloc_mixed:
+        {        
+            if(0 == (p->thepool.status.poolsmask & (uint8_t)alignmode))
+                {   // dont have a pool for the alignmode: use heap
+                ret = s_the_mempool.theheap.allocate(number*size);
+                usedbytesheap = eo_common_msize(ret);             
+            }
+            else
+            {   // i have a proper pool 
+                //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
+                ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);   
+            }
+
+        } break;
+        
+        case eo_mempool_alloc_slab:
+        {
+            ret = s_eo_mempool_slab_get((uint32_t)number*size);
+        } break;
+        
+        case eo_mempool_alloc_static:
+        {   // dont care if i dont have a proper pool for teh requested align mode. if not found ... error
+            //size = s_align_size(alignmode, size);  // alignment is internal to s_eo_mempool_get_static()
+            ret = s_eo_mempool_get_static(alignmode, size, number, &usedbytespool);
+        } break;
+    
+    }
+    
+    if(NULL == ret)
+    {   // manage the fatal error in case memory could not achieved
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_missing;
+        errdes.par16            = number*size;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;         
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_GetMemory() no more memory", s_eobj_ownname, &errdes);
+    }
+    
+    s_eo_mempool_stats_update(usedbytespool, usedbytesheap);
+    
+    return(ret);   
+}
+
+
+static void * s_eo_mempool_new(EOtheMemoryPool *p, uint32_t size)
+{
+    void *ret = NULL;
+    
+    if(NULL != s_eo_mempool_arena_active)
+    {
+        ret = s_eo_mempool_arena_get(size);
+        if(NULL != ret)
+        {
+            return(ret);
+        }
+    }
+    
+    ret = (eo_mempool_alloc_slab == s_the_mempool.config.mode) ? s_eo_mempool_slab_get(size) : s_the_mempool.theheap.allocate(size);
+
+    if(NULL == ret)
+    {   // manage the fatal error in case memory could not be achieved
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_missing;
+        errdes.par16            = size;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0; 
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
+    }
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {   // the slab keeps its own statistics
+        return(ret);
+    }
+    
+    s_eo_mempool_stats_update(0, eo_common_msize(ret));      
+
+    return(ret);   
+}
+
+
+static void * s_eo_mempool_realloc(EOtheMemoryPool *p, void *m, uint32_t size)
+{  
+    void *ret = NULL;
+    eOmempool_arena_t *arena = NULL;
+    if(0 == size)
+    {
+        eo_mempool_Delete(p, m);
+        return(NULL);
+    }
+    
+    if((NULL != m) && (NULL != (arena = s_eo_mempool_arena_owner(m))))
+    {   // the memory of an arena is never released: i grow it in place if it is the last block, otherwise i move it
+        ret = s_eo_mempool_arena_realloc(arena, m, size);
+        if(NULL == ret)
+        {
+            ret = s_eo_mempool_new(p, size);
+            memcpy(ret, m, EO_MIN(size, (((eOmempool_arena_blockheader_t*)m) - 1)->size));
+        }
+        return(ret);
+    }
+    
+    
+    if(eo_mempool_alloc_slab == s_the_mempool.config.mode)
+    {
+        ret = s_eo_mempool_slab_realloc(m, size);
+        if(NULL == ret)
+        {
+            eOerrmanDescriptor_t errdes = {0};
+            errdes.code             = eo_errman_code_sys_memory_missing;
+            errdes.par16            = size;
+            errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+            errdes.sourceaddress    = 0;         
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
+        }
+        return(ret);
+    }
+    
+    if(eo_mempool_alloc_dynamic != s_the_mempool.config.mode)
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_wrongusage;
+        errdes.par16            = 0;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;         
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() used when non dyn", s_eobj_ownname, &errdes);
+        
+        return(NULL);
+    }            
+    
+    if(NULL != m)
+    {
+        s_eo_mempool_stats_update(0, -(int32_t)eo_common_msize(m)); 
+    }    
+    
+    ret = s_the_mempool.theheap.reallocate(m, size);
+    
+    if(NULL == ret)
+    {   // manage the fatal error in case memory could not be achieved
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_missing;
+        errdes.par16            = size;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;         
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
+    }
+    
+    s_eo_mempool_stats_update(0, eo_common_msize(ret));  
+    
+    return(ret);   
+}
+
+
+
+static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, uint32_t* usedbytes)
+{
+    uint32_t numentries = 0;
+    void *ret = NULL;
+    
+    eOmempool_the_pool_t* pool = &s_the_mempool.thepool;
+
+    // attempt to lock mutex if it is null it will return nok_nullpointer, else ok or nok_timeout.
+    if(eores_NOK_timeout == eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout))
+    {
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_mutex_timeout;
+        errdes.par16            = s_the_mempool.tout / 1000;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_get_static(): mutex_take() tout", s_eobj_ownname, &errdes);
+    }
+     
     
     switch(alignmode) 
     {    
@@ -495,77 +1056,669 @@ static void * s_eo_mempool_get_static(eOmempool_alignment_t alignmode, uint16_t
 
         case eo_mempool_align_16bit:
         {
-            numentries = number * ((size+1)/2);
-            if((uint32_t)(pool->status.uint16index + numentries) <= (pool->config.size16/2)) 
-            {
-                ret = (void*) &pool->config.data16[pool->status.uint16index];
-                pool->status.uint16index += numentries;
-                *usedbytes = numentries*2;
-            }            
+            numentries = number * ((size+1)/2);
+            if((uint32_t)(pool->status.uint16index + numentries) <= (pool->config.size16/2)) 
+            {
+                ret = (void*) &pool->config.data16[pool->status.uint16index];
+                pool->status.uint16index += numentries;
+                *usedbytes = numentries*2;
+            }            
+
+        } break;
+        
+        case eo_mempool_align_32bit:
+        {
+            numentries = number * ((size+3)/4);
+            if((uint32_t)(pool->status.uint32index + numentries) <= (pool->config.size32/4)) 
+            {
+                ret = (void*) &pool->config.data32[pool->status.uint32index];
+                pool->status.uint32index += numentries;
+                *usedbytes = numentries*4;
+            }   
+        } break;
+
+        case eo_mempool_align_auto:
+        case eo_mempool_align_64bit:
+        {
+            numentries = number * ((size+7)/8);
+            if((uint32_t)(pool->status.uint64index + numentries) <= (pool->config.size64/8)) 
+            {
+                ret = (void*) &pool->config.data64[pool->status.uint64index];
+                pool->status.uint64index += numentries;
+                *usedbytes = numentries*8;
+            }  
+        } break;
+       
+        default:
+        {
+            ret = NULL;
+        } break;    
+        
+    }
+    
+    // unlock mutex. it is safe even if mutex is null.
+    eov_mutex_Release(s_the_mempool.mutex);
+        
+    if(NULL == ret) 
+    {   // manage error
+        eOerrmanDescriptor_t errdes = {0};
+        errdes.code             = eo_errman_code_sys_memory_missing;
+        errdes.par16            = size*number;
+        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
+        errdes.sourceaddress    = 0;
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_get_static(): no more mem", s_eobj_ownname, &errdes);
+    }
+    
+    return(ret);
+}
+
+static void * s_memallocator(uint32_t s)
+{
+    return(calloc(s, 1));
+}
+
+
+static void s_memfree(void *p)
+{
+    free(p);
+}
+
+
+static void * s_memrealloc(void *p, uint32_t s)
+{
+    return(realloc(p, s));
+}
+
+
+static void s_eo_mempool_stats_update(int32_t deltapool, int32_t deltaheap)
+{
+    if((0 == deltapool) && (0 == deltaheap))
+    {
+        return;
+    }
+    
+    // the heap may be used by several threads at the same time (e.g., by eo_hosttransceiver_NewArray()), hence 
+    // we protect the counters with the mutex, if any.
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    s_the_mempool.stats.usedbytespool += deltapool;
+    s_the_mempool.stats.usedbytesheap += deltaheap;
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static void * s_eo_mempool_slab_get(uint32_t size)
+{
+    eOmempool_slab_blockheader_t *block = NULL;
+#if !defined(EO_MEMPOOL_SLAB_USE_CACHES)
+    eOmempool_slab_class_t *theclass = NULL;
+#endif
+    uint8_t sizeclass = 0;
+    
+    // the classes are few, thus a linear search is as fast as anything else
+    for(sizeclass=0; sizeclass<eo_mempool_slab_classes_numberof; sizeclass++)
+    {
+        if(size <= s_eo_mempool_slab_blocksizes[sizeclass])
+        {
+            break;
+        }
+    }
+    
+    if(eo_mempool_slab_classes_numberof == sizeclass)
+    {   // too big for the slabs: use the heap
+        block = (eOmempool_slab_blockheader_t*) s_the_mempool.theheap.allocate(sizeof(eOmempool_slab_blockheader_t) + size);
+        if(NULL == block)
+        {
+            return(NULL);
+        }
+        block->sizeclass = EOK_uint08dummy;
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        s_the_mempool.stats.usedbytesheap += size;
+        eov_mutex_Release(s_the_mempool.mutex);
+    }
+    else
+    {
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+        eOmempool_slab_cache_t *cache = &s_eo_mempool_slab_caches[sizeclass];
+        
+        // no lock unless the thread has no more free blocks of the class
+        if((NULL == cache->freelist) && (eobool_false == s_eo_mempool_slab_cache_fill(sizeclass, cache)))
+        {
+            return(NULL);
+        }
+        
+        block = cache->freelist;
+        cache->freelist = *((eOmempool_slab_blockheader_t**)(block+1));
+        cache->count --;
+        cache->allocations ++;
+        cache->usedbytes += (int32_t)size;
+#else
+        theclass = &s_the_mempool.slab.classes[sizeclass];
+        
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        
+        if((NULL == theclass->freelist) && (eobool_false == s_eo_mempool_slab_refill(sizeclass)))
+        {
+            eov_mutex_Release(s_the_mempool.mutex);
+            return(NULL);
+        }
+        
+        block = theclass->freelist;
+        theclass->freelist = *((eOmempool_slab_blockheader_t**)(block+1));
+        
+        theclass->stats.inuse ++;
+        theclass->stats.allocations ++;
+        if(theclass->stats.inuse > theclass->stats.peak)
+        {
+            theclass->stats.peak = theclass->stats.inuse;
+        }
+        s_the_mempool.stats.usedbytesheap += size;
+        
+        eov_mutex_Release(s_the_mempool.mutex);
+#endif
+        
+        block->sizeclass = sizeclass;
+    }
+    
+    block->size     = size;
+    block->magic    = EO_MEMPOOL_SLAB_magic;
+    block->dummy    = 0;
+    
+    // the users of the mempool expect zeroed memory, as calloc() gives
+    memset(block+1, 0, size);
+    
+    return(block+1);
+}
 
-        } break;
+
+static void s_eo_mempool_slab_release(void *m)
+{
+    eOmempool_slab_blockheader_t *block = ((eOmempool_slab_blockheader_t*)m) - 1;
+#if !defined(EO_MEMPOOL_SLAB_USE_CACHES)
+    eOmempool_slab_class_t *theclass = NULL;
+#endif
+    
+    if(EO_MEMPOOL_SLAB_magic != block->magic)
+    {   // not given by the slab or already released
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eo_mempool_Delete(): wrong pointer", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);       
+        return;
+    }
+    
+    block->magic = 0;
+    
+    if(EOK_uint08dummy == block->sizeclass)
+    {
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        s_the_mempool.stats.usedbytesheap -= block->size;
+        eov_mutex_Release(s_the_mempool.mutex);
+        s_the_mempool.theheap.release(block);
+        return;
+    }
+    
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+    {
+        eOmempool_slab_cache_t *cache = &s_eo_mempool_slab_caches[block->sizeclass];
+        uint32_t maxcount = EO_MAX(EO_MEMPOOL_SLAB_cachedbytes / s_eo_mempool_slab_blocksizes[block->sizeclass], EO_MEMPOOL_SLAB_mincachedblocks);
         
-        case eo_mempool_align_32bit:
+        // the block goes to the running thread, also if it was taken by another one
+        *((eOmempool_slab_blockheader_t**)(block+1)) = cache->freelist;
+        cache->freelist = block;
+        cache->count ++;
+        cache->releases ++;
+        cache->usedbytes -= (int32_t)block->size;
+        
+        if(cache->count > maxcount)
         {
-            numentries = number * ((size+3)/4);
-            if((uint32_t)(pool->status.uint32index + numentries) <= (pool->config.size32/4)) 
-            {
-                ret = (void*) &pool->config.data32[pool->status.uint32index];
-                pool->status.uint32index += numentries;
-                *usedbytes = numentries*4;
-            }   
-        } break;
+            s_eo_mempool_slab_cache_drain(block->sizeclass, cache, maxcount / 2);
+        }
+    }
+#else
+    theclass = &s_the_mempool.slab.classes[block->sizeclass];
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    *((eOmempool_slab_blockheader_t**)(block+1)) = theclass->freelist;
+    theclass->freelist = block;
+    theclass->stats.inuse --;
+    theclass->stats.releases ++;
+    s_the_mempool.stats.usedbytesheap -= block->size;
+    eov_mutex_Release(s_the_mempool.mutex);
+#endif
+}
 
-        case eo_mempool_align_auto:
-        case eo_mempool_align_64bit:
-        {
-            numentries = number * ((size+7)/8);
-            if((uint32_t)(pool->status.uint64index + numentries) <= (pool->config.size64/8)) 
-            {
-                ret = (void*) &pool->config.data64[pool->status.uint64index];
-                pool->status.uint64index += numentries;
-                *usedbytes = numentries*8;
-            }  
-        } break;
-       
-        default:
+
+static void * s_eo_mempool_slab_realloc(void *m, uint32_t size)
+{
+    eOmempool_slab_blockheader_t *block = NULL;
+    void *ret = NULL;
+    
+    if(NULL == m)
+    {
+        return(s_eo_mempool_slab_get(size));
+    }
+    
+    block = ((eOmempool_slab_blockheader_t*)m) - 1;
+    
+    if((EOK_uint08dummy != block->sizeclass) && (size <= s_eo_mempool_slab_blocksizes[block->sizeclass]))
+    {   // the block is big enough: nothing to move
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+        s_eo_mempool_slab_caches[block->sizeclass].usedbytes += (int32_t)size - (int32_t)block->size;
+#else
+        eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+        s_the_mempool.stats.usedbytesheap += size;
+        s_the_mempool.stats.usedbytesheap -= block->size;
+        eov_mutex_Release(s_the_mempool.mutex);
+#endif
+        block->size = size;
+        return(m);
+    }
+    
+    ret = s_eo_mempool_slab_get(size);
+    if(NULL != ret)
+    {
+        memcpy(ret, m, EO_MIN(block->size, size));
+        s_eo_mempool_slab_release(m);
+    }
+    
+    return(ret);
+}
+
+
+static eObool_t s_eo_mempool_slab_refill(uint8_t sizeclass)
+{   // the caller holds the mutex
+    eOmempool_slab_class_t *theclass = &s_the_mempool.slab.classes[sizeclass];
+    uint32_t blocksize = sizeof(eOmempool_slab_blockheader_t) + s_eo_mempool_slab_blocksizes[sizeclass];
+    uint32_t nblocks = EO_MAX(EO_MEMPOOL_SLAB_bytesperslab / blocksize, EO_MEMPOOL_SLAB_minblocksperslab);
+    uint8_t *slab = (uint8_t*) s_the_mempool.theheap.allocate(nblocks * blocksize);
+    uint32_t i = 0;
+    
+    if(NULL == slab)
+    {
+        return(eobool_false);
+    }
+    
+    // the slabs are never given back to the heap: their blocks stay in the free list of the class
+    for(i=0; i<nblocks; i++)
+    {
+        eOmempool_slab_blockheader_t *block = (eOmempool_slab_blockheader_t*)(slab + i*blocksize);
+        block->magic = 0;
+        *((eOmempool_slab_blockheader_t**)(block+1)) = theclass->freelist;
+        theclass->freelist = block;
+    }
+    
+    theclass->stats.slabs ++;
+    theclass->stats.blocks += nblocks;
+    
+    return(eobool_true);
+}
+
+
+#if defined(EO_MEMPOOL_SLAB_USE_CACHES)
+
+// the threads exchange blocks with the free list of the class in batches of half their cache, under the mutex
+
+static eObool_t s_eo_mempool_slab_cache_fill(uint8_t sizeclass, eOmempool_slab_cache_t *cache)
+{
+    eOmempool_slab_class_t *theclass = &s_the_mempool.slab.classes[sizeclass];
+    uint32_t number = EO_MAX(EO_MEMPOOL_SLAB_cachedbytes / s_eo_mempool_slab_blocksizes[sizeclass], EO_MEMPOOL_SLAB_mincachedblocks) / 2;
+    eOmempool_slab_blockheader_t *block = NULL;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    s_eo_mempool_slab_cache_flush(sizeclass, cache);
+    
+    for(; number>0; number--)
+    {
+        if((NULL == theclass->freelist) && (eobool_false == s_eo_mempool_slab_refill(sizeclass)))
         {
-            ret = NULL;
-        } break;    
+            break;
+        }
         
+        block = theclass->freelist;
+        theclass->freelist = *((eOmempool_slab_blockheader_t**)(block+1));
+        *((eOmempool_slab_blockheader_t**)(block+1)) = cache->freelist;
+        cache->freelist = block;
+        cache->count ++;
     }
     
-    // unlock mutex. it is safe even if mutex is null.
     eov_mutex_Release(s_the_mempool.mutex);
-        
-    if(NULL == ret) 
-    {   // manage error
-        eOerrmanDescriptor_t errdes = {0};
-        errdes.code             = eo_errman_code_sys_memory_missing;
-        errdes.par16            = size*number;
-        errdes.sourcedevice     = eo_errman_sourcedevice_localboard;
-        errdes.sourceaddress    = 0;
-        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "s_eo_mempool_get_static(): no more mem", s_eobj_ownname, &errdes);
+    
+    return((NULL != cache->freelist) ? (eobool_true) : (eobool_false));
+}
+
+
+static void s_eo_mempool_slab_cache_drain(uint8_t sizeclass, eOmempool_slab_cache_t *cache, uint32_t number)
+{
+    eOmempool_slab_class_t *theclass = &s_the_mempool.slab.classes[sizeclass];
+    eOmempool_slab_blockheader_t *block = NULL;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    s_eo_mempool_slab_cache_flush(sizeclass, cache);
+    
+    for(; (number>0) && (NULL != cache->freelist); number--)
+    {
+        block = cache->freelist;
+        cache->freelist = *((eOmempool_slab_blockheader_t**)(block+1));
+        cache->count --;
+        *((eOmempool_slab_blockheader_t**)(block+1)) = theclass->freelist;
+        theclass->freelist = block;
     }
     
-    return(ret);
+    eov_mutex_Release(s_the_mempool.mutex);
 }
 
-static void * s_memallocator(uint32_t s)
+
+static void s_eo_mempool_slab_cache_flush(uint8_t sizeclass, eOmempool_slab_cache_t *cache)
+{   // the caller holds the mutex
+    eOmempool_slab_stats_t *stats = &s_the_mempool.slab.classes[sizeclass].stats;
+    
+    stats->allocations += cache->allocations;
+    stats->releases += cache->releases;
+    // a thread may have released blocks taken by another thread which has not flushed yet
+    stats->inuse = (stats->allocations > stats->releases) ? (stats->allocations - stats->releases) : (0);
+    if(stats->inuse > stats->peak)
+    {
+        stats->peak = stats->inuse;
+    }
+    s_the_mempool.stats.usedbytesheap += cache->usedbytes;
+    
+    cache->allocations = 0;
+    cache->releases = 0;
+    cache->usedbytes = 0;
+}
+
+#endif
+
+
+static void * s_eo_mempool_arena_get(uint32_t size)
 {
-    return(calloc(s, 1));
+    eOmempool_arena_t *arena = s_eo_mempool_arena_active;
+    eOmempool_arena_blockheader_t *block = NULL;
+    uint32_t required = sizeof(eOmempool_arena_blockheader_t) + ((size + 7) & ~7);
+    
+    if(required > (arena->capacity - arena->used))
+    {   // the caller uses the usual allocator
+        arena->overflows ++;
+        return(NULL);
+    }
+    
+    block = (eOmempool_arena_blockheader_t*) (arena->base + arena->used);
+    block->size = size;
+    arena->lastoffset = arena->used;
+    arena->used += required;
+    
+    return(block+1);
 }
 
 
-static void s_memfree(void *p)
+static eOmempool_arena_t * s_eo_mempool_arena_owner(void *m)
 {
-    free(p);
+    eOmempool_arena_t *arena = NULL;
+    
+    // every eo_mempool_Delete() comes here, thus we dont take the mutex if there are no arenas at all. a pointer
+    // given by an arena was obtained after the arena was added to the list, hence it cannot be missed in here
+#if defined(EO_atomic_load_acquire)
+    if(NULL == EO_atomic_load_acquire(&s_the_mempool.arenas))
+#else
+    if(NULL == s_the_mempool.arenas)
+#endif
+    {
+        return(NULL);
+    }
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    for(arena = s_the_mempool.arenas; NULL != arena; arena = arena->next)
+    {
+        if(((uint8_t*)m >= arena->base) && ((uint8_t*)m < (arena->base + arena->capacity)))
+        {
+            break;
+        }
+    }
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(arena);
 }
 
 
-static void * s_memrealloc(void *p, uint32_t s)
+static void * s_eo_mempool_arena_realloc(eOmempool_arena_t *arena, void *m, uint32_t size)
 {
-    return(realloc(p, s));
+    eOmempool_arena_blockheader_t *block = ((eOmempool_arena_blockheader_t*)m) - 1;
+    uint32_t offset = (uint32_t)((uint8_t*)block - arena->base);
+    uint32_t required = sizeof(eOmempool_arena_blockheader_t) + ((size + 7) & ~7);
+    
+    if(size <= block->size)
+    {
+        block->size = size;
+        return(m);
+    }
+    
+    if((offset == arena->lastoffset) && (required <= (arena->capacity - offset)))
+    {   // the last block can grow until the end of the arena
+        memset((uint8_t*)m + block->size, 0, size - block->size);
+        block->size = size;
+        arena->used = offset + required;
+        return(m);
+    }
+    
+    return(NULL);
+}
+
+
+static void s_eo_mempool_profiler_track(void *m, uint32_t size, const char *tag, uint8_t tagindex)
+{
+    eOmempool_profiler_t *prof = &s_the_mempool.profiler;
+    eOmempool_profiler_tag_t *data = NULL;
+    uint32_t slot = 0;
+    uint8_t sizeclass = 0;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_false == prof->started)
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        return;
+    }
+    
+    if((EOK_uint08dummy == tagindex) || (NULL != tag))
+    {
+        tagindex = s_eo_mempool_profiler_tag_get((NULL == tag) ? (s_eo_mempool_profiler_unknown) : (tag));
+    }
+    
+    // the position of m in the table, with linear probing
+    slot = (uint32_t)(((uintptr_t)m >> 3) * 2654435761u) & prof->mask;
+    while((NULL != prof->blocks[slot].ptr) && (m != prof->blocks[slot].ptr))
+    {
+        slot = (slot + 1) & prof->mask;
+    }
+    
+    if((EOK_uint08dummy == tagindex) || ((NULL == prof->blocks[slot].ptr) && (prof->tracked >= (prof->mask+1)/2)))
+    {   // no room for the tag or for the block
+        prof->untracked ++;
+        eov_mutex_Release(s_the_mempool.mutex);
+        return;
+    }
+    
+    if(NULL != prof->blocks[slot].ptr)
+    {   // m was given again without being released through the mempool (e.g., memory of a deleted arena)
+        prof->tags[prof->blocks[slot].tag].data.livebytes -= prof->blocks[slot].size;
+        prof->tags[prof->blocks[slot].tag].data.liveblocks --;
+        prof->tracked --;
+    }
+    
+    prof->blocks[slot].ptr  = m;
+    prof->blocks[slot].size = size;
+    prof->blocks[slot].tag  = tagindex;
+    prof->tracked ++;
+    
+    for(sizeclass=0; sizeclass<eo_mempool_slab_classes_numberof; sizeclass++)
+    {
+        if(size <= s_eo_mempool_slab_blocksizes[sizeclass])
+        {
+            break;
+        }
+    }
+    
+    data = &prof->tags[tagindex].data;
+    data->livebytes += size;
+    data->liveblocks ++;
+    data->allocations ++;
+    data->sizeclasses[sizeclass] ++;
+    if(data->livebytes > data->peakbytes)
+    {
+        data->peakbytes = data->livebytes;
+    }
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static uint8_t s_eo_mempool_profiler_untrack(void *m)
+{
+    eOmempool_profiler_t *prof = &s_the_mempool.profiler;
+    uint32_t slot = 0;
+    uint8_t tagindex = EOK_uint08dummy;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_false == prof->started)
+    {
+        eov_mutex_Release(s_the_mempool.mutex);
+        return(EOK_uint08dummy);
+    }
+    
+    slot = (uint32_t)(((uintptr_t)m >> 3) * 2654435761u) & prof->mask;
+    while((NULL != prof->blocks[slot].ptr) && (m != prof->blocks[slot].ptr))
+    {
+        slot = (slot + 1) & prof->mask;
+    }
+    
+    if(NULL == prof->blocks[slot].ptr)
+    {   // given before the start or not tracked
+        eov_mutex_Release(s_the_mempool.mutex);
+        return(EOK_uint08dummy);
+    }
+    
+    tagindex = prof->blocks[slot].tag;
+    s_eo_mempool_profiler_remove(slot);
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+    
+    return(tagindex);
+}
+
+
+static void s_eo_mempool_profiler_untrack_range(uint8_t *from, uint8_t *to)
+{
+    eOmempool_profiler_t *prof = &s_the_mempool.profiler;
+    uint32_t slot = 0;
+    
+    eov_mutex_Take(s_the_mempool.mutex, s_the_mempool.tout);
+    
+    if(eobool_true == prof->started)
+    {
+        while(slot <= prof->mask)
+        {
+            if(((uint8_t*)prof->blocks[slot].ptr >= from) && ((uint8_t*)prof->blocks[slot].ptr < to))
+            {   // another block may be moved in the slot, hence i check it again
+                s_eo_mempool_profiler_remove(slot);
+            }
+            else
+            {
+                slot ++;
+            }
+        }
+    }
+    
+    eov_mutex_Release(s_the_mempool.mutex);
+}
+
+
+static void s_eo_mempool_profiler_remove(uint32_t slot)
+{   // the caller holds the mutex
+    eOmempool_profiler_t *prof = &s_the_mempool.profiler;
+    eOmempool_profiler_tag_t *data = &prof->tags[prof->blocks[slot].tag].data;
+    uint32_t next = slot;
+    uint32_t home = 0;
+    
+    data->livebytes -= prof->blocks[slot].size;
+    data->liveblocks --;
+    data->releases ++;
+    prof->tracked --;
+    
+    // i move back the following blocks which would not be found anymore, so that the table needs no tombstones
+    for(;;)
+    {
+        prof->blocks[slot].ptr = NULL;
+        for(;;)
+        {
+            next = (next + 1) & prof->mask;
+            if(NULL == prof->blocks[next].ptr)
+            {
+                return;
+            }
+            home = (uint32_t)(((uintptr_t)prof->blocks[next].ptr >> 3) * 2654435761u) & prof->mask;
+            // the block in next can stay only if its home is cyclically inside (slot, next]
+            if((slot <= next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next)))
+            {
+                continue;
+            }
+            break;
+        }
+        prof->blocks[slot] = prof->blocks[next];
+        slot = next;
+    }
+}
+
+
+static uint8_t s_eo_mempool_profiler_tag_get(const char *tag)
+{   // the caller holds the mutex
+    eOmempool_profiler_t *prof = &s_the_mempool.profiler;
+    char name[EOK_MEMPOOL_profilertagsize] = {0};
+    const char *start = tag;
+    const char *c = NULL;
+    uint8_t len = 0;
+    uint8_t i = 0;
+    
+    // the same string literal is almost always passed by the same caller
+    for(i=0; i<prof->numberoftags; i++)
+    {
+        if(tag == prof->tags[i].key)
+        {
+            return(i);
+        }
+    }
+    
+    // i keep only the name of the file without path and extension
+    for(c=tag; 0 != *c; c++)
+    {
+        if(('/' == *c) || ('\\' == *c))
+        {
+            start = c+1;
+        }
+    }
+    for(c=start; (0 != *c) && ('.' != *c) && (len < EOK_MEMPOOL_profilertagsize-1); c++)
+    {
+        name[len++] = *c;
+    }
+    
+    // another pointer to the same name (e.g., __FILE__ in a header or in another translation unit)
+    for(i=0; i<prof->numberoftags; i++)
+    {
+        if(0 == strcmp(name, prof->tags[i].data.tag))
+        {
+            return(i);
+        }
+    }
+    
+    if(prof->numberoftags >= EOK_MEMPOOL_profilermaxtags)
+    {
+        return(EOK_uint08dummy);
+    }
+    
+    i = prof->numberoftags++;
+    prof->tags[i].key = tag;
+    memcpy(prof->tags[i].data.tag, name, sizeof(name));
+    
+    return(i);
 }
 
 //static size_t s_eo_mempool_heap_sizeof_allocated_pointer(void* p)
@@ -41,6 +41,30 @@ extern "C" {
     If initialised to work in static mode, the user must pass to the singleton some memory pools where to get memory. If it is
     defined the mixed mode, the singleton shall get memory from the heap if the pool is not defined.
     In static and mixed mode it is possible to allocate memory but not to reallocate and release it.
+    In slab mode the memory is taken from the heap in slabs which are split into blocks of a few size classes 
+    (from 16 to 2048 bytes). The released blocks are kept in a free list of their class and reused in O(1) time,
+    hence repeated creation and deletion of objects does not fragment the heap. Bigger requests go to the heap.
+    On the hosts every thread also keeps up to 2 KiB of free blocks of each class in thread local storage, and it
+    allocates and releases them without any lock. Only when its blocks of a class run out, or exceed that limit, the
+    thread exchanges half of them with the free list of the class under the mutex of eo_mempool_SetMutex(), which
+    thus must be given as soon as more than one thread uses the singleton. The statistics of a class are updated at
+    these exchanges, and what a thread which ends has not exchanged yet is lost: its blocks are not reused and its
+    allocations and releases are not counted. The boards have no thread local
+    storage, thus every allocation and release takes the mutex.
+    In dynamic and slab mode an object made of many sub-objects (e.g., the EOtransceiver) can also get all its memory
+    from an arena: a single block of heap aligned to a cache line, whose memory is given in sequence to every request
+    done by the same thread between eo_mempool_Arena_Enter() and eo_mempool_Arena_Exit(). eo_mempool_Delete() ignores
+    the pointers inside a live arena, and everything is released at once by eo_mempool_Arena_Delete().
+    The arena entered by a thread is kept in a variable declared with EO_threadlocal. The macro is empty on the board
+    compilers (__arm__ and dspic), whose rtos has no thread local storage: there the arena is global to the process,
+    and while a task is between eo_mempool_Arena_Enter() and eo_mempool_Arena_Exit() also the requests of every other
+    task go to the arena. On the boards an arena must be used only when a single task allocates (e.g., at startup).
+    
+    The singleton also has a profiler, started with eo_mempool_Profiler_Start(), which keeps for each module the 
+    memory it holds now and at most, the number of its allocations and releases and how big they are. If the code 
+    is compiled with the macro EO_MEMPOOL_PROFILER, every call of eo_mempool_GetMemory(), eo_mempool_New() and 
+    eo_mempool_Realloc() passes its file, hence the module is named after it (e.g., "EOtransmitter"), as the 
+    s_eobj_ownname of the object. Otherwise the memory is assigned to the tag "unknown".
         
     It is responsibility of the object EOVtheSystem (via its derived object) to initialise the EOtheMemoryPool. 
 
@@ -59,7 +83,11 @@ extern "C" {
 
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EOK_MEMPOOL_arenaalignment       64      // the size of a cache line
+
+#define EOK_MEMPOOL_profilermaxtags      48
+#define EOK_MEMPOOL_profilertagsize      24
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -80,9 +108,62 @@ typedef enum
 {
     eo_mempool_alloc_dynamic    = 0,
     eo_mempool_alloc_static     = 1,
-    eo_mempool_alloc_mixed      = 2
+    eo_mempool_alloc_mixed      = 2,
+    eo_mempool_alloc_slab       = 3
 } eOmempool_alloc_mode_t;
 
+
+enum { eo_mempool_slab_classes_numberof = 8 };
+
+
+/**	@typedef    typedef struct eOmempool_slab_stats_t 
+ 	@brief      Contains the statistics of a size class in eo_mempool_alloc_slab mode. 
+ **/ 
+typedef struct
+{
+    uint32_t                    blocksize;      /**< the max number of bytes given by a block of the class */
+    uint32_t                    slabs;          /**< the number of slabs taken from the heap */
+    uint32_t                    blocks;         /**< the number of blocks inside the slabs */
+    uint32_t                    inuse;          /**< the number of blocks now in use */
+    uint32_t                    peak;           /**< the max number of blocks in use at the same time */
+    uint32_t                    allocations;    /**< the number of allocations since the start */
+    uint32_t                    releases;       /**< the number of releases since the start */
+} eOmempool_slab_stats_t;
+
+
+/**	@typedef    typedef struct eOmempool_arena_hid eOmempool_arena_t 
+ 	@brief      eOmempool_arena_t is an opaque struct which describes an arena. 
+ **/ 
+typedef struct eOmempool_arena_hid eOmempool_arena_t;
+
+
+/**	@typedef    typedef struct eOmempool_arena_stats_t 
+ 	@brief      Contains the usage of an arena. 
+ **/ 
+typedef struct
+{
+    uint32_t                    capacity;       /**< the bytes of the arena */
+    uint32_t                    used;           /**< the bytes given so far, headers included */
+    uint32_t                    overflows;      /**< the requests which did not fit and were served outside the arena */
+} eOmempool_arena_stats_t;
+
+
+enum { eo_mempool_profiler_sizeclasses_numberof = eo_mempool_slab_classes_numberof+1 };
+
+/**	@typedef    typedef struct eOmempool_profiler_tag_t 
+ 	@brief      Contains what the profiler knows about the memory of a module. 
+ **/ 
+typedef struct
+{
+    char                        tag[EOK_MEMPOOL_profilertagsize];   /**< the name of the module, e.g. "EOtransmitter" */
+    uint32_t                    livebytes;      /**< the bytes held now */
+    uint32_t                    liveblocks;     /**< the blocks held now */
+    uint32_t                    peakbytes;      /**< the max bytes held at the same time */
+    uint32_t                    allocations;    /**< the number of allocations since the start of the profiler */
+    uint32_t                    releases;       /**< the number of releases since the start of the profiler */
+    uint32_t                    sizeclasses[eo_mempool_profiler_sizeclasses_numberof];  /**< the allocations up to 16, 32, ..., 2048 bytes and bigger */
+} eOmempool_profiler_tag_t;
+
 typedef struct 
 {
     eOvoidp_fp_uint32_t         allocate;
@@ -156,6 +237,8 @@ extern const eOmempool_cfg_t eom_mempool_DefaultCfg; // = {eo_mempool_alloc_dyna
                                 pointer or zero size.
                                 In case of eo_mempool_alloc_dynamic the memory is assigned
                                 only from the heap. 
+                                In case of eo_mempool_alloc_slab the memory is assigned from size-class slabs which
+                                are taken from the heap. If cfg->conf is not NULL, its heap functions are used.
                                 A NULL value for cfg is a shortcut for the mode eo_mempool_alloc_dynamic.
     @return     Pointer to the required EOtheMemoryPool singleton (or NULL upon un-initialised singleton).
  **/
@@ -216,6 +299,68 @@ extern uint32_t eo_mempool_SizeOfAllocated(EOtheMemoryPool *p);
 
 extern eOmempool_alloc_mode_t eo_mempool_alloc_mode_Get(EOtheMemoryPool *p);
 
+// it tells if the memory can be reallocated and released, i.e., if the mode is eo_mempool_alloc_dynamic or eo_mempool_alloc_slab
+extern eObool_t eo_mempool_CanRelease(EOtheMemoryPool *p);
+
+
+/** @fn         extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_slab_stats_t *stats)
+    @brief      Gives the statistics of a size class when the singleton works in eo_mempool_alloc_slab mode. On the
+                hosts they include what the calling thread has done, but what the other threads have done since
+                their latest exchange of blocks with the class is not included yet. 
+    @param      p               The mempool singleton                
+    @param      sizeclass       The class, from 0 (the smallest blocks) to eo_mempool_slab_classes_numberof-1.
+    @param      stats           The statistics.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the mode is not slab or the class is wrong.
+ **/ 
+extern eOresult_t eo_mempool_SlabStats_Get(EOtheMemoryPool *p, uint8_t sizeclass, eOmempool_slab_stats_t *stats);
+
+
+/** @fn         extern eOmempool_arena_t * eo_mempool_Arena_New(EOtheMemoryPool *p, uint32_t capacity)
+    @brief      Creates an arena of @e capacity bytes with zeroed memory. The first block it gives is aligned to
+                EOK_MEMPOOL_arenaalignment. 
+    @param      p               The mempool singleton                
+    @param      capacity        The size of the arena. Each request uses its size rounded up to 8 bytes plus 8 bytes.
+    @return     The arena or NULL if the mode is not dynamic or slab or if there is no memory.
+ **/ 
+extern eOmempool_arena_t * eo_mempool_Arena_New(EOtheMemoryPool *p, uint32_t capacity);
+
+
+/** @fn         extern eOresult_t eo_mempool_Arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Makes the calling thread get its memory from @e arena until eo_mempool_Arena_Exit(). The requests which
+                do not fit go to the usual allocator. On compilers without thread local storage the arena is seen
+                by every thread, hence it must be entered only when a single thread allocates (e.g., at startup). 
+    @param      p               The mempool singleton                
+    @param      arena           The arena.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the thread has already entered an arena.
+ **/ 
+extern eOresult_t eo_mempool_Arena_Enter(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
+
+/** @fn         extern eOresult_t eo_mempool_Arena_Exit(EOtheMemoryPool *p)
+    @brief      Makes the calling thread get its memory from the usual allocator again. 
+    @param      p               The mempool singleton                
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the thread has not entered an arena.
+ **/ 
+extern eOresult_t eo_mempool_Arena_Exit(EOtheMemoryPool *p);
+
+
+/** @fn         extern eOresult_t eo_mempool_Arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats)
+    @brief      Gives the usage of @e arena, so that its capacity can be tuned. 
+    @param      p               The mempool singleton                
+    @param      arena           The arena.
+    @param      stats           The usage.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/ 
+extern eOresult_t eo_mempool_Arena_Stats_Get(EOtheMemoryPool *p, eOmempool_arena_t *arena, eOmempool_arena_stats_t *stats);
+
+
+/** @fn         extern void eo_mempool_Arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena)
+    @brief      Releases the arena and all the memory given by it. Nobody must use that memory anymore. 
+    @param      p               The mempool singleton                
+    @param      arena           The arena.
+ **/ 
+extern void eo_mempool_Arena_Delete(EOtheMemoryPool *p, eOmempool_arena_t *arena);
+
 
 /** @fn         extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
     @brief      Gives back memory using heap. If the singleton handler is NULL or if it was not initialised in dynamic mode,
@@ -258,6 +403,64 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size);
 extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m);
 
 
+/** @fn         extern eOresult_t eo_mempool_Profiler_Start(EOtheMemoryPool *p, uint16_t maxblocks)
+    @brief      Starts the profiler, which tracks at most @e maxblocks blocks at the same time. The memory given before 
+                the start is not tracked and neither is its release. The profiler uses memory of the heap which is 
+                not included in the statistics.
+    @param      p               The mempool singleton                
+    @param      maxblocks       The max number of live blocks to track.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the profiler has already started or there
+                is no memory.
+ **/ 
+extern eOresult_t eo_mempool_Profiler_Start(EOtheMemoryPool *p, uint16_t maxblocks);
+
+
+/** @fn         extern eOresult_t eo_mempool_Profiler_Stop(EOtheMemoryPool *p)
+    @brief      Stops the profiler and releases its memory. 
+    @param      p               The mempool singleton                
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the profiler has not started.
+ **/ 
+extern eOresult_t eo_mempool_Profiler_Stop(EOtheMemoryPool *p);
+
+
+/** @fn         extern uint8_t eo_mempool_Profiler_Snapshot(EOtheMemoryPool *p, eOmempool_profiler_tag_t *tags, uint8_t capacity, 
+                                                            eOreltime_t *duration, uint32_t *untracked)
+    @brief      Copies the data of the tags at the same instant. 
+    @param      p               The mempool singleton                
+    @param      tags            Where to copy.
+    @param      capacity        The max number of tags to copy.
+    @param      duration        If not NULL, it gets the time since the start in usec, to compute the rates.
+    @param      untracked       If not NULL, it gets the number of blocks not tracked because there was no room.
+    @return     The number of tags copied.
+ **/ 
+extern uint8_t eo_mempool_Profiler_Snapshot(EOtheMemoryPool *p, eOmempool_profiler_tag_t *tags, uint8_t capacity, eOreltime_t *duration, uint32_t *untracked);
+
+
+/** @fn         extern uint16_t eo_mempool_Profiler_Print(EOtheMemoryPool *p, char *str, uint16_t size)
+    @brief      Writes a snapshot as text, one line per tag with live and peak bytes and the rates of allocation and 
+                release per second. 
+    @param      p               The mempool singleton                
+    @param      str             The string.
+    @param      size            Its size.
+    @return     The number of chars written, without the terminator.
+ **/ 
+extern uint16_t eo_mempool_Profiler_Print(EOtheMemoryPool *p, char *str, uint16_t size);
+
+
+// they are as eo_mempool_GetMemory(), eo_mempool_New() and eo_mempool_Realloc() but they tell the profiler who asks the memory.
+// the tag may be a file path, from which the profiler keeps only the name without extension.
+extern void * eo_mempool_GetMemoryTagged(EOtheMemoryPool *p, eOmempool_alignment_t alignmode, uint16_t size, uint16_t number, const char *tag);
+extern void * eo_mempool_NewTagged(EOtheMemoryPool *p, uint32_t size, const char *tag);
+extern void * eo_mempool_ReallocTagged(EOtheMemoryPool *p, void *m, uint32_t size, const char *tag);
+
+
+#if defined(EO_MEMPOOL_PROFILER)
+    #define eo_mempool_GetMemory(p, alignmode, size, number)    eo_mempool_GetMemoryTagged((p), (alignmode), (size), (number), __FILE__)
+    #define eo_mempool_New(p, size)                             eo_mempool_NewTagged((p), (size), __FILE__)
+    #define eo_mempool_Realloc(p, m, size)                      eo_mempool_ReallocTagged((p), (m), (size), __FILE__)
+#endif
+
+
 
 /** @}            
     end of group eo_thememorypool  
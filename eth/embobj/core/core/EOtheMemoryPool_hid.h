@@ -56,6 +56,81 @@ typedef struct
     uint32_t    usedbytespool;
 } eOmempool_stats_t;
 
+// it precedes every block given in slab mode. it keeps the user memory 8-byte aligned
+typedef struct
+{
+    uint32_t    size;           // the bytes asked by the user
+    uint8_t     sizeclass;      // the index of the class or EOK_uint08dummy if the block comes directly from the heap
+    uint8_t     magic;
+    uint16_t    dummy;
+} eOmempool_slab_blockheader_t;
+
+typedef struct
+{
+    eOmempool_slab_blockheader_t*   freelist;   // the first free block. every free block keeps the next one in its user memory
+    eOmempool_slab_stats_t          stats;
+} eOmempool_slab_class_t;
+
+typedef struct
+{
+    eOmempool_slab_class_t          classes[eo_mempool_slab_classes_numberof];
+} eOmempool_slab_t;
+
+// the free blocks of a class kept by a single thread, and what it has done with them since it last exchanged blocks
+// with the free list of the class
+typedef struct
+{
+    eOmempool_slab_blockheader_t*   freelist;
+    uint32_t                        count;      // the blocks inside freelist
+    uint32_t                        allocations;
+    uint32_t                        releases;
+    int32_t                         usedbytes;
+} eOmempool_slab_cache_t;
+
+struct eOmempool_arena_hid
+{
+    uint8_t*                        memory;     // as given by the heap
+    uint8_t*                        base;       // memory aligned to EOK_MEMPOOL_arenaalignment
+    uint32_t                        capacity;
+    uint32_t                        used;
+    uint32_t                        lastoffset; // of the last block given, so that it can be reallocated in place
+    uint32_t                        overflows;
+    eOmempool_arena_t*              next;       // in the list of the live arenas
+};
+
+// it precedes every block given by an arena. it keeps the user memory 8-byte aligned
+typedef struct
+{
+    uint32_t    size;
+    uint32_t    dummy;
+} eOmempool_arena_blockheader_t;
+
+typedef struct
+{
+    const char*                     key;        // as given by the caller. the same file always gives the same pointer
+    eOmempool_profiler_tag_t        data;
+} eOmempool_profiler_entry_t;
+
+typedef struct
+{
+    void*                           ptr;        // NULL if the slot is free
+    uint32_t                        size;
+    uint8_t                         tag;
+    uint8_t                         dummy[3];
+} eOmempool_profiler_block_t;
+
+typedef struct
+{
+    eObool_t                        started;
+    uint8_t                         numberoftags;
+    eOabstime_t                     start;
+    uint32_t                        untracked;
+    uint32_t                        tracked;
+    uint32_t                        mask;       // the blocks are a hash table with mask+1 slots
+    eOmempool_profiler_entry_t*     tags;
+    eOmempool_profiler_block_t*     blocks;
+} eOmempool_profiler_t;
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 struct EOtheMemoryPool_hid 
@@ -67,6 +142,9 @@ struct EOtheMemoryPool_hid
     EOVmutex                        *mutex;
     eOreltime_t                     tout;
     eOmempool_stats_t               stats;
+    eOmempool_slab_t                slab;
+    eOmempool_arena_t*              arenas;
+    eOmempool_profiler_t            profiler;
 }; 
 
 
@@ -45,7 +45,14 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// define it to save the ram of the jump table and to scan the tables of the states at every event. on the boards the
+// jump table is used only if EOUMLSM_USE_JUMPTABLE is defined, because its ram is scarce there
+#undef EOUMLSM_DONT_USE_JUMPTABLE
+
+#if (defined(EO_TAILOR_CODE_FOR_ARM) || defined(EO_TAILOR_CODE_FOR_DSPIC)) && !defined(EOUMLSM_USE_JUMPTABLE)
+    #define EOUMLSM_DONT_USE_JUMPTABLE
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -75,6 +82,14 @@ static uint8_t s_eo_umlsm_GetDeepestStateFrom(eOumlsm_cfg_t * p, uint8_t index);
 
 static eOresult_t s_eo_umlsm_Verify(eOumlsm_cfg_t * p);
 
+#if !defined(EOUMLSM_DONT_USE_JUMPTABLE)
+static eOumlsm_jumptable_t * s_eo_umlsm_Compile(eOumlsm_cfg_t * p);
+
+static void s_eo_umlsm_CompileState(eOumlsm_cfg_t * p, uint8_t s, eOumlsm_jumptable_t *jt, uint32_t *njumps, uint32_t *nactions);
+
+static uint8_t s_eo_umlsm_ConsumeOneEventCompiled(EOumlsm *const p, eOumlsmEvent_t event);
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -168,6 +183,12 @@ extern uint8_t eo_umlsm_ProcessEvent(EOumlsm *p, eOumlsmEvent_t ev, eOumlsmConsu
     
     if(consume == eo_umlsm_consume_ONE) 
     {
+#if !defined(EOUMLSM_DONT_USE_JUMPTABLE)
+        if(NULL != p->jumptable)
+        {
+            return(s_eo_umlsm_ConsumeOneEventCompiled(p, ev));
+        }
+#endif
         return(s_eo_umlsm_ConsumeOneEvent(p, ev));
     }
     else if(consume == eo_umlsm_consume_UPTO08) 
@@ -190,7 +211,16 @@ extern uint8_t eo_umlsm_ProcessEvent(EOumlsm *p, eOumlsmEvent_t ev, eOumlsmConsu
             }
 
             // increment retval only if the event was triggered
-            retval += s_eo_umlsm_ConsumeOneEvent(p, event);
+#if !defined(EOUMLSM_DONT_USE_JUMPTABLE)
+            if(NULL != p->jumptable)
+            {
+                retval += s_eo_umlsm_ConsumeOneEventCompiled(p, event);
+            }
+            else
+#endif
+            {
+                retval += s_eo_umlsm_ConsumeOneEvent(p, event);
+            }
 
             consumed ++;
     
@@ -562,6 +592,13 @@ static void s_eo_umlsm_Specialise(EOumlsm *p, const eOumlsm_cfg_t * c)
     size = c->internal_event_fifo_size;
     p->internal_event_fifo = (0 == size) ? (NULL) : eo_fifobyte_New(size, NULL);
 
+    // the jump table, which replaces the scan of the tables of the states at every event
+#if !defined(EOUMLSM_DONT_USE_JUMPTABLE)
+    p->jumptable = s_eo_umlsm_Compile(c);
+#else
+    p->jumptable = NULL;
+#endif
+
     // reset dynamic data 
     if(NULL != c->resetdynamicdata_fn) 
     {
@@ -617,6 +654,213 @@ static eOresult_t s_eo_umlsm_Verify(eOumlsm_cfg_t * p)
 }
 
 
+#if !defined(EOUMLSM_DONT_USE_JUMPTABLE)
+
+static eOumlsm_jumptable_t * s_eo_umlsm_Compile(eOumlsm_cfg_t * p)
+{
+    eOumlsm_jumptable_t *jt = NULL;
+    eOumlsm_jumptable_t tmp = {0};
+    uint32_t njumps = 0;
+    uint32_t nactions = 0;
+    uint32_t nslots = 0;
+    uint8_t s = 0;
+    uint8_t i = 0;
+    
+    // the events which trigger any transition are those in [0, eventsnumber)
+    for(s=0; s<p->states_number; s++)
+    {
+        for(i=0; (NULL != p->states_table[s].transitions_table) && (i<p->states_table[s].transitions_number); i++)
+        {
+            eOumlsmEvent_t trigger = p->states_table[s].transitions_table[i].trigger;
+            if((eo_umlsm_evNONE != trigger) && (trigger >= tmp.eventsnumber))
+            {
+                tmp.eventsnumber = trigger + 1;
+            }
+        }
+    }
+    
+    // at first we only count the jumps and the actions
+    for(s=0; s<p->states_number; s++)
+    {
+        s_eo_umlsm_CompileState(p, s, &tmp, &njumps, &nactions);
+    }
+    
+    nslots = (uint32_t)p->states_number * tmp.eventsnumber;
+    if((0 == njumps) || (njumps > EOK_uint16dummy) || (nactions > EOK_uint16dummy))
+    {   // nothing to compile or too big for the uint16_t indices: we scan the tables at every event
+        return(NULL);
+    }
+    
+    jt = (eOumlsm_jumptable_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOumlsm_jumptable_t), 1);
+    jt->eventsnumber = tmp.eventsnumber;
+    jt->lut = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), nslots+1);
+    jt->jumps = (eOumlsm_jump_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOumlsm_jump_t), njumps);
+    jt->actions = (0 == nactions) ? (NULL) : (eOumlsm_void_fp_umlsmp_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOumlsm_void_fp_umlsmp_t), nactions);
+    
+    // then we fill them
+    njumps = 0;
+    nactions = 0;
+    for(s=0; s<p->states_number; s++)
+    {
+        s_eo_umlsm_CompileState(p, s, jt, &njumps, &nactions);
+    }
+    jt->lut[nslots] = (uint16_t)njumps;
+    
+    return(jt);
+}
+
+
+// it adds the jumps and the actions of state s to njumps and nactions. if jt->lut is NULL it only counts them, otherwise 
+// it also fills the tables.
+static void s_eo_umlsm_CompileState(eOumlsm_cfg_t * p, uint8_t s, eOumlsm_jumptable_t *jt, uint32_t *njumps, uint32_t *nactions)
+{
+    const eOumlsmState_t *sourcestate = &(p->states_table[s]);
+    const eOumlsmState_t *targetstate = NULL;
+    const eOumlsmState_t *state1 = NULL;
+    uint16_t ev = 0;
+    uint8_t j = 0;
+    uint8_t i = 0;
+    uint8_t k = 0;
+    uint8_t next = 0;
+    
+    for(ev=0; ev<jt->eventsnumber; ev++)
+    {
+        if(NULL != jt->lut)
+        {
+            jt->lut[(uint32_t)s*jt->eventsnumber + ev] = (uint16_t)(*njumps);
+        }
+        
+        // the same order of s_eo_umlsm_ConsumeOneEvent(): owners bottom-up, then the transitions of each of them
+        for(j=0; j<sourcestate->owners_number; j++)
+        {
+            state1 = &(p->states_table[sourcestate->owners_table[j]]);
+            
+            for(i=0; (NULL != state1->transitions_table) && (i<state1->transitions_number); i++)
+            {
+                eOumlsmTransition_t *transition = &(state1->transitions_table[i]);
+                eOumlsm_jump_t *jump = NULL;
+                
+                if(ev != transition->trigger)
+                {
+                    continue;
+                }
+                
+                next = s_eo_umlsm_GetDeepestStateFrom(p, transition->next);
+                targetstate = &(p->states_table[next]);
+                
+                if(NULL != jt->lut)
+                {
+                    jump = &(jt->jumps[*njumps]);
+                    jump->transition    = transition;
+                    jump->actions       = (uint16_t)(*nactions);
+                    jump->next          = next;
+                    jump->exits         = 0;
+                    jump->entries       = 0;
+                }
+                (*njumps)++;
+                
+                // the on-exit functions, bottom-up, of the source states which are not owners of the target
+                for(k=0; k<sourcestate->owners_number; k++)
+                {
+                    uint8_t h = 0;
+                    state1 = &(p->states_table[sourcestate->owners_table[k]]);
+                    for(h=0; (h<targetstate->owners_number) && (sourcestate->owners_table[k] != targetstate->owners_table[h]); h++);
+                    if((NULL != state1->on_exit_fn) && (h == targetstate->owners_number))
+                    {
+                        if(NULL != jump)
+                        {
+                            jt->actions[*nactions] = state1->on_exit_fn;
+                            jump->exits++;
+                        }
+                        (*nactions)++;
+                    }
+                }
+                
+                // the on-entry functions, top-down, of the target states which are not owners of the source
+                for(k=0; k<targetstate->owners_number; k++)
+                {
+                    uint8_t h = 0;
+                    uint8_t t = targetstate->owners_table[targetstate->owners_number - 1 - k];
+                    state1 = &(p->states_table[t]);
+                    for(h=0; (h<sourcestate->owners_number) && (t != sourcestate->owners_table[h]); h++);
+                    if((NULL != state1->on_entry_fn) && (h == sourcestate->owners_number))
+                    {
+                        if(NULL != jump)
+                        {
+                            jt->actions[*nactions] = state1->on_entry_fn;
+                            jump->entries++;
+                        }
+                        (*nactions)++;
+                    }
+                }
+                
+                // restore the owner we are scanning
+                state1 = &(p->states_table[sourcestate->owners_table[j]]);
+            }
+        }
+    }
+}
+
+
+static uint8_t s_eo_umlsm_ConsumeOneEventCompiled(EOumlsm *const p, eOumlsmEvent_t event)
+{
+    const eOumlsm_jumptable_t *jt = p->jumptable;
+    const eOumlsm_jump_t *jump = NULL;
+    const eOumlsm_jump_t *end = NULL;
+    eOumlsm_void_fp_umlsmp_t *action = NULL;
+    uint32_t slot = 0;
+    uint8_t k = 0;
+    
+    if((eo_umlsm_evNONE == event) || (event >= jt->eventsnumber))
+    {   // no transition has such a trigger
+        return(0);
+    }
+    
+    slot = (uint32_t)p->activestate * jt->eventsnumber + event;
+    end = &(jt->jumps[jt->lut[slot+1]]);
+    
+    // the first candidate whose guard allows it fires
+    for(jump = &(jt->jumps[jt->lut[slot]]); jump < end; jump++)
+    {
+        if((NULL == jump->transition->guard_fn) || (eobool_true == jump->transition->guard_fn(p)))
+        {
+            break;
+        }
+    }
+    
+    if(jump == end)
+    {
+        return(0);
+    }
+    
+    action = &(jt->actions[jump->actions]);
+    
+    // ON EXIT
+    for(k=0; k<jump->exits; k++)
+    {
+        (*action++)(p);
+    }
+    
+    // ON TRANSITION
+    if(NULL != jump->transition->on_transition_fn) 
+    {
+        jump->transition->on_transition_fn(p);
+    }
+    
+    // SET STATE
+    p->activestate = jump->next;
+    
+    // ON ENTRY
+    for(k=0; k<jump->entries; k++)
+    {
+        (*action++)(p);
+    }
+    
+    return(1);
+}
+
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
@@ -40,6 +40,17 @@ extern "C" {
     on-exit, on-transition). The state machine executes first the events contained in such
     a fifo queue. By means of this mechanism, it is possible to trigger multiple state migrations 
     using a single external event.
+    
+    The eo_umlsm_New() compiles the tables of the states into a jump table, which gives for every state and event 
+    the candidate transitions together with the on-exit and on-entry functions to call, so that an event does not 
+    need to scan the hierarchy of states. The guards are still evaluated at every event and in the same order.
+    The jump table is allocated from the EOtheMemoryPool and it costs, with S states and E the highest trigger plus one:
+    - 2*(S*E+1) bytes for the lookup table,
+    - sizeof(eOumlsm_jump_t), i.e. 12 bytes on 32-bit cpus, for every transition which any state can take, its own
+      and those it inherits from its owners,
+    - one function pointer for every on-exit and on-entry function which those transitions call.
+    For this reason, on the boards (EO_TAILOR_CODE_FOR_ARM and EO_TAILOR_CODE_FOR_DSPIC) it is used only if
+    EOUMLSM_USE_JUMPTABLE is defined. Elsewhere define EOUMLSM_DONT_USE_JUMPTABLE inside EOumlsm.c to save its ram.
 
     @warning    The EOumlsm must be used by a single task because it does not have protection
                 versus concurrency.
@@ -46,6 +46,37 @@ extern "C" {
 // empty-section
 
 
+// - definition of the types used by the hidden struct ----------------------------------------------------------------
+
+/* @struct     eOumlsm_jump_t
+    @brief      A transition of the jump table. It is compiled for a given active state, thus it already holds the
+                deepest target state and the on-exit and on-entry functions to call, in order, inside the array of 
+                actions of the table starting from index actions.
+ **/  
+typedef struct
+{
+    eOumlsmTransition_t         *transition;
+    uint16_t                    actions;                /**< index of the first on-exit function inside eOumlsm_jumptable_t::actions */
+    uint8_t                     next;                   /**< the deepest target state */
+    uint8_t                     exits;                  /**< number of on-exit functions, followed by the on-entry ones */
+    uint8_t                     entries;                /**< number of on-entry functions */
+} eOumlsm_jump_t;
+
+
+/* @struct     eOumlsm_jumptable_t
+    @brief      The state machine compiled by eo_umlsm_New(). The candidate transitions of event ev in active state s
+                are jumps[lut[s*eventsnumber+ev]] up to jumps[lut[s*eventsnumber+ev+1]] excluded, in the same order
+                in which the hierarchy would be scanned. Their guards are still evaluated at run time.
+ **/  
+typedef struct
+{
+    uint16_t                    eventsnumber;           /**< the highest trigger plus one */
+    uint16_t                    *lut;
+    eOumlsm_jump_t              *jumps;
+    eOumlsm_void_fp_umlsmp_t    *actions;
+} eOumlsm_jumptable_t;
+
+
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
 /* @struct     EOeo_umlsm_hid
@@ -62,6 +93,7 @@ struct EOumlsm_hid
     uint8_t                     activestate;            /**< index inside states_table for the active state */
     EOfifoByte                  *internal_event_fifo;   /**< fifo queue of internal events */
 //    const sm_state_t    *state;                 /**< pointer to active state */        
+    eOumlsm_jumptable_t         *jumptable;             /**< the compiled state machine, or NULL if it is not used */
 };
 
 
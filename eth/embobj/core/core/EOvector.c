@@ -69,6 +69,8 @@
 
 static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *item, void *param);
 
+static void s_eo_vector_reverse(uint8_t *start, uint32_t size);
+
 
 
 EO_static_inline void s_eo_vector_default_clear(void *item, EOvector* vector)
@@ -89,6 +91,19 @@ EO_static_inline void s_eo_vector_default_init(void* item,  EOvector* vector)
     memset(item, 0, vector->item_size);
 }
 
+// the item in position pos. if the vector is not circular, first is 0 and the wrap never happens
+EO_static_inline uint8_t * s_eo_vector_item(EOvector* vector, eOsizecntnr_t pos)
+{
+    uint32_t index = (uint32_t)vector->first + pos;
+    
+    if(index >= vector->capacity)
+    {
+        index -= vector->capacity;
+    }
+    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+    return(&((uint8_t*)vector->stored_items)[index * vector->item_size]);
+}
+
 //EO_static_inline void s_eo_vector_default_initall(EOvector* vector)
 //{
 //    memset(vector->stored_items, 0, vector->capacity*vector->item_size);
@@ -131,6 +146,8 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     retptr->dummy               = 0;
     retptr->capacity            = capacity;
     retptr->functions           = NULL;
+    retptr->first               = 0;
+    retptr->circular            = eobool_false;
     if((NULL != item_init) || (NULL != item_copy) || (NULL != item_clear))
     {
         retptr->functions = (EOcontainer_functions_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOcontainer_functions_t), 1);
@@ -144,7 +161,7 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
     
     if(eo_vectorcapacity_dynamic == retptr->capacity)
     {      
-        eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+        eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanRelease(eo_mempool_GetHandle())), "eo_vector_New(): cannot use eo_vectorcapacity_dynamic", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
         retptr->stored_items = NULL;
     }
     else
@@ -196,6 +213,47 @@ extern EOvector* eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
 }
 
 
+extern EOvector * eo_vector_NewCircular(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                        eOres_fp_voidp_uint32_t item_init, uint32_t init_par, 
+                                        eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear)
+{
+    EOvector *retptr = NULL;
+    
+    // the items must stay in the same memory, as the front moves around it
+    eo_errman_Assert(eo_errman_GetHandle(), (eo_vectorcapacity_dynamic != capacity), "eo_vector_NewCircular(): dynamic capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    
+    retptr = eo_vector_New(item_size, capacity, item_init, init_par, item_copy, item_clear);
+    retptr->circular = eobool_true;
+    
+    return(retptr);
+}
+
+
+extern void * eo_vector_Linearise(EOvector * vector)
+{
+    uint32_t total = 0;
+    uint32_t head = 0;
+    
+    if(NULL == vector) 
+    {   // invalid data
+        return (NULL);    
+    }
+    
+    if(0 != vector->first)
+    {   // rotate the whole storage left by first items, so that the front goes at the start of it. 
+        // we use three reversals because they need no extra memory
+        total = (uint32_t)vector->capacity * vector->item_size;
+        head = (uint32_t)vector->first * vector->item_size;
+        s_eo_vector_reverse((uint8_t*)vector->stored_items, head);
+        s_eo_vector_reverse(&((uint8_t*)vector->stored_items)[head], total - head);
+        s_eo_vector_reverse((uint8_t*)vector->stored_items, total);
+        vector->first = 0;
+    }
+    
+    return(vector->stored_items);
+}
+
+
 extern eOsizecntnr_t eo_vector_Capacity(EOvector * vector) 
 {
     if(NULL == vector) 
@@ -220,7 +278,6 @@ extern eOsizecntnr_t eo_vector_ItemSize(EOvector * vector)
 extern void eo_vector_PushBack(EOvector * vector, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
         
     if((NULL == vector) || (NULL == p)) 
@@ -238,9 +295,7 @@ extern void eo_vector_PushBack(EOvector * vector, void *p)
         vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
     }
             
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)vector->size * vector->item_size]; 
+    item = s_eo_vector_item(vector, vector->size); 
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn)) 
     {
@@ -273,8 +328,7 @@ extern void * eo_vector_Back(EOvector * vector)
         return(start);     
     }
      
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[(uint32_t)(vector->size-1) * vector->item_size];
+    item = s_eo_vector_item(vector, vector->size - 1);
     
     return((void*) item);         
 }
@@ -283,7 +337,6 @@ extern void * eo_vector_Back(EOvector * vector)
 extern void eo_vector_PopBack(EOvector * vector) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == vector) 
@@ -296,8 +349,7 @@ extern void eo_vector_PopBack(EOvector * vector)
         return;     
     }
 
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[(uint32_t)(vector->size - 1) * vector->item_size];            
+    item = s_eo_vector_item(vector, vector->size - 1);            
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
     {
@@ -343,13 +395,21 @@ extern void eo_vector_PushFront(EOvector * vector, void *p)
         vector->stored_items = eo_mempool_Realloc(eo_mempool_GetHandle(), vector->stored_items, (uint32_t)(vector->size+1) * vector->item_size);
     }
     
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[0]; 
-    second = &start[(uint32_t)1 * vector->item_size];     
-    
-    // now i must memmove from front into second   
-    memmove(second, vector->stored_items, vector->size * vector->item_size); 
+    if(eobool_true == vector->circular)
+    {   // the front moves back by one item
+        vector->first = (0 == vector->first) ? (vector->capacity - 1) : (vector->first - 1);
+        item = s_eo_vector_item(vector, 0);
+    }
+    else
+    {
+        start = (uint8_t*) (vector->stored_items);
+        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
+        item = &start[0]; 
+        second = &start[(uint32_t)1 * vector->item_size];     
+        
+        // now i must memmove from front into second   
+        memmove(second, vector->stored_items, vector->size * vector->item_size); 
+    }
     
     // now we have the first position available and we can copy p into it.
     
@@ -384,8 +444,7 @@ extern void * eo_vector_Front(EOvector * vector)
         return(start);     
     }
      
-    start = (uint8_t*) (vector->stored_items);
-    item = &start[0];
+    item = s_eo_vector_item(vector, 0);
     
     return((void*) item);         
 }
@@ -408,7 +467,7 @@ extern void eo_vector_PopFront(EOvector * vector)
     }
 
     start = (uint8_t*) (vector->stored_items);
-    item = &start[0]; 
+    item = s_eo_vector_item(vector, 0); 
     second = &start[(uint32_t)(1) * vector->item_size];    
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
@@ -423,6 +482,15 @@ extern void eo_vector_PopFront(EOvector * vector)
     
     vector->size --;
     
+    if(eobool_true == vector->circular)
+    {   // the front moves ahead by one item. when empty we go back to the start, so that the storage is linear 
+        vector->first ++;
+        if((vector->first == vector->capacity) || (0 == vector->size))
+        {
+            vector->first = 0;
+        }
+        return;
+    }
     
     // now we must move memory starting from second to start for an amount of (vector->size * vector->item_size)
     // if size is zero, the function memmove() does not copy anything 
@@ -454,7 +522,6 @@ extern eOsizecntnr_t eo_vector_Size(EOvector * vector)
 extern void eo_vector_Clear(EOvector * vector) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     eOsizecntnr_t i = 0;        
     
@@ -470,11 +537,9 @@ extern void eo_vector_Clear(EOvector * vector)
     }
     
 
-    start = (uint8_t*) (vector->stored_items);
     for(i=0; i<vector->size; i++) 
-    {   // i use i as index because the items in a vector are always stored from pos 0 to size-1
-        // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-        item = &start[(uint32_t)i * vector->item_size];
+    {
+        item = s_eo_vector_item(vector, i);
         if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
         {
             vector->functions->item_clear_fn(item);
@@ -487,6 +552,7 @@ extern void eo_vector_Clear(EOvector * vector)
         
     
     vector->size = 0;
+    vector->first = 0;
     
     //its ok to use realloc when size is zero because eo_mempool_Realloc() calls eo_mempool_Free() and returns NULL.
     if(eo_vectorcapacity_dynamic == vector->capacity)
@@ -499,7 +565,6 @@ extern void eo_vector_Clear(EOvector * vector)
 extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     
     if(NULL == vector) 
@@ -513,9 +578,7 @@ extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos)
     }
     
    
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size];
+    item = s_eo_vector_item(vector, pos);
     
     return((void*) item);         
 }
@@ -523,7 +586,6 @@ extern void * eo_vector_At(EOvector * vector, eOsizecntnr_t pos)
 extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items, eOsizecntnr_t nitems)
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *p = NULL;          // external item
     uint8_t *item = NULL;       // internal item
     uint16_t i;
@@ -547,13 +609,11 @@ extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items,
     // now fill from pos-th position until (pos+nitems-1)-th position w/ objects pointed by items
     
     
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size]; 
     p = (uint8_t*) items;    // first ext item of items[]
     
     for(i=0; i<nitems; i++)
     {
+        item = s_eo_vector_item(vector, pos + i);
         if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
         {
             vector->functions->item_copy_fn(item, p);
@@ -563,7 +623,6 @@ extern void eo_vector_Assign(EOvector * vector, eOsizecntnr_t pos, void *items,
             s_eo_vector_default_copy(item, p, vector);
         } 
         
-        item += vector->item_size;
         p += vector->item_size;
     }
     
@@ -577,14 +636,14 @@ extern void* eo_vector_storage_Get(EOvector * vector)
         return (NULL);    
     }    
     
-    return(vector->stored_items);   
+    // in circular mode the items may wrap around the end of the storage: they are moved, hence this is a write
+    return(eo_vector_Linearise(vector));   
 }
 
 
 extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
         
     if((NULL == vector) || (NULL == p)) 
@@ -606,9 +665,7 @@ extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p)
     // now fill the pos-th position w/ object p
     
     
-    start = (uint8_t*) (vector->stored_items);
-    // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-    item = &start[(uint32_t)pos * vector->item_size]; 
+    item = s_eo_vector_item(vector, pos); 
     
     if((NULL != vector->functions) && (NULL != vector->functions->item_copy_fn))
     {
@@ -626,7 +683,6 @@ extern void eo_vector_AssignOne(EOvector * vector, eOsizecntnr_t pos, void *p)
 extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size) 
 {
     // here we require uint8_t to access stored_items because we work with bytes.
-    uint8_t *start = NULL;
     uint8_t *item = NULL;
     eOsizecntnr_t first;
     eOsizecntnr_t last;
@@ -683,11 +739,9 @@ extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size)
         }
         
         // ok, now i init the new memory as if it was just created. we do it for the new items.
-        start = (uint8_t*) (vector->stored_items);
         for(i=first; i<last; i++) 
         {
-            // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-            item = &start[(uint32_t)i * vector->item_size];
+            item = s_eo_vector_item(vector, i);
             if((NULL != vector->functions) && (NULL != vector->functions->item_init_fn))
             {
                 vector->functions->item_init_fn(item, vector->functions->item_init_par);
@@ -702,11 +756,9 @@ extern void eo_vector_Resize(EOvector * vector, eOsizecntnr_t size)
     else
     {   // must destroy the items
     
-        start = (uint8_t*) (vector->stored_items);
         for(i=first; i<last; i++) 
         {
-            // cast to uint32_t to tell the reader that index of array start[] can be bigger than max eOsizecntnr_t
-            item = &start[(uint32_t)i * vector->item_size];
+            item = s_eo_vector_item(vector, i);
             if((NULL != vector->functions) && (NULL != vector->functions->item_clear_fn))
             {
                 vector->functions->item_clear_fn(item);
@@ -765,8 +817,9 @@ extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(voi
     
 
     // loop over all items to see is any matches with external data
-    for(i=0, item = (uint8_t*) (vector->stored_items); i<vector->size; i++, item += vector->item_size)
+    for(i=0; i<vector->size; i++)
     {
+        item = s_eo_vector_item(vector, i);
         //if(0 == memcmp(param, item, vector->item_size))
         
         if(NULL != matching_rule)
@@ -803,8 +856,9 @@ extern void eo_vector_Execute(EOvector *vector, void (execute)(void *item, void
     }
     
     // loop over all items to call the execute()
-    for(i=0, item = (uint8_t*) (vector->stored_items); i<vector->size; i++, item += vector->item_size)
+    for(i=0; i<vector->size; i++)
     {
+        item = s_eo_vector_item(vector, i);
         execute(item, param);
     }
     
@@ -861,6 +915,20 @@ static eOresult_t s_eo_vector_default_matching_rule(EOvector * vector, void *ite
 }
 
 
+static void s_eo_vector_reverse(uint8_t *start, uint32_t size)
+{
+    uint8_t *end = start + size;
+    uint8_t tmp = 0;
+    
+    while((size > 1) && (start < --end))
+    {
+        tmp = *start;
+        *start++ = *end;
+        *end = tmp;
+    }
+}
+
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
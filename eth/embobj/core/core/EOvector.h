@@ -40,6 +40,10 @@ extern "C" {
     it returns a pointer to an internal item object. If the EOvector is requested to remove the item object, the 
     optional user-defined remove function is called or the default remove which set memory to zero.
     The EOvector is a base object and is used to derive a new object to manipulate specific items. 
+    An EOvector created with eo_vector_NewCircular() keeps its items in a ring, so that eo_vector_PushFront() and 
+    eo_vector_PopFront() do not move the other items. The position of eo_vector_At() is always counted from the 
+    front, whereas eo_vector_storage_Get() and eo_vector_Linearise() move the items back at the start of the
+    storage when they wrap around its end.
     
     @{		
  **/
@@ -103,6 +107,19 @@ extern EOvector * eo_vector_New(eOsizeitem_t item_size, eOsizecntnr_t capacity,
                                 eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
 
 
+/** @fn         extern EOvector * eo_vector_NewCircular(eOsizeitem_t item_size, eOsizecntnr_t capacity, 
+                                                     eOres_fp_voidp_uint32_t item_init, uint32_t init_par, 
+                                                     eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+    @brief      Creates a new EOvector object as eo_vector_New() does, but with the items kept in a ring, so that 
+                eo_vector_PushFront() and eo_vector_PopFront() cost as eo_vector_PushBack() and eo_vector_PopBack().
+    @param      capacity        The max number of item objects. It cannot be eo_vectorcapacity_dynamic.
+    @return     Pointer to the required EOvector object.
+ **/
+extern EOvector * eo_vector_NewCircular(eOsizeitem_t item_size, eOsizecntnr_t capacity,
+                                        eOres_fp_voidp_uint32_t item_init, uint32_t init_par, 
+                                        eOres_fp_voidp_voidp_t item_copy, eOres_fp_voidp_t item_clear);
+
+
 /** @fn         extern eOsizecntnr_t eo_vector_Capacity(EOvector * vector)
     @brief      Returns the maximum number of item objects that the EOvector is able to contain.
     @param      vector           Pointer to the EOvector object.
@@ -263,8 +280,27 @@ extern eObool_t eo_vector_Find(EOvector * vector, eOresult_t (matching_rule)(voi
 extern void eo_vector_Execute(EOvector *vector, void (execute)(void *item, void *param), void *param);
 
 
+/** @fn         extern void* eo_vector_storage_Get(EOvector * vector)
+    @brief      Gives the memory which contains the items, from position 0 to size-1. If the vector is circular it
+                calls eo_vector_Linearise() before, thus it may move the items: it is not a read-only access and it
+                must not be called on a vector which other threads are reading without a lock.
+    @param      vector          Pointer to the EOvector object. 
+    @return     The memory or NULL.
+    @warning    The pointers to items obtained before this call may point to other items afterwards.
+ **/
 extern void* eo_vector_storage_Get(EOvector * vector);
 
+
+/** @fn         extern void* eo_vector_Linearise(EOvector * vector)
+    @brief      Moves the items of a circular vector so that the item in position 0 is at the start of the storage.
+                It costs as many byte swaps as the capacity times the item size, and nothing if the items are
+                already there, as it happens for every vector which is not circular.
+    @param      vector          Pointer to the EOvector object. 
+    @return     The memory which contains the items or NULL.
+    @warning    The pointers to items obtained before this call may point to other items afterwards.
+ **/
+extern void* eo_vector_Linearise(EOvector * vector);
+
 extern void eo_vector_Delete(EOvector * vector);
 
 /** @}            
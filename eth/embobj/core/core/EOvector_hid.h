@@ -68,6 +68,9 @@ struct EOvector_hid
     uint16_t                    dummy;              
     void                        *stored_items;      /**< array of item object. */   
     EOcontainer_functions_t     *functions;
+    eOsizecntnr_t               first;              /**< index in stored_items of the item in position 0. always 0 if not circular. */
+    eObool_t                    circular;           /**< if eobool_true the front operations move first and not the items. */
+    uint8_t                     filler;
 };
 
 
@@ -127,6 +127,9 @@ extern "C" {
 #endif
     
     typedef float float32_t;
+    // the rtos of the boards does not have thread local storage
+    #define EO_threadlocal
+    // and the EO_atomic_* macros are not defined: their users take a lock instead
     #define EO_TAILOR_CODE_FOR_ARM    
     #define EO_READ_PREV_WORD_OF_MALLOC_FOR_SIZEOF_ALLOCATION
     
@@ -149,6 +152,7 @@ extern "C" {
     typedef float float32_t;
     #define __weak 
     #define EO_weak 
+    #define EO_threadlocal  __declspec(thread)
     #define EO_TAILOR_CODE_FOR_WINDOWS
     #define EO_WARNING(a)   __pragma(message("EOWARNING-> "##a))
     #define OVERRIDE_eo_receiver_callback_incaseoferror_in_sequencenumberReceived
@@ -166,7 +170,9 @@ extern "C" {
     #define snprintf        snprintf
     typedef float float32_t;
     #define EO_weak          __attribute__((weak))
+    #define EO_threadlocal   __thread
     #define EO_TAILOR_CODE_FOR_LINUX
+    #define EO_TAILOR_CODE_FOR_POSIX
     #define EO_WARNING(a)   _Pragma(message("EOWARNING-> "##a))
     #define OVERRIDE_eo_receiver_callback_incaseoferror_in_sequencenumberReceived
     #define _PEDANT_WARNING_ON_COMPILATION_CALLBACK_
@@ -182,6 +188,7 @@ extern "C" {
     //#define snprintf        snprintf   
     //#define stdint    dspic_stdint
     #define EO_TAILOR_CODE_FOR_DSPIC
+    #define EO_threadlocal
     #define __weak      __attribute__((__weak__))
 #elif defined(__APPLE__)
     #define EO_extern_inline       static inline
@@ -191,11 +198,37 @@ extern "C" {
     #define snprintf        snprintf
     typedef float float32_t;
     #define EO_weak         __attribute__((weak))
+    #define EO_threadlocal  __thread
+    #define EO_TAILOR_CODE_FOR_POSIX
 #else
     #error architecture not defined 
 #endif
     
 
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    // the hosts have pthreads and the atomic builtins of gcc and clang. the users of the EO_atomic_* macros test
+    // defined(EO_atomic_load_acquire) and take a lock instead when it is false, as on the boards.
+    #define EO_atomic_load_relaxed(p)                       __atomic_load_n((p), __ATOMIC_RELAXED)
+    #define EO_atomic_load_acquire(p)                       __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define EO_atomic_store_relaxed(p, v)                   __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+    #define EO_atomic_store_release(p, v)                   __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define EO_atomic_exchange_acquire(p, v)                __atomic_exchange_n((p), (v), __ATOMIC_ACQUIRE)
+    #define EO_atomic_fetch_add_relaxed(p, v)               __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+    #define EO_atomic_fetch_add_seqcst(p, v)                __atomic_fetch_add((p), (v), __ATOMIC_SEQ_CST)
+    #define EO_atomic_fetch_sub_relaxed(p, v)               __atomic_fetch_sub((p), (v), __ATOMIC_RELAXED)
+    #define EO_atomic_fetch_sub_release(p, v)               __atomic_fetch_sub((p), (v), __ATOMIC_RELEASE)
+    #define EO_atomic_fetch_sub_acqrel(p, v)                __atomic_fetch_sub((p), (v), __ATOMIC_ACQ_REL)
+    #define EO_atomic_fetch_and_release(p, v)               __atomic_fetch_and((p), (v), __ATOMIC_RELEASE)
+    // they return true if *p was equal to *e and it became d, else they copy *p into *e
+    #define EO_atomic_compare_exchange_relaxed(p, e, d)     __atomic_compare_exchange_n((p), (e), (d), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+    #define EO_atomic_compare_exchange_acquire(p, e, d)     __atomic_compare_exchange_n((p), (e), (d), 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)
+    #define EO_atomic_compare_exchange_release(p, e, d)     __atomic_compare_exchange_n((p), (e), (d), 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)
+    #define EO_atomic_thread_fence_acquire()                __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define EO_atomic_thread_fence_release()                __atomic_thread_fence(__ATOMIC_RELEASE)
+    #define EO_atomic_thread_fence_seqcst()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+
 
 #define __emBODYportingVERIFYsizeof(sname, ssize)    typedef uint8_t GUARD##sname[ ( ssize == sizeof(sname) ) ? (1) : (-1)];
 
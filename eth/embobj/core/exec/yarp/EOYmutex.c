@@ -36,6 +36,14 @@
 #include <FeatureInterface.h>   // to see the acemutex_* functions
 #endif
 
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    #define EOYMUTEX_USE_FUTEX
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #include <time.h>
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
 // --------------------------------------------------------------------------------------------------------------------
@@ -53,7 +61,9 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the built-in mutex spins at most this number of times before it sleeps in the kernel
+#define EOYMUTEX_FUTEX_maxspins         200
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -65,7 +75,17 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if defined(EOYMUTEX_USE_FUTEX)
+typedef struct
+{
+    uint32_t            state;          // 0 is free, 1 is taken, 2 is taken and some task may sleep on it
+    uint32_t            recursion;      // number of takes done by the owner
+    uintptr_t           owner;          // the address of s_eoy_mutex_futex_self of the owner, or 0
+    uint32_t            spins;          // running average of the spins needed to take the mutex w/out sleeping
+    eOmutex_stats_t     stats;
+} eOymutex_futex_t;
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -78,6 +98,17 @@ static eOresult_t s_eoy_mutex_take(void *p, eOreltime_t tout);
 static eOresult_t s_eoy_mutex_release(void *p);
 // virtual
 static eOresult_t s_eoy_mutex_delete(void *p);
+// virtual
+static eOresult_t s_eoy_mutex_stats(void *p, void *stats);
+
+#if defined(EOYMUTEX_USE_FUTEX)
+static void * s_eoy_mutex_futex_new(void);
+static int8_t s_eoy_mutex_futex_take(void *p, uint32_t tout);
+static int8_t s_eoy_mutex_futex_release(void *p);
+static void s_eoy_mutex_futex_delete(void *p);
+static int8_t s_eoy_mutex_futex_take_slow(eOymutex_futex_t *m, uint32_t tout, uintptr_t self);
+static uint64_t s_eoy_mutex_futex_now(void);
+#endif
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -85,6 +116,19 @@ static eOresult_t s_eoy_mutex_delete(void *p);
 
 static const char s_eobj_ownname[] = "EOYmutex";
 
+#if defined(EOYMUTEX_USE_FUTEX)
+// its address identifies the thread
+static EO_threadlocal uint8_t s_eoy_mutex_futex_self = 0;
+
+static const eOysystem_mutex_cfg_t s_eoy_mutex_futex_cfg =
+{
+    EO_INIT(.fp_new)        s_eoy_mutex_futex_new,
+    EO_INIT(.fp_take)       s_eoy_mutex_futex_take,
+    EO_INIT(.fp_release)    s_eoy_mutex_futex_release,
+    EO_INIT(.fp_delete)     s_eoy_mutex_futex_delete
+};
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -103,6 +147,7 @@ extern EOYmutex* eoy_mutex_New(void)
 
     // init its vtable
     eov_mutex_hid_SetVTABLE(retptr->mutex, s_eoy_mutex_take, s_eoy_mutex_release, s_eoy_mutex_delete); 
+    eov_mutex_hid_SetStatsVF(retptr->mutex, s_eoy_mutex_stats);
 
     // i get a new yarp mutex
     retptr->acemutex = eoy_sys_hid_mutex_cfg_get(eoy_sys_GetHandle())->fp_new(); // guaranteed to be non-NULL fptr
@@ -159,10 +204,29 @@ extern eOresult_t eoy_mutex_Release(EOYmutex *m)
 }
 
 
+extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOmutex_stats_t *stats)
+{
+    if((NULL == m) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(s_eoy_mutex_stats(m, stats));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+extern const eOysystem_mutex_cfg_t * eoy_mutex_hid_builtin_cfg_get(void)
+{
+#if defined(EOYMUTEX_USE_FUTEX)
+    return(&s_eoy_mutex_futex_cfg);
+#else
+    return(NULL);
+#endif
+}
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -201,6 +265,195 @@ static eOresult_t s_eoy_mutex_delete(void *p)
     return(eores_OK);
 }
 
+
+static eOresult_t s_eoy_mutex_stats(void *p, void *stats)
+{
+#if defined(EOYMUTEX_USE_FUTEX)
+    EOYmutex *m = (EOYmutex *)p;
+    eOymutex_futex_t *f = (eOymutex_futex_t*)m->acemutex;
+    eOmutex_stats_t *s = (eOmutex_stats_t*)stats;
+
+    if((NULL == f) || (s_eoy_mutex_futex_take != eoy_sys_hid_mutex_cfg_get(eoy_sys_GetHandle())->fp_take))
+    {
+        return(eores_NOK_unsupported);
+    }
+
+    // the fields are written by the owner of the mutex, thus we read them one by one w/out taking it
+    s->acquisitions     = EO_atomic_load_relaxed(&f->stats.acquisitions);
+    s->contended        = EO_atomic_load_relaxed(&f->stats.contended);
+    s->timeouts         = EO_atomic_load_relaxed(&f->stats.timeouts);
+    s->maxwaittime      = EO_atomic_load_relaxed(&f->stats.maxwaittime);
+    s->waittime         = EO_atomic_load_relaxed(&f->stats.waittime);
+
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+#if defined(EOYMUTEX_USE_FUTEX)
+
+static void * s_eoy_mutex_futex_new(void)
+{
+    eOymutex_futex_t *m = (eOymutex_futex_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOymutex_futex_t), 1);
+    memset(m, 0, sizeof(eOymutex_futex_t));
+    return(m);
+}
+
+
+static int8_t s_eoy_mutex_futex_take(void *p, uint32_t tout)
+{
+    eOymutex_futex_t *m = (eOymutex_futex_t*)p;
+    uintptr_t self = (uintptr_t)&s_eoy_mutex_futex_self;
+    uint32_t c = 0;
+
+    if(self == EO_atomic_load_relaxed(&m->owner))
+    {   // it is recursive, as the ace mutex used w/ yarp
+        m->recursion++;
+        return(eores_OK);
+    }
+
+    if(EO_atomic_compare_exchange_acquire(&m->state, &c, 1))
+    {   // fast path: it was free
+        EO_atomic_store_relaxed(&m->owner, self);
+        m->recursion = 1;
+        EO_atomic_store_relaxed(&m->stats.acquisitions, m->stats.acquisitions + 1);
+        return(eores_OK);
+    }
+
+    if(eok_reltimeZERO == tout)
+    {
+        EO_atomic_fetch_add_relaxed(&m->stats.timeouts, 1);
+        return(eores_NOK_timeout);
+    }
+
+    return(s_eoy_mutex_futex_take_slow(m, tout, self));
+}
+
+
+static int8_t s_eoy_mutex_futex_take_slow(eOymutex_futex_t *m, uint32_t tout, uintptr_t self)
+{
+    uint64_t start = s_eoy_mutex_futex_now();
+    uint64_t deadline = start + (uint64_t)tout * 1000;
+    uint64_t now = 0;
+    uint64_t wait = 0;
+    uint32_t spins = EO_atomic_load_relaxed(&m->spins);
+    uint32_t maxspins = 2*spins + 16;
+    uint32_t i = 0;
+    uint32_t c = 0;
+    struct timespec ts;
+
+    if(maxspins > EOYMUTEX_FUTEX_maxspins)
+    {
+        maxspins = EOYMUTEX_FUTEX_maxspins;
+    }
+
+    // adaptive spin: the owner may release it soon. the number of spins follows the number which was needed in
+    // the past, so that we do not waste cpu on a mutex which is kept for long.
+    for(i=0; i<maxspins; i++)
+    {
+        c = 0;
+        if((0 == EO_atomic_load_relaxed(&m->state)) &&
+           (EO_atomic_compare_exchange_acquire(&m->state, &c, 1)))
+        {
+            break;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    EO_atomic_store_relaxed(&m->spins, (uint32_t)((int32_t)spins + ((int32_t)i - (int32_t)spins) / 8));
+
+    if(i == maxspins)
+    {   // we sleep. state 2 tells the owner that it must wake us
+        c = EO_atomic_exchange_acquire(&m->state, 2);
+        while(0 != c)
+        {
+            struct timespec *pts = NULL;
+
+            if(eok_reltimeINFINITE != tout)
+            {
+                now = s_eoy_mutex_futex_now();
+                if(now >= deadline)
+                {
+                    EO_atomic_fetch_add_relaxed(&m->stats.timeouts, 1);
+                    return(eores_NOK_timeout);
+                }
+                ts.tv_sec = (deadline - now) / 1000000000;
+                ts.tv_nsec = (deadline - now) % 1000000000;
+                pts = &ts;
+            }
+
+            syscall(SYS_futex, &m->state, FUTEX_WAIT_PRIVATE, 2, pts, NULL, 0);
+            c = EO_atomic_exchange_acquire(&m->state, 2);
+        }
+    }
+
+    EO_atomic_store_relaxed(&m->owner, self);
+    m->recursion = 1;
+
+    wait = s_eoy_mutex_futex_now() - start;
+    if(wait > UINT32_MAX)
+    {
+        wait = UINT32_MAX;
+    }
+    EO_atomic_store_relaxed(&m->stats.acquisitions, m->stats.acquisitions + 1);
+    EO_atomic_store_relaxed(&m->stats.contended, m->stats.contended + 1);
+    EO_atomic_store_relaxed(&m->stats.waittime, m->stats.waittime + wait);
+    if(wait > m->stats.maxwaittime)
+    {
+        EO_atomic_store_relaxed(&m->stats.maxwaittime, (uint32_t)wait);
+    }
+
+    return(eores_OK);
+}
+
+
+static int8_t s_eoy_mutex_futex_release(void *p)
+{
+    eOymutex_futex_t *m = (eOymutex_futex_t*)p;
+
+    if((uintptr_t)&s_eoy_mutex_futex_self != EO_atomic_load_relaxed(&m->owner))
+    {   // not taken by this thread
+        return(eores_NOK_generic);
+    }
+
+    if(0 != --m->recursion)
+    {
+        return(eores_OK);
+    }
+
+    EO_atomic_store_relaxed(&m->owner, 0);
+
+    if(1 != EO_atomic_fetch_sub_release(&m->state, 1))
+    {   // some task may sleep on it
+        EO_atomic_store_release(&m->state, 0);
+        syscall(SYS_futex, &m->state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+
+    return(eores_OK);
+}
+
+
+static void s_eoy_mutex_futex_delete(void *p)
+{
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+static uint64_t s_eoy_mutex_futex_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
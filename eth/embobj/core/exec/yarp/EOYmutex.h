@@ -43,6 +43,7 @@ extern "C" {
 // - external dependencies --------------------------------------------------------------------------------------------
 
 #include "EoCommon.h"
+#include "EOVmutex.h"
 
 
 
@@ -108,6 +109,17 @@ extern eOresult_t eoy_mutex_Take(EOYmutex *m, eOreltime_t tout);
 extern eOresult_t eoy_mutex_Release(EOYmutex *m); 
 
 
+/** @fn         extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOmutex_stats_t *stats)
+    @brief      Gives the contention statistics of the mutex. They are kept only by the built-in mutex, which is used
+                when the eOysystem_cfg_t passed to eoy_sys_Initialise() does not contain any mutex function.
+    @param      m               The mutex
+    @param      stats           The statistics
+    @return     eores_OK in case of success, eores_NOK_nullpointer if any argument is NULL, or eores_NOK_unsupported
+                if the mutex is not the built-in one.
+ **/
+extern eOresult_t eoy_mutex_Stats_Get(EOYmutex *m, eOmutex_stats_t *stats);
+
+
 
 
 
@@ -35,6 +35,7 @@ extern "C" {
 
 #include "EoCommon.h"
 #include "EOVmutex.h"
+#include "EOYtheSystem.h"
 
 
 
@@ -68,7 +69,15 @@ struct EOYmutex_hid
 
 
 // - declaration of extern hidden functions ---------------------------------------------------------------------------
-// empty-section
+
+
+/** @fn         extern const eOysystem_mutex_cfg_t * eoy_mutex_hid_builtin_cfg_get(void)
+    @brief      Gives the functions of the built-in mutex, which is a recursive mutex based on the linux futex with
+                a bounded adaptive spin before sleeping. EOYtheSystem uses them when the configuration does not
+                contain any mutex function.
+    @return     The functions, or NULL if there is no built-in mutex on this system.
+ **/
+extern const eOysystem_mutex_cfg_t * eoy_mutex_hid_builtin_cfg_get(void);
 
 #ifdef __cplusplus
 }       // closing brace for extern "C"
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVrwlock_hid.h"
+
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EOYRWLOCK_USE_POSIX
+    #include <pthread.h>
+    #include <errno.h>
+    #include <time.h>
+#else
+    #include "EOYmutex.h"
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYrwlock.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface 
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYrwlock_hid.h" 
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the period of the polling used for finite timeouts where there are no timed pthread_rwlock functions
+#define EOYRWLOCK_pollperiod        100
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set() 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// virtual
+static eOresult_t s_eoy_rwlock_takeshared(void *p, eOreltime_t tout);
+// virtual
+static eOresult_t s_eoy_rwlock_takeexclusive(void *p, eOreltime_t tout);
+// virtual
+static eOresult_t s_eoy_rwlock_release(void *p);
+// virtual
+static eOresult_t s_eoy_rwlock_delete(void *p);
+
+#if defined(EOYRWLOCK_USE_POSIX)
+static eOresult_t s_eoy_rwlock_posix_take(EOYrwlock *m, eOreltime_t tout, eObool_t exclusive);
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOYrwlock";
+
+#if defined(EOYRWLOCK_USE_POSIX)
+// its address identifies the thread
+static EO_threadlocal uint8_t s_eoy_rwlock_self = 0;
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOYrwlock* eoy_rwlock_New(void) 
+{
+    EOYrwlock *retptr = NULL;    
+
+    // i get the memory for the yarp rwlock object
+    retptr = (EOYrwlock*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOYrwlock), 1);
+    
+    // i get the base rwlock
+    retptr->rwlock = eov_rwlock_hid_New();
+
+    // init its vtable
+    eov_rwlock_hid_SetVTABLE(retptr->rwlock, s_eoy_rwlock_takeshared, s_eoy_rwlock_takeexclusive, s_eoy_rwlock_release, s_eoy_rwlock_delete); 
+
+    retptr->writer      = 0;
+    retptr->recursion   = 0;
+
+#if defined(EOYRWLOCK_USE_POSIX)
+    retptr->oslock = eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(pthread_rwlock_t), 1);
+    // the default attributes prefer the readers, so that a reader can take it again while a writer waits
+    if(0 != pthread_rwlock_init((pthread_rwlock_t*)retptr->oslock, NULL))
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), retptr->oslock);
+        retptr->oslock = NULL;
+    }
+#else
+    retptr->oslock = eoy_mutex_New();
+#endif
+
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != retptr->oslock), s_eobj_ownname, "eoy_rwlock_New(): cannot get a lock", &eo_errman_DescrRuntimeErrorLocal);
+    
+    return(retptr);    
+}
+
+
+extern void eoy_rwlock_Delete(EOYrwlock *m) 
+{    
+    if((NULL == m) || (NULL == m->oslock))
+    {
+        return;
+    }
+    
+#if defined(EOYRWLOCK_USE_POSIX)
+    pthread_rwlock_destroy((pthread_rwlock_t*)m->oslock);
+    eo_mempool_Delete(eo_mempool_GetHandle(), m->oslock);
+#else
+    eoy_mutex_Delete((EOYmutex*)m->oslock);
+#endif
+    
+    eov_rwlock_hid_Delete(m->rwlock);
+    
+    memset(m, 0, sizeof(EOYrwlock));
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), m);
+    return;
+}
+
+
+extern eOresult_t eoy_rwlock_TakeShared(EOYrwlock *m, eOreltime_t tout)
+{
+    if(NULL == m)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(s_eoy_rwlock_takeshared(m, tout));
+}
+
+
+extern eOresult_t eoy_rwlock_TakeExclusive(EOYrwlock *m, eOreltime_t tout)
+{
+    if(NULL == m)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(s_eoy_rwlock_takeexclusive(m, tout));
+}
+
+
+extern eOresult_t eoy_rwlock_Release(EOYrwlock *m)
+{
+    if(NULL == m)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    return(s_eoy_rwlock_release(m));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eoy_rwlock_takeshared(void *p, eOreltime_t tout) 
+{
+    EOYrwlock *m = (EOYrwlock *)p;
+
+    if(NULL == m->oslock)
+    {
+        return(eores_NOK_nullpointer);
+    }
+#if defined(EOYRWLOCK_USE_POSIX)
+    return(s_eoy_rwlock_posix_take(m, tout, eobool_false));
+#else
+    return(eoy_mutex_Take((EOYmutex*)m->oslock, tout));
+#endif
+}
+
+
+static eOresult_t s_eoy_rwlock_takeexclusive(void *p, eOreltime_t tout) 
+{
+    EOYrwlock *m = (EOYrwlock *)p;
+
+    if(NULL == m->oslock)
+    {
+        return(eores_NOK_nullpointer);
+    }
+#if defined(EOYRWLOCK_USE_POSIX)
+    return(s_eoy_rwlock_posix_take(m, tout, eobool_true));
+#else
+    return(eoy_mutex_Take((EOYmutex*)m->oslock, tout));
+#endif
+}
+
+
+static eOresult_t s_eoy_rwlock_release(void *p) 
+{
+    EOYrwlock *m = (EOYrwlock *)p;
+
+    if(NULL == m->oslock)
+    {
+        return(eores_NOK_nullpointer);
+    }
+#if defined(EOYRWLOCK_USE_POSIX)
+    if((uintptr_t)&s_eoy_rwlock_self == EO_atomic_load_relaxed(&m->writer))
+    {
+        if(0 != --m->recursion)
+        {
+            return(eores_OK);
+        }
+        EO_atomic_store_relaxed(&m->writer, 0);
+    }
+
+    return((0 == pthread_rwlock_unlock((pthread_rwlock_t*)m->oslock)) ? (eores_OK) : (eores_NOK_generic));
+#else
+    return(eoy_mutex_Release((EOYmutex*)m->oslock));
+#endif
+}
+
+
+static eOresult_t s_eoy_rwlock_delete(void *p) 
+{
+    eoy_rwlock_Delete((EOYrwlock *)p);
+    return(eores_OK);
+}
+
+
+#if defined(EOYRWLOCK_USE_POSIX)
+
+static eOresult_t s_eoy_rwlock_posix_take(EOYrwlock *m, eOreltime_t tout, eObool_t exclusive)
+{
+    pthread_rwlock_t *l = (pthread_rwlock_t*)m->oslock;
+    uintptr_t self = (uintptr_t)&s_eoy_rwlock_self;
+    int r = 0;
+
+    if(self == EO_atomic_load_relaxed(&m->writer))
+    {   // the writer takes it again in any mode
+        m->recursion++;
+        return(eores_OK);
+    }
+
+    if(eok_reltimeZERO == tout)
+    {
+        r = (eobool_true == exclusive) ? pthread_rwlock_trywrlock(l) : pthread_rwlock_tryrdlock(l);
+    }
+    else if(eok_reltimeINFINITE == tout)
+    {
+        r = (eobool_true == exclusive) ? pthread_rwlock_wrlock(l) : pthread_rwlock_rdlock(l);
+    }
+    else
+    {
+#if defined(__APPLE__)
+        // there are no timed functions, thus we poll
+        struct timespec ts = {0, 1000*EOYRWLOCK_pollperiod};
+        eOreltime_t waited = 0;
+        for(;;)
+        {
+            r = (eobool_true == exclusive) ? pthread_rwlock_trywrlock(l) : pthread_rwlock_tryrdlock(l);
+            if((EBUSY != r) || (waited >= tout))
+            {
+                break;
+            }
+            nanosleep(&ts, NULL);
+            waited += EOYRWLOCK_pollperiod;
+        }
+#else
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += tout / 1000000;
+        ts.tv_nsec += 1000 * (tout % 1000000);
+        if(ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+        r = (eobool_true == exclusive) ? pthread_rwlock_timedwrlock(l, &ts) : pthread_rwlock_timedrdlock(l, &ts);
+#endif
+    }
+
+    if(0 != r)
+    {
+        return(((EBUSY == r) || (ETIMEDOUT == r)) ? (eores_NOK_timeout) : (eores_NOK_generic));
+    }
+
+    if(eobool_true == exclusive)
+    {
+        EO_atomic_store_relaxed(&m->writer, self);
+        m->recursion = 1;
+    }
+
+    return(eores_OK);
+}
+
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYRWLOCK_H_
+#define _EOYRWLOCK_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOYrwlock.h
+    @brief      This header file implements public interface to a yarp reader-writer lock.
+    @date       10/19/2026
+**/
+
+/** @defgroup eoy_rwlock Object EOYrwlock
+    The EOYrwlock is an object for the YARP execution environment derived from the abstract object EOVrwlock.
+    On POSIX systems it is a pthread_rwlock_t, which lets many readers in at the same time. The task which holds it
+    in exclusive mode can take it again in any mode. Elsewhere it falls back to a EOYmutex, hence the shared mode
+    is exclusive as well.
+
+    @{        
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVrwlock.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+  
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+ 
+
+/** @typedef    typedef struct EOYrwlock_hid EOYrwlock
+    @brief      EOYrwlock is an opaque struct. It is used to implement data abstraction for the YARP 
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions. 
+ **/  
+typedef struct EOYrwlock_hid EOYrwlock;
+
+
+    
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+ 
+ 
+/** @fn         extern EOYrwlock* eoy_rwlock_New(void)
+    @brief      Creates a new reader-writer lock object. It can be used as a eov_rwlock_fn_rwlockderived_new.
+    @return     The pointer to the required object. The pointer is guaranteed to be always valid and never 
+                to be NULL, because failure in creating the object makes the system to call the EOtheErrorManager.
+ **/
+extern EOYrwlock* eoy_rwlock_New(void);
+
+
+/** @fn         extern void eoy_rwlock_Delete(EOYrwlock *m)
+    @brief      Deletes the lock. It must not be taken.
+    @param      m               The lock
+ **/
+extern void eoy_rwlock_Delete(EOYrwlock *m);
+
+
+/** @fn         extern eOresult_t eoy_rwlock_TakeShared(EOYrwlock *m, eOreltime_t tout)
+    @brief      Takes the lock in shared mode, waiting for at most tout micro-seconds.
+    @param      m               The lock
+    @param      tout            The timeout. eok_reltimeZERO does not wait and eok_reltimeINFINITE waits forever.
+    @return     eores_OK, eores_NOK_timeout or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_rwlock_TakeShared(EOYrwlock *m, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eoy_rwlock_TakeExclusive(EOYrwlock *m, eOreltime_t tout)
+    @brief      Takes the lock in exclusive mode, waiting for at most tout micro-seconds.
+    @param      m               The lock
+    @param      tout            The timeout. eok_reltimeZERO does not wait and eok_reltimeINFINITE waits forever.
+    @return     eores_OK, eores_NOK_timeout or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_rwlock_TakeExclusive(EOYrwlock *m, eOreltime_t tout);
+
+
+/** @fn         extern eOresult_t eoy_rwlock_Release(EOYrwlock *m)
+    @brief      Releases the lock taken in either mode.
+    @param      m               The lock
+    @return     eores_OK, eores_NOK_generic if the lock was not taken or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_rwlock_Release(EOYrwlock *m);
+
+
+
+/** @}            
+    end of group eoy_rwlock  
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
+
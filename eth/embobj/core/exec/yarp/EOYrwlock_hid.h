@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYRWLOCK_HID_H_
+#define _EOYRWLOCK_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOYrwlock_hid.h
+    @brief      This header file implements hidden interface to a yarp reader-writer lock.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVrwlock.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+ 
+#include "EOYrwlock.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+
+/** @struct     EOYrwlock_hid
+    @brief      Hidden definition. Implements private data used only internally by the 
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/  
+ 
+struct EOYrwlock_hid 
+{ 
+    // - base object
+    EOVrwlock               *rwlock;
+
+    // - other stuff
+    void                    *oslock;        // a pthread_rwlock_t on POSIX systems, otherwise a EOYmutex
+    uintptr_t               writer;         // it identifies the task which holds the lock in exclusive mode, or 0
+    uint32_t                recursion;      // number of takes done by the writer
+}; 
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+ 
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
@@ -0,0 +1,748 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#if     defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE     // for the affinity and the name of the thread. it must come before any system header
+#endif
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem.h"
+#include "EOVtask_hid.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    #define EOYTASK_USE_POSIX
+    #include <pthread.h>
+    #include <sched.h>
+    #include <time.h>
+    #include <errno.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtask.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtask_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the ids below are left to the tasks of the singletons, such as the one of the EOYtheCallbackManager
+#define EOYTASK_firstid                 16
+
+// the id of a task is a eOid08_t and the ids are never reused, thus a process can create up to 240 tasks
+#define EOYTASK_lastid                  255
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#if defined(EOYTASK_USE_POSIX)
+typedef struct
+{
+    pthread_t           thread;
+    pthread_mutex_t     mutex;
+    pthread_cond_t      notempty;       // signalled to the thread of the task. it uses CLOCK_MONOTONIC
+    pthread_cond_t      notfull;        // signalled to the senders waiting for a free place
+} eOytask_oslock_t;
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eoy_task_isr_set_evt(void *t, eOevent_t evt);
+static eOresult_t s_eoy_task_tsk_set_evt(void *t, eOevent_t evt);
+static eOresult_t s_eoy_task_isr_send_msg(void *t, eOmessage_t msg);
+static eOresult_t s_eoy_task_tsk_send_msg(void *t, eOmessage_t msg, eOreltime_t tout);
+static eOresult_t s_eoy_task_isr_exec_cbk(void *t, eOcallback_t cbk, void *arg);
+static eOresult_t s_eoy_task_tsk_exec_cbk(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout);
+static uint8_t s_eoy_task_get_id(void *t);
+
+static eOresult_t s_eoy_task_setevent(EOYtask *p, eOevent_t evt);
+static eOresult_t s_eoy_task_push(EOYtask *p, eOcallback_t cbk, void *arg, eOmessage_t msg, eOreltime_t tout);
+static void s_eoy_task_account(EOYtask *p, eOnanotime_t release, eOnanotime_t start, eOnanotime_t end, eObool_t timedout);
+static uint8_t s_eoy_task_bin(eOnanotime_t ns);
+
+#if defined(EOYTASK_USE_POSIX)
+static eOnanotime_t s_eoy_task_now(void);
+static void s_eoy_task_abstime(struct timespec *ts, eOnanotime_t ns);
+static eObool_t s_eoy_task_thread_start(EOYtask *p);
+static void * s_eoy_task_thread(void *arg);
+static void s_eoy_task_loop_waiting(EOYtask *p);
+static void s_eoy_task_loop_periodic(EOYtask *p);
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOYtask";
+
+#if defined(EOYTASK_USE_POSIX)
+static uint32_t s_eoy_task_nextid = EOYTASK_firstid;
+static EO_threadlocal EOYtask *s_eoy_task_running = NULL;
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOYtask * eoy_task_New(const eOytask_cfg_t *cfg)
+{
+    EOYtask *p = NULL;
+
+    eo_errman_Assert(eo_errman_GetHandle(), NULL != cfg, "eoy_task_New(): NULL cfg", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), NULL != eov_sys_GetHandle(), "eoy_task_New(): system not initialised", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (NULL != cfg->run) || (eoy_task_type_callbackdriven == cfg->type), "eoy_task_New(): NULL run", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (0 != cfg->queuesize) || (eoy_task_type_eventdriven == cfg->type) || (eoy_task_type_periodic == cfg->type), "eoy_task_New(): 0 queuesize", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eoy_task_type_periodic != cfg->type) || ((eok_reltimeZERO != cfg->timeoutorperiod) && (eok_reltimeINFINITE != cfg->timeoutorperiod)), "eoy_task_New(): wrong period", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), cfg->priority <= 99, "eoy_task_New(): priority above 99", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+#if defined(EOYTASK_USE_POSIX)
+    {
+        eOytask_oslock_t *l = NULL;
+        pthread_condattr_t attr;
+        uint32_t id = EO_atomic_fetch_add_relaxed(&s_eoy_task_nextid, 1);
+
+        // past the last id the truncation to eOid08_t would give the ids reserved to the singletons
+        eo_errman_Assert(eo_errman_GetHandle(), id <= EOYTASK_lastid, "eoy_task_New(): no more task ids", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+
+        p = (EOYtask*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(EOYtask), 1);
+        memcpy(&p->config, cfg, sizeof(eOytask_cfg_t));
+        p->id = (eOid08_t) id;
+        p->events = 0;
+        p->eventsarrival = 0;
+        p->queue = NULL;
+        p->head = 0;
+        p->size = 0;
+        p->quit = eobool_false;
+        memset(&p->stats, 0, sizeof(eOytask_stats_t));
+
+        if(0 != p->config.queuesize)
+        {
+            p->queue = (eOytask_item_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOytask_item_t), p->config.queuesize);
+        }
+
+        l = (eOytask_oslock_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOytask_oslock_t), 1);
+        pthread_mutex_init(&l->mutex, NULL);
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&l->notempty, &attr);
+        pthread_cond_init(&l->notfull, &attr);
+        pthread_condattr_destroy(&attr);
+        p->oslock = l;
+
+        p->tsk = eov_task_hid_New();
+        eov_task_hid_SetVTABLE(p->tsk, NULL, NULL,
+                               s_eoy_task_isr_set_evt, s_eoy_task_tsk_set_evt,
+                               s_eoy_task_isr_send_msg, s_eoy_task_tsk_send_msg,
+                               s_eoy_task_isr_exec_cbk, s_eoy_task_tsk_exec_cbk,
+                               s_eoy_task_get_id);
+
+        if(eobool_false == s_eoy_task_thread_start(p))
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eoy_task_New(): cannot start the thread", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+        }
+    }
+#else
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eoy_task_New(): not supported on this system", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+#endif
+
+    return(p);
+}
+
+
+extern void eoy_task_Delete(EOYtask *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+#if defined(EOYTASK_USE_POSIX)
+    {
+        eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+
+        eo_errman_Assert(eo_errman_GetHandle(), p != s_eoy_task_running, "eoy_task_Delete(): called by the task itself", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+
+        pthread_mutex_lock(&l->mutex);
+        p->quit = eobool_true;
+        pthread_cond_broadcast(&l->notempty);
+        pthread_cond_broadcast(&l->notfull);
+        pthread_mutex_unlock(&l->mutex);
+
+        pthread_join(l->thread, NULL);
+
+        pthread_cond_destroy(&l->notfull);
+        pthread_cond_destroy(&l->notempty);
+        pthread_mutex_destroy(&l->mutex);
+        eo_mempool_Delete(eo_mempool_GetHandle(), l);
+    }
+#endif
+
+    if(NULL != p->queue)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->queue);
+    }
+    eov_task_hid_Delete(p->tsk);
+    memset(p, 0, sizeof(EOYtask));
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern void * eoy_task_GetExternalData(EOYtask *p)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    return(p->config.extdata);
+}
+
+
+extern eOresult_t eoy_task_Stats_Get(EOYtask *p, eOytask_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+#if defined(EOYTASK_USE_POSIX)
+    pthread_mutex_lock(&((eOytask_oslock_t*)p->oslock)->mutex);
+    memcpy(stats, &p->stats, sizeof(eOytask_stats_t));
+    pthread_mutex_unlock(&((eOytask_oslock_t*)p->oslock)->mutex);
+#else
+    memcpy(stats, &p->stats, sizeof(eOytask_stats_t));
+#endif
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eoy_task_Stats_Reset(EOYtask *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+#if defined(EOYTASK_USE_POSIX)
+    pthread_mutex_lock(&((eOytask_oslock_t*)p->oslock)->mutex);
+    memset(&p->stats, 0, sizeof(eOytask_stats_t));
+    pthread_mutex_unlock(&((eOytask_oslock_t*)p->oslock)->mutex);
+#else
+    memset(&p->stats, 0, sizeof(eOytask_stats_t));
+#endif
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern EOYtask * eoy_task_hid_GetRunning(void)
+{
+#if defined(EOYTASK_USE_POSIX)
+    return(s_eoy_task_running);
+#else
+    return(NULL);
+#endif
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eoy_task_isr_set_evt(void *t, eOevent_t evt)
+{
+    return(s_eoy_task_setevent((EOYtask*)t, evt));
+}
+
+
+static eOresult_t s_eoy_task_tsk_set_evt(void *t, eOevent_t evt)
+{
+    return(s_eoy_task_setevent((EOYtask*)t, evt));
+}
+
+
+static eOresult_t s_eoy_task_isr_send_msg(void *t, eOmessage_t msg)
+{
+    return(s_eoy_task_tsk_send_msg(t, msg, eok_reltimeZERO));
+}
+
+
+static eOresult_t s_eoy_task_tsk_send_msg(void *t, eOmessage_t msg, eOreltime_t tout)
+{
+    EOYtask *p = (EOYtask*)t;
+
+    if(eoy_task_type_messagedriven != p->config.type)
+    {
+        return(eores_NOK_unsupported);
+    }
+
+    return(s_eoy_task_push(p, NULL, NULL, msg, tout));
+}
+
+
+static eOresult_t s_eoy_task_isr_exec_cbk(void *t, eOcallback_t cbk, void *arg)
+{
+    return(s_eoy_task_tsk_exec_cbk(t, cbk, arg, eok_reltimeZERO));
+}
+
+
+static eOresult_t s_eoy_task_tsk_exec_cbk(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout)
+{
+    EOYtask *p = (EOYtask*)t;
+
+    if((eoy_task_type_callbackdriven != p->config.type) && (eoy_task_type_periodic != p->config.type))
+    {
+        return(eores_NOK_unsupported);
+    }
+
+    if(0 == p->config.queuesize)
+    {   // a periodic task without queue: s_eoy_task_push() would wait forever for a slot
+        return(eores_NOK_unsupported);
+    }
+
+    if(NULL == cbk)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    return(s_eoy_task_push(p, cbk, arg, 0, tout));
+}
+
+
+static uint8_t s_eoy_task_get_id(void *t)
+{
+    return(((EOYtask*)t)->id);
+}
+
+
+static eOresult_t s_eoy_task_setevent(EOYtask *p, eOevent_t evt)
+{
+    if((eoy_task_type_eventdriven != p->config.type) && (eoy_task_type_periodic != p->config.type))
+    {
+        return(eores_NOK_unsupported);
+    }
+
+#if defined(EOYTASK_USE_POSIX)
+    {
+        eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+
+        pthread_mutex_lock(&l->mutex);
+        if((0 == p->events) && (0 != evt))
+        {
+            p->eventsarrival = s_eoy_task_now();
+        }
+        p->events |= evt;
+        pthread_cond_signal(&l->notempty);
+        pthread_mutex_unlock(&l->mutex);
+    }
+
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+// msg is used by message-driven tasks, cbk and arg by the others
+static eOresult_t s_eoy_task_push(EOYtask *p, eOcallback_t cbk, void *arg, eOmessage_t msg, eOreltime_t tout)
+{
+#if defined(EOYTASK_USE_POSIX)
+    eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+    eOytask_item_t *item = NULL;
+    struct timespec ts;
+    int r = 0;
+
+    pthread_mutex_lock(&l->mutex);
+
+    if((p->size == p->config.queuesize) && (eok_reltimeZERO != tout) && (eok_reltimeINFINITE != tout))
+    {
+        s_eoy_task_abstime(&ts, s_eoy_task_now() + (eOnanotime_t)tout * 1000);
+    }
+
+    while((p->size == p->config.queuesize) && (eok_reltimeZERO != tout) && (ETIMEDOUT != r) && (eobool_false == p->quit))
+    {
+        r = (eok_reltimeINFINITE == tout) ? pthread_cond_wait(&l->notfull, &l->mutex) : pthread_cond_timedwait(&l->notfull, &l->mutex, &ts);
+    }
+
+    if(p->size == p->config.queuesize)
+    {
+        p->stats.rejected++;
+        pthread_mutex_unlock(&l->mutex);
+        return(eores_NOK_timeout);
+    }
+
+    item = &p->queue[(p->head + p->size) % p->config.queuesize];
+    item->cbk = cbk;
+    item->arg = arg;
+    item->msg = msg;
+    item->arrival = s_eoy_task_now();
+    p->size++;
+
+    pthread_cond_signal(&l->notempty);
+    pthread_mutex_unlock(&l->mutex);
+
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+// called with the lock taken. release is when the activation should have started: the activation time of a periodic
+// task, otherwise the arrival of what is processed.
+static void s_eoy_task_account(EOYtask *p, eOnanotime_t release, eOnanotime_t start, eOnanotime_t end, eObool_t timedout)
+{
+    eOytask_stats_t *s = &p->stats;
+    eOnanotime_t deadline = (eOnanotime_t)p->config.deadline * 1000;
+    eOnanotime_t latency = (start > release) ? (start - release) : (0);
+    eOnanotime_t response = (end > release) ? (end - release) : (0);
+    eOnanotime_t execution = (end > start) ? (end - start) : (0);
+
+    s->activations++;
+
+    if(eobool_true == timedout)
+    {
+        s->timeouts++;
+    }
+    else
+    {
+        s->latencysum += latency;
+        s->latencymax = (latency > s->latencymax) ? ((latency > 0xffffffff) ? (0xffffffff) : ((uint32_t)latency)) : (s->latencymax);
+        s->latency[s_eoy_task_bin(latency)]++;
+    }
+
+    s->executionmax = (execution > s->executionmax) ? ((execution > 0xffffffff) ? (0xffffffff) : ((uint32_t)execution)) : (s->executionmax);
+
+    if((0 == deadline) && (eoy_task_type_periodic == p->config.type))
+    {
+        deadline = (eOnanotime_t)p->config.timeoutorperiod * 1000;
+    }
+
+    if((0 != deadline) && (response > deadline))
+    {
+        s->deadlinemisses++;
+        s->miss[s_eoy_task_bin(response - deadline)]++;
+    }
+}
+
+
+// bin 0 is for [0, 1) us, bin k for [2^(k-1), 2^k) us. the last bin takes also all the bigger values
+static uint8_t s_eoy_task_bin(eOnanotime_t ns)
+{
+    uint64_t us = ns / 1000;
+    uint8_t bin = 0;
+
+    while((0 != us) && (bin < EOYTASK_HISTOGRAM_bins-1))
+    {
+        us >>= 1;
+        bin++;
+    }
+
+    return(bin);
+}
+
+
+#if defined(EOYTASK_USE_POSIX)
+
+// the same clock is used by clock_nanosleep() and by the condition variables
+static eOnanotime_t s_eoy_task_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((eOnanotime_t)ts.tv_sec * 1000000000 + (eOnanotime_t)ts.tv_nsec);
+}
+
+
+static void s_eoy_task_abstime(struct timespec *ts, eOnanotime_t ns)
+{
+    ts->tv_sec = (time_t)(ns / 1000000000);
+    ts->tv_nsec = (long)(ns % 1000000000);
+}
+
+
+static eObool_t s_eoy_task_thread_start(EOYtask *p)
+{
+    eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t cpus;
+    char name[16];
+    int r = 0;
+
+    pthread_attr_init(&attr);
+
+    if(p->config.cpu >= 0)
+    {
+        CPU_ZERO(&cpus);
+        CPU_SET(p->config.cpu, &cpus);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpus);
+    }
+
+    if(0 != p->config.priority)
+    {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = p->config.priority;
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+
+    r = pthread_create(&l->thread, &attr, s_eoy_task_thread, p);
+
+    if((EPERM == r) && (0 != p->config.priority))
+    {   // without CAP_SYS_NICE or a rtprio limit we still run, but the timing statistics will tell the difference
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eoy_task_New(): SCHED_FIFO not permitted, used the default policy", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+        pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        r = pthread_create(&l->thread, &attr, s_eoy_task_thread, p);
+    }
+
+    pthread_attr_destroy(&attr);
+
+    if(0 != r)
+    {
+        return(eobool_false);
+    }
+
+    if(NULL != p->config.name)
+    {   // linux keeps at most 15 chars
+        strncpy(name, p->config.name, sizeof(name)-1);
+        name[sizeof(name)-1] = 0;
+        pthread_setname_np(l->thread, name);
+    }
+
+    return(eobool_true);
+}
+
+
+static void * s_eoy_task_thread(void *arg)
+{
+    EOYtask *p = (EOYtask*)arg;
+
+    s_eoy_task_running = p;
+
+    if(NULL != p->config.startup)
+    {
+        p->config.startup(p, 0);
+    }
+
+    if(eoy_task_type_periodic == p->config.type)
+    {
+        s_eoy_task_loop_periodic(p);
+    }
+    else
+    {
+        s_eoy_task_loop_waiting(p);
+    }
+
+    s_eoy_task_running = NULL;
+
+    return(NULL);
+}
+
+
+// the loop of the event-driven, message-driven and callback-driven tasks
+static void s_eoy_task_loop_waiting(EOYtask *p)
+{
+    eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+    eOreltime_t tout = p->config.timeoutorperiod;
+    eOytask_item_t item = {NULL, NULL, 0, 0};
+    eOnanotime_t release = 0;
+    eOnanotime_t start = 0;
+    eOnanotime_t end = 0;
+    eObool_t timedout = eobool_false;
+    uint32_t evtmsg = 0;
+    struct timespec ts;
+    int r = 0;
+
+    pthread_mutex_lock(&l->mutex);
+
+    for(;;)
+    {
+        r = 0;
+        if(eok_reltimeINFINITE != tout)
+        {
+            s_eoy_task_abstime(&ts, s_eoy_task_now() + (eOnanotime_t)tout * 1000);
+        }
+
+        while((0 == ((eoy_task_type_eventdriven == p->config.type) ? (p->events) : (p->size))) && (eobool_false == p->quit) && (ETIMEDOUT != r))
+        {
+            r = (eok_reltimeINFINITE == tout) ? pthread_cond_wait(&l->notempty, &l->mutex) : pthread_cond_timedwait(&l->notempty, &l->mutex, &ts);
+        }
+
+        if(eobool_true == p->quit)
+        {
+            break;
+        }
+
+        timedout = eobool_false;
+        evtmsg = 0;
+
+        if(eoy_task_type_eventdriven == p->config.type)
+        {
+            timedout = (0 == p->events) ? (eobool_true) : (eobool_false);
+            evtmsg = p->events;
+            release = p->eventsarrival;
+            p->events = 0;
+        }
+        else if(0 != p->size)
+        {
+            item = p->queue[p->head];
+            p->head = (p->head + 1) % p->config.queuesize;
+            p->size--;
+            evtmsg = item.msg;
+            release = item.arrival;
+            pthread_cond_signal(&l->notfull);
+        }
+        else
+        {
+            timedout = eobool_true;
+        }
+
+        pthread_mutex_unlock(&l->mutex);
+
+        start = s_eoy_task_now();
+        if(eobool_true == timedout)
+        {
+            release = start;
+        }
+
+        if((eoy_task_type_callbackdriven == p->config.type) && (eobool_false == timedout))
+        {
+            item.cbk(item.arg);
+        }
+        else if(NULL != p->config.run)
+        {
+            p->config.run(p, evtmsg);
+        }
+
+        end = s_eoy_task_now();
+
+        pthread_mutex_lock(&l->mutex);
+        s_eoy_task_account(p, release, start, end, timedout);
+    }
+
+    pthread_mutex_unlock(&l->mutex);
+}
+
+
+// the activations are at absolute times: next is advanced by the period and not computed from the end of run(), thus
+// the period does not drift. if an activation ends after the following ones should have started, those are skipped.
+static void s_eoy_task_loop_periodic(EOYtask *p)
+{
+    eOytask_oslock_t *l = (eOytask_oslock_t*)p->oslock;
+    eOnanotime_t period = (eOnanotime_t)p->config.timeoutorperiod * 1000;
+    eOnanotime_t next = s_eoy_task_now() + period;
+    eOnanotime_t start = 0;
+    eOnanotime_t end = 0;
+    eOnanotime_t skipped = 0;
+    eOytask_item_t item = {NULL, NULL, 0, 0};
+    eOevent_t events = 0;
+    struct timespec ts;
+
+    for(;;)
+    {
+        s_eoy_task_abstime(&ts, next);
+        while(EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL));
+
+        start = s_eoy_task_now();
+
+        pthread_mutex_lock(&l->mutex);
+
+        if(eobool_true == p->quit)
+        {
+            break;
+        }
+
+        events = p->events;
+        p->events = 0;
+
+        // the callbacks sent to the task, e.g. by a EOaction or a EOtimer, are executed before run()
+        while(0 != p->size)
+        {
+            item = p->queue[p->head];
+            p->head = (p->head + 1) % p->config.queuesize;
+            p->size--;
+            pthread_cond_signal(&l->notfull);
+            pthread_mutex_unlock(&l->mutex);
+            item.cbk(item.arg);
+            pthread_mutex_lock(&l->mutex);
+        }
+
+        pthread_mutex_unlock(&l->mutex);
+
+        p->config.run(p, events);
+
+        end = s_eoy_task_now();
+
+        skipped = (end >= next + period) ? ((end - next - period) / period + 1) : (0);
+
+        pthread_mutex_lock(&l->mutex);
+        s_eoy_task_account(p, next, start, end, eobool_false);
+        p->stats.overruns += (uint32_t)skipped;
+        pthread_mutex_unlock(&l->mutex);
+
+        next += (skipped + 1) * period;
+    }
+
+    pthread_mutex_unlock(&l->mutex);
+}
+
+#endif
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTASK_H_
+#define _EOYTASK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOYtask.h
+    @brief      This header file implements public interface to a task of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+/** @defgroup eoy_task Object EOYtask
+    The EOYtask is derived from the abstract object EOVtask to give to the YARP execution environment (YEE) a task
+    which runs on its own thread, so that the objects which use a EOVtask (e.g., a EOaction or a EOtimer) can signal
+    it with eov_task_tskSetEvent(), eov_task_tskSendMessage() or eov_task_tskExecCallback(). From the thread of a
+    EOYtask, eov_sys_GetRunningTask() returns the task itself.
+
+    The task can be:
+    - event-driven: run() is called with the mask of the events set since the previous call, or with 0 if no event
+      arrives within the timeout.
+    - message-driven: run() is called once for every message, or with 0 if no message arrives within the timeout.
+    - callback-driven: the callbacks are executed in FIFO order. run(), which can be NULL, is called with 0 only if
+      no callback arrives within the timeout.
+    - periodic: run() is called every period with the mask of the events set since the previous call. Before run(),
+      the task executes the callbacks sent to it. The activations are at absolute times, thus the period does not
+      drift with the duration of run().
+
+    The thread can run with the SCHED_FIFO policy and be pinned to a cpu. If the process does not have the privileges
+    for SCHED_FIFO, the task runs with the default policy and a warning is sent to the EOtheErrorManager.
+
+    Every task measures its release latency: for a periodic task it is the delay of the wake up after the expected
+    activation time, for the other types the time between the arrival of the oldest pending event, message or callback
+    and the start of its processing. An activation misses its deadline if its processing ends later than the release
+    plus the deadline. Both the latencies and the amount of the misses are kept in log2 histograms.
+
+    The EOYtask is available only on Linux. Elsewhere eoy_task_New() issues a fatal error.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define EOYTASK_HISTOGRAM_bins          16
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct EOYtask_hid EOYtask
+    @brief      EOYtask is an opaque struct. It is used to implement data abstraction for the task
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOYtask_hid EOYtask;
+
+
+/** @typedef    typedef enum eOytask_type_t
+    @brief      The ways a EOYtask is activated.
+ **/
+typedef enum
+{
+    eoy_task_type_eventdriven       = 0,
+    eoy_task_type_messagedriven     = 1,
+    eoy_task_type_callbackdriven    = 2,
+    eoy_task_type_periodic          = 3
+} eOytask_type_t;
+
+
+/** @typedef    typedef void (*eOytask_fp_t)(EOYtask *tsk, uint32_t evtmsgper)
+    @brief      The startup() and run() functions of a EOYtask. startup() receives 0, run() receives the events, the
+                message or 0 as explained for eOytask_type_t.
+ **/
+typedef void (*eOytask_fp_t)(EOYtask *tsk, uint32_t evtmsgper);
+
+
+/** @typedef    typedef struct eOytask_cfg_t
+    @brief      eOytask_cfg_t contains the configuration of a EOYtask.
+ **/
+typedef struct
+{
+    eOytask_type_t  type;
+    uint8_t         priority;           /**< the SCHED_FIFO priority in [1, 99]. 0 uses the default policy */
+    int8_t          cpu;                /**< the cpu where the thread is pinned. -1 for no pinning */
+    uint16_t        queuesize;          /**< the capacity of the queue of messages or of callbacks. a periodic task with 0 rejects the callbacks with eores_NOK_unsupported */
+    eOreltime_t     timeoutorperiod;    /**< the period of a periodic task, otherwise the timeout of the wait (can be eok_reltimeINFINITE) */
+    eOreltime_t     deadline;           /**< the relative deadline. 0 means the period for a periodic task and no deadline for the others */
+    eOytask_fp_t    startup;            /**< called once by the thread before anything else. it can be NULL */
+    eOytask_fp_t    run;
+    void            *extdata;           /**< any data of the user, given by eoy_task_GetExternalData() */
+    const char      *name;              /**< the name of the thread. it can be NULL */
+} eOytask_cfg_t;
+
+
+/** @typedef    typedef struct eOytask_stats_t
+    @brief      eOytask_stats_t contains the statistics of a EOYtask. Bin 0 of a histogram counts the values below
+                1 micro-second, bin k the values in [2^(k-1), 2^k) micro-seconds, and the last bin also all the
+                bigger values.
+ **/
+typedef struct
+{
+    uint32_t        activations;        /**< the calls of run() or the executed callbacks */
+    uint32_t        timeouts;           /**< the calls of run() with 0 because of the timeout */
+    uint32_t        overruns;           /**< the periodic activations skipped because the previous one ended too late */
+    uint32_t        rejected;           /**< the messages or callbacks not queued because the queue was full */
+    uint32_t        deadlinemisses;
+    uint32_t        latencymax;         /**< in nano-seconds */
+    uint64_t        latencysum;         /**< in nano-seconds. divide by activations - timeouts to have the mean */
+    uint32_t        executionmax;       /**< the max duration of run() or of a callback in nano-seconds */
+    uint32_t        latency[EOYTASK_HISTOGRAM_bins];
+    uint32_t        miss[EOYTASK_HISTOGRAM_bins];   /**< by how much the deadline was missed */
+} eOytask_stats_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOYtask * eoy_task_New(const eOytask_cfg_t *cfg)
+    @brief      Creates a new task and starts its thread. It must be called after eoy_sys_Initialise().
+                The ids of the tasks are not reused, thus a process can create at most 240 tasks.
+    @param      cfg             The configuration.
+    @return     A not NULL handle to the task. In case of errors it is called the EOtheErrorManager.
+ **/
+extern EOYtask * eoy_task_New(const eOytask_cfg_t *cfg);
+
+
+/** @fn         extern void eoy_task_Delete(EOYtask *p)
+    @brief      Stops the thread of the task and deletes the task. It waits for the end of the current activation,
+                so that a periodic task stops within one period. It cannot be called from the task itself.
+    @param      p               The task.
+ **/
+extern void eoy_task_Delete(EOYtask *p);
+
+
+/** @fn         extern void * eoy_task_GetExternalData(EOYtask *p)
+    @brief      Gives the extdata of the configuration.
+    @param      p               The task.
+    @return     The extdata or NULL.
+ **/
+extern void * eoy_task_GetExternalData(EOYtask *p);
+
+
+/** @fn         extern eOresult_t eoy_task_Stats_Get(EOYtask *p, eOytask_stats_t *stats)
+    @brief      Gives the statistics since the creation or the last eoy_task_Stats_Reset().
+    @param      p               The task.
+    @param      stats           Where to copy the statistics.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_task_Stats_Get(EOYtask *p, eOytask_stats_t *stats);
+
+
+/** @fn         extern eOresult_t eoy_task_Stats_Reset(EOYtask *p)
+    @brief      Clears the statistics, for instance at the end of a warm-up.
+    @param      p               The task.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_task_Stats_Reset(EOYtask *p);
+
+
+
+/** @}
+    end of group eoy_task
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTASK_HID_H_
+#define _EOYTASK_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOYtask_hid.h
+    @brief      This header file implements hidden interface to a task of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtask.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOYtask.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+// an entry of the queue. cbk is used only by callback-driven and periodic tasks, msg only by message-driven ones
+typedef struct
+{
+    eOcallback_t                cbk;
+    void                        *arg;
+    eOmessage_t                 msg;
+    eOnanotime_t                arrival;
+} eOytask_item_t;
+
+
+/* @struct     EOYtask_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOYtask_hid
+{
+    // base object
+    EOVtask                     *tsk;
+
+    // other stuff
+    eOytask_cfg_t               config;
+    eOid08_t                    id;
+    void                        *oslock;        // the thread, the mutex and the condition variables
+    eOevent_t                   events;         // the events not yet given to run()
+    eOnanotime_t                eventsarrival;  // when the first of them was set
+    eOytask_item_t              *queue;         // config.queuesize items
+    uint16_t                    head;
+    uint16_t                    size;
+    eObool_t                    quit;
+    eOytask_stats_t             stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+
+/** @fn         extern EOYtask * eoy_task_hid_GetRunning(void)
+    @brief      Gives the EOYtask of the calling thread. It is used by EOYtheSystem for eov_sys_GetRunningTask().
+    @return     The task or NULL if the calling thread is not the one of a EOYtask.
+ **/
+extern EOYtask * eoy_task_hid_GetRunning(void);
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
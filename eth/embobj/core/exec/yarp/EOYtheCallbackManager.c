@@ -0,0 +1,663 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem.h"
+#include "EOVtheCallbackManager_hid.h"
+#include "EOVtask_hid.h"
+#include "EOYmutex.h"
+
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EOYCALLBACKMAN_USE_POSIX
+    #include <pthread.h>
+    #include <time.h>
+    #include <errno.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtheCallbackManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtheCallbackManager_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define EOYCALLBACKMAN_hash(p, cbk, arg)    ((uint32_t)(((((uint64_t)(uintptr_t)(cbk)) * 31 + (uint64_t)(uintptr_t)(arg)) * 0x9E3779B97F4A7C15ull) >> 32) & (p)->hashmask)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOycallbackman_cfg_t eoy_callbackman_DefaultCfg =
+{
+    EO_INIT(.workers)           1,
+    EO_INIT(.taskid)            3,
+    EO_INIT(.capacity)          256,
+    EO_INIT(.coalesce)          eobool_true
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+typedef struct
+{
+    pthread_mutex_t     mutex;
+    pthread_cond_t      notempty;       // signalled to the workers
+    pthread_cond_t      notfull;        // signalled to the submitters waiting for a free node
+    uint32_t            idle;           // the workers waiting on notempty
+    uint32_t            waiting;        // the submitters waiting on notfull
+} eOycallbackman_oslock_t;
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eoy_callbackman_execute(EOVtheCallbackManager *cm, eOcallback_t cbk, void *arg, uint32_t tout);
+static eOresult_t s_eoy_callbackman_task_isr_exec(void *t, eOcallback_t cbk, void *arg);
+static eOresult_t s_eoy_callbackman_task_tsk_exec(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout);
+static uint8_t s_eoy_callbackman_task_get_id(void *t);
+
+static void s_eoy_callbackman_lock(EOYtheCallbackManager *p);
+static void s_eoy_callbackman_unlock(EOYtheCallbackManager *p);
+static eObool_t s_eoy_callbackman_waitfornode(EOYtheCallbackManager *p, eOreltime_t tout, eOnanotime_t deadline);
+static void s_eoy_callbackman_wakeup(EOYtheCallbackManager *p, uint16_t number);
+
+static eOresult_t s_eoy_callbackman_push(EOYtheCallbackManager *p, eOcallback_t cbk, void *arg, uint8_t prio, eOnanotime_t now);
+static eOycallbackman_node_t * s_eoy_callbackman_pop(EOYtheCallbackManager *p);
+static void s_eoy_callbackman_done(EOYtheCallbackManager *p, eOycallbackman_node_t *n);
+static void s_eoy_callbackman_link(EOYtheCallbackManager *p, eOycallbackman_node_t *n);
+
+static void s_eoy_callbackman_workers_start(EOYtheCallbackManager *p);
+
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+static void * s_eoy_callbackman_worker(void *arg);
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOYtheCallbackManager";
+
+static EOYtheCallbackManager s_eoy_callbackman =
+{
+    EO_INIT(.cbkman)            NULL,
+    EO_INIT(.config)            {0},
+    EO_INIT(.task)              {NULL},
+    EO_INIT(.oslock)            NULL,
+    EO_INIT(.nodes)             NULL,
+    EO_INIT(.free)              NULL,
+    EO_INIT(.head)              {NULL},
+    EO_INIT(.tail)              {NULL},
+    EO_INIT(.hash)              NULL,
+    EO_INIT(.hashmask)          0,
+    EO_INIT(.depth)             0,
+    EO_INIT(.stats)             {0}
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOYtheCallbackManager * eoy_callbackman_Initialise(const eOycallbackman_cfg_t *cbkmancfg)
+{
+    EOYtheCallbackManager *p = &s_eoy_callbackman;
+    uint32_t i = 0;
+
+    if(NULL != p->cbkman)
+    {
+        // already initialised
+        return(p);
+    }
+
+    if(NULL == cbkmancfg)
+    {
+        cbkmancfg = &eoy_callbackman_DefaultCfg;
+    }
+
+    eo_errman_Assert(eo_errman_GetHandle(), NULL != eov_sys_GetHandle(), "eoy_callbackman_Initialise(): system not initialised", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), 0 != cbkmancfg->capacity, "eoy_callbackman_Initialise(): 0 capacity", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    memcpy(&p->config, cbkmancfg, sizeof(eOycallbackman_cfg_t));
+
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    {
+        eOycallbackman_oslock_t *l = (eOycallbackman_oslock_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOycallbackman_oslock_t), 1);
+        pthread_mutex_init(&l->mutex, NULL);
+        pthread_cond_init(&l->notempty, NULL);
+        pthread_cond_init(&l->notfull, NULL);
+        l->idle = 0;
+        l->waiting = 0;
+        p->oslock = l;
+    }
+#else
+    p->oslock = eoy_mutex_New();
+#endif
+
+    // the nodes are all allocated now and then recycled with a free list
+    p->nodes = (eOycallbackman_node_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOycallbackman_node_t), p->config.capacity);
+    for(i=0; i<p->config.capacity; i++)
+    {
+        p->nodes[i].next = (i+1 < p->config.capacity) ? (&p->nodes[i+1]) : (NULL);
+    }
+    p->free = &p->nodes[0];
+
+    if(eobool_true == p->config.coalesce)
+    {   // at least as many buckets as nodes so that the chains are short
+        for(i=1; i<p->config.capacity; i<<=1);
+        p->hash = (eOycallbackman_node_t**) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(eOycallbackman_node_t*), i);
+        memset(p->hash, 0, i * sizeof(eOycallbackman_node_t*));
+        p->hashmask = i - 1;
+    }
+
+    p->task.tsk = eov_task_hid_New();
+    eov_task_hid_SetVTABLE(p->task.tsk, NULL, NULL, NULL, NULL, NULL, NULL,
+                           s_eoy_callbackman_task_isr_exec, s_eoy_callbackman_task_tsk_exec,
+                           s_eoy_callbackman_task_get_id);
+
+    p->cbkman = eov_callbackman_hid_Initialise(s_eoy_callbackman_execute, &p->task);
+
+    if(0 != p->config.workers)
+    {
+        s_eoy_callbackman_workers_start(p);
+    }
+
+    return(p);
+}
+
+
+extern EOYtheCallbackManager* eoy_callbackman_GetHandle(void)
+{
+    return((NULL != s_eoy_callbackman.cbkman) ? (&s_eoy_callbackman) : (NULL));
+}
+
+
+extern eOresult_t eoy_callbackman_Execute(EOYtheCallbackManager *p, eOcallback_t cbk, void *arg, eOycallbackman_priority_t prio, eOreltime_t tout)
+{
+    eOycallbackman_item_t item;
+
+    if((NULL == p) || (NULL == cbk))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    item.cbk = cbk;
+    item.arg = arg;
+    item.priority = (uint8_t)prio;
+
+    return((1 == eoy_callbackman_ExecuteN(p, &item, 1, tout)) ? (eores_OK) : (eores_NOK_timeout));
+}
+
+
+extern uint16_t eoy_callbackman_ExecuteN(EOYtheCallbackManager *p, const eOycallbackman_item_t *items, uint16_t number, eOreltime_t tout)
+{
+    eOnanotime_t now = 0;
+    uint16_t i = 0;
+    uint16_t accepted = 0;
+    uint16_t queued = 0;
+    eOresult_t res = eores_OK;
+
+    if((NULL == p) || (NULL == items) || (0 == number))
+    {
+        return(0);
+    }
+
+    // a single timestamp for the whole batch
+    eov_sys_NanoTimeGet(eov_sys_GetHandle(), &now);
+
+    s_eoy_callbackman_lock(p);
+
+    for(i=0; i<number; i++)
+    {
+        if(NULL == items[i].cbk)
+        {
+            continue;
+        }
+
+        res = s_eoy_callbackman_push(p, items[i].cbk, items[i].arg, items[i].priority, now);
+
+        if(eores_NOK_busy == res)
+        {   // full: we wake up the workers for what we have queued so far and we wait
+            s_eoy_callbackman_wakeup(p, queued);
+            queued = 0;
+            if(eobool_false == s_eoy_callbackman_waitfornode(p, tout, now + (eOnanotime_t)tout * 1000))
+            {   // this item and all the following ones are not queued
+                p->stats.rejected += (number - i);
+                break;
+            }
+            res = s_eoy_callbackman_push(p, items[i].cbk, items[i].arg, items[i].priority, now);
+        }
+
+        accepted++;
+        if(eores_OK == res)
+        {
+            queued++;
+        }
+    }
+
+    s_eoy_callbackman_wakeup(p, queued);
+
+    s_eoy_callbackman_unlock(p);
+
+    return(accepted);
+}
+
+
+extern uint16_t eoy_callbackman_Process(EOYtheCallbackManager *p, uint16_t maxnumber)
+{
+    eOycallbackman_node_t *n = NULL;
+    eOcallback_t cbk = NULL;
+    void *arg = NULL;
+    uint16_t executed = 0;
+
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    s_eoy_callbackman_lock(p);
+
+    while(((0 == maxnumber) || (executed < maxnumber)) && (NULL != (n = s_eoy_callbackman_pop(p))))
+    {
+        cbk = n->cbk;
+        arg = n->arg;
+        s_eoy_callbackman_unlock(p);
+        cbk(arg);
+        executed++;
+        s_eoy_callbackman_lock(p);
+        s_eoy_callbackman_done(p, n);
+    }
+
+    s_eoy_callbackman_unlock(p);
+
+    return(executed);
+}
+
+
+extern eOresult_t eoy_callbackman_Stats_Get(EOYtheCallbackManager *p, eOycallbackman_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    s_eoy_callbackman_lock(p);
+    memcpy(stats, &p->stats, sizeof(eOycallbackman_stats_t));
+    s_eoy_callbackman_unlock(p);
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eoy_callbackman_execute(EOVtheCallbackManager *cm, eOcallback_t cbk, void *arg, uint32_t tout)
+{
+    return(eoy_callbackman_Execute(&s_eoy_callbackman, cbk, arg, eoy_callbackman_prio_normal, tout));
+}
+
+
+static eOresult_t s_eoy_callbackman_task_isr_exec(void *t, eOcallback_t cbk, void *arg)
+{
+    return(eoy_callbackman_Execute(&s_eoy_callbackman, cbk, arg, eoy_callbackman_prio_normal, eok_reltimeZERO));
+}
+
+
+static eOresult_t s_eoy_callbackman_task_tsk_exec(void *t, eOcallback_t cbk, void *arg, eOreltime_t tout)
+{
+    return(eoy_callbackman_Execute(&s_eoy_callbackman, cbk, arg, eoy_callbackman_prio_normal, tout));
+}
+
+
+static uint8_t s_eoy_callbackman_task_get_id(void *t)
+{
+    return(s_eoy_callbackman.config.taskid);
+}
+
+
+static void s_eoy_callbackman_lock(EOYtheCallbackManager *p)
+{
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    pthread_mutex_lock(&((eOycallbackman_oslock_t*)p->oslock)->mutex);
+#else
+    eoy_mutex_Take((EOYmutex*)p->oslock, eok_reltimeINFINITE);
+#endif
+}
+
+
+static void s_eoy_callbackman_unlock(EOYtheCallbackManager *p)
+{
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    pthread_mutex_unlock(&((eOycallbackman_oslock_t*)p->oslock)->mutex);
+#else
+    eoy_mutex_Release((EOYmutex*)p->oslock);
+#endif
+}
+
+
+// called with the lock taken. it returns eobool_true if there is a free node before the deadline
+static eObool_t s_eoy_callbackman_waitfornode(EOYtheCallbackManager *p, eOreltime_t tout, eOnanotime_t deadline)
+{
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    eOycallbackman_oslock_t *l = (eOycallbackman_oslock_t*)p->oslock;
+    eOnanotime_t now = 0;
+    struct timespec ts;
+    int r = 0;
+
+    if(eok_reltimeZERO == tout)
+    {
+        return((NULL != p->free) ? (eobool_true) : (eobool_false));
+    }
+
+    while((NULL == p->free) && (ETIMEDOUT != r))
+    {
+        l->waiting++;
+        if(eok_reltimeINFINITE == tout)
+        {
+            r = pthread_cond_wait(&l->notfull, &l->mutex);
+        }
+        else
+        {   // the condition variable uses the realtime clock, thus we convert the remaining time
+            eov_sys_NanoTimeGet(eov_sys_GetHandle(), &now);
+            now = (now < deadline) ? (deadline - now) : (0);
+            clock_gettime(CLOCK_REALTIME, &ts);
+            now += (eOnanotime_t)ts.tv_nsec;
+            ts.tv_sec += (time_t)(now / 1000000000);
+            ts.tv_nsec = (long)(now % 1000000000);
+            r = pthread_cond_timedwait(&l->notfull, &l->mutex, &ts);
+        }
+        l->waiting--;
+    }
+
+    return((NULL != p->free) ? (eobool_true) : (eobool_false));
+#else
+    return((NULL != p->free) ? (eobool_true) : (eobool_false));
+#endif
+}
+
+
+// called with the lock taken. a single submission wakes a single idle worker, a batch wakes them all
+static void s_eoy_callbackman_wakeup(EOYtheCallbackManager *p, uint16_t number)
+{
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    eOycallbackman_oslock_t *l = (eOycallbackman_oslock_t*)p->oslock;
+
+    if((0 == number) || (0 == l->idle))
+    {
+        return;
+    }
+
+    if(1 == number)
+    {
+        pthread_cond_signal(&l->notempty);
+    }
+    else
+    {
+        pthread_cond_broadcast(&l->notempty);
+    }
+#endif
+}
+
+
+// called with the lock taken. it returns eores_NOK_busy if the queue is full
+static eOresult_t s_eoy_callbackman_push(EOYtheCallbackManager *p, eOcallback_t cbk, void *arg, uint8_t prio, eOnanotime_t now)
+{
+    eOycallbackman_node_t *n = NULL;
+    uint32_t h = 0;
+
+    if(prio >= eoy_callbackman_priorities_numberof)
+    {
+        prio = eoy_callbackman_prio_low;
+    }
+
+    if(NULL != p->hash)
+    {
+        h = EOYCALLBACKMAN_hash(p, cbk, arg);
+        for(n=p->hash[h]; (NULL != n) && ((cbk != n->cbk) || (arg != n->arg)); n=n->hnext);
+
+        if((NULL != n) && (EOYCALLBACKMAN_NODE_running != n->state))
+        {   // already queued: the callback will see the effects of both the submissions
+            p->stats.coalesced++;
+            return(eores_OK);
+        }
+    }
+
+    if(NULL != n)
+    {   // it is running and it may have already read its data: it goes back in the queue when it returns
+        n->state = EOYCALLBACKMAN_NODE_requeued;
+        n->priority = prio;
+        n->submitted = now;
+    }
+    else
+    {
+        if(NULL == (n = p->free))
+        {
+            return(eores_NOK_busy);
+        }
+        p->free = n->next;
+
+        n->cbk = cbk;
+        n->arg = arg;
+        n->submitted = now;
+        n->priority = prio;
+        n->state = EOYCALLBACKMAN_NODE_queued;
+        s_eoy_callbackman_link(p, n);
+
+        if(NULL != p->hash)
+        {
+            n->hnext = p->hash[h];
+            p->hash[h] = n;
+        }
+    }
+
+    p->depth++;
+    p->stats.submitted++;
+    if(p->depth > p->stats.maxdepth)
+    {
+        p->stats.maxdepth = p->depth;
+    }
+
+    return(eores_OK);
+}
+
+
+// called with the lock taken. it removes the first node of the highest priority from the queue. the node must be
+// given to s_eoy_callbackman_done() after its callback has returned.
+static eOycallbackman_node_t * s_eoy_callbackman_pop(EOYtheCallbackManager *p)
+{
+    eOycallbackman_node_t *n = NULL;
+    eOnanotime_t now = 0;
+    uint8_t prio = 0;
+
+    for(prio=0; prio<eoy_callbackman_priorities_numberof; prio++)
+    {
+        if(NULL != (n = p->head[prio]))
+        {
+            break;
+        }
+    }
+
+    if(NULL == n)
+    {
+        return(NULL);
+    }
+
+    p->head[prio] = n->next;
+    if(NULL == p->head[prio])
+    {
+        p->tail[prio] = NULL;
+    }
+
+    // it stays in the hash, so that a new submission of the same callback+arg waits for its return
+    n->state = EOYCALLBACKMAN_NODE_running;
+
+    eov_sys_NanoTimeGet(eov_sys_GetHandle(), &now);
+    now = (now > n->submitted) ? (now - n->submitted) : (0);
+    p->stats.latencysum += now;
+    if(now > p->stats.latencymax)
+    {
+        p->stats.latencymax = now;
+    }
+    p->stats.executed++;
+    p->depth--;
+
+    return(n);
+}
+
+
+// called with the lock taken after the callback of a node given by s_eoy_callbackman_pop() has returned
+static void s_eoy_callbackman_done(EOYtheCallbackManager *p, eOycallbackman_node_t *n)
+{
+    eOycallbackman_node_t **pn = NULL;
+
+    if(EOYCALLBACKMAN_NODE_requeued == n->state)
+    {   // submitted again while running: it goes back in the queue with the same node
+        n->state = EOYCALLBACKMAN_NODE_queued;
+        s_eoy_callbackman_link(p, n);
+        s_eoy_callbackman_wakeup(p, 1);
+        return;
+    }
+
+    if(NULL != p->hash)
+    {   // from now on the same callback+arg can be queued again
+        for(pn=&p->hash[EOYCALLBACKMAN_hash(p, n->cbk, n->arg)]; *pn != n; pn=&(*pn)->hnext);
+        *pn = n->hnext;
+    }
+
+    n->next = p->free;
+    p->free = n;
+
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    if(0 != ((eOycallbackman_oslock_t*)p->oslock)->waiting)
+    {
+        pthread_cond_signal(&((eOycallbackman_oslock_t*)p->oslock)->notfull);
+    }
+#endif
+}
+
+
+// called with the lock taken. it appends the node to the queue of its priority
+static void s_eoy_callbackman_link(EOYtheCallbackManager *p, eOycallbackman_node_t *n)
+{
+    n->next = NULL;
+
+    if(NULL == p->tail[n->priority])
+    {
+        p->head[n->priority] = n;
+    }
+    else
+    {
+        p->tail[n->priority]->next = n;
+    }
+    p->tail[n->priority] = n;
+}
+
+
+static void s_eoy_callbackman_workers_start(EOYtheCallbackManager *p)
+{
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+    pthread_t thread;
+    uint8_t i = 0;
+
+    for(i=0; i<p->config.workers; i++)
+    {
+        if(0 != pthread_create(&thread, NULL, s_eoy_callbackman_worker, p))
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eoy_callbackman_Initialise(): cannot start a worker thread", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            return;
+        }
+        pthread_detach(thread);
+    }
+#else
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eoy_callbackman_Initialise(): no workers. call eoy_callbackman_Process()", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+#endif
+}
+
+
+#if defined(EOYCALLBACKMAN_USE_POSIX)
+static void * s_eoy_callbackman_worker(void *arg)
+{
+    EOYtheCallbackManager *p = (EOYtheCallbackManager*)arg;
+    eOycallbackman_oslock_t *l = (eOycallbackman_oslock_t*)p->oslock;
+    eOycallbackman_node_t *n = NULL;
+    eOcallback_t cbk = NULL;
+    void *cbkarg = NULL;
+
+    pthread_mutex_lock(&l->mutex);
+
+    for(;;)
+    {
+        while(NULL == (n = s_eoy_callbackman_pop(p)))
+        {
+            l->idle++;
+            pthread_cond_wait(&l->notempty, &l->mutex);
+            l->idle--;
+        }
+
+        cbk = n->cbk;
+        cbkarg = n->arg;
+        pthread_mutex_unlock(&l->mutex);
+        cbk(cbkarg);
+        pthread_mutex_lock(&l->mutex);
+        s_eoy_callbackman_done(p, n);
+    }
+
+    return(NULL);
+}
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTHECALLBACKMANAGER_H_
+#define _EOYTHECALLBACKMANAGER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOYtheCallbackManager.h
+    @brief      This header file implements public interface to the callback manager singleton of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+/** @defgroup eoy_thecallbackmanager Singleton EOYtheCallbackManager
+    The EOYtheCallbackManager is derived from the abstract object EOVtheCallbackManager to execute callbacks in the
+    YARP execution environment (YEE). Its task, given by eov_callbackman_GetTask(), does not run any code by itself:
+    a callback sent to it with eov_task_tskExecCallback() (as done by a EOaction of callback type) is put inside a
+    queue which is emptied by a pool of worker threads.
+
+    The queue has three priorities and it is FIFO inside the same priority. Many callbacks can be submitted at once
+    with eoy_callbackman_ExecuteN(), which takes the lock and wakes up the workers only once. If coalescing is enabled,
+    a callback with the same function and argument of another one which is still in the queue is not queued again,
+    and the queued one keeps its position. If instead the other one is already running, the callback is queued again
+    only once its execution returns, so that it sees the effects of the submission and it never runs twice at the
+    same time. The time spent inside the queue is measured and reported by eoy_callbackman_Stats_Get().
+
+    The default configuration has one worker, which executes the callbacks one at a time as the single callback
+    task of the other execution environments does. With more than one worker the callbacks run concurrently with
+    each other, thus the data they share must be protected by the application.
+
+    The worker threads are available only on POSIX systems. If the configuration has zero workers, the application
+    must call eoy_callbackman_Process() on its own.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef enum eOycallbackman_priority_t
+    @brief      The priorities of the callbacks. A callback of higher priority is always taken before one of lower priority.
+ **/
+typedef enum
+{
+    eoy_callbackman_prio_high       = 0,
+    eoy_callbackman_prio_normal     = 1,    /**< used by eov_callbackman_Execute() and by eov_task_tskExecCallback() */
+    eoy_callbackman_prio_low        = 2
+} eOycallbackman_priority_t;
+
+enum { eoy_callbackman_priorities_numberof = 3 };
+
+
+/** @typedef    typedef struct eOycallbackman_cfg_t
+    @brief      eOycallbackman_cfg_t contains the configuration of the EOYtheCallbackManager.
+ **/
+typedef struct
+{
+    uint8_t         workers;        /**< the number of worker threads. if 0, the application calls eoy_callbackman_Process(). if more than 1, the callbacks run concurrently */
+    eOid08_t        taskid;         /**< the id returned by eov_task_GetID() for the task of the callback manager */
+    uint16_t        capacity;       /**< the max number of callbacks inside the queue or running */
+    eObool_t        coalesce;       /**< if eobool_true, a callback+arg already inside the queue is not queued again and one which is running is queued again only when it returns */
+} eOycallbackman_cfg_t;
+
+
+/** @typedef    typedef struct eOycallbackman_item_t
+    @brief      eOycallbackman_item_t is a callback to be submitted with eoy_callbackman_ExecuteN().
+ **/
+typedef struct
+{
+    eOcallback_t    cbk;
+    void            *arg;
+    uint8_t         priority;       /**< use eOycallbackman_priority_t */
+} eOycallbackman_item_t;
+
+
+/** @typedef    typedef struct eOycallbackman_stats_t
+    @brief      eOycallbackman_stats_t contains the statistics of the EOYtheCallbackManager. The latency is the time
+                between the submission of a callback and the start of its execution.
+ **/
+typedef struct
+{
+    uint32_t        submitted;      /**< the callbacks put inside the queue */
+    uint32_t        coalesced;      /**< the callbacks not queued because already inside the queue or already queued again after their execution */
+    uint32_t        rejected;       /**< the callbacks not queued because the queue was full, also those of eoy_callbackman_ExecuteN() after the first one rejected */
+    uint32_t        executed;       /**< the callbacks taken from the queue */
+    uint32_t        maxdepth;       /**< the max number of callbacks which have been inside the queue */
+    uint64_t        latencysum;     /**< the sum of the latencies in nano-seconds. divide by executed to have the mean */
+    uint64_t        latencymax;     /**< the max latency in nano-seconds */
+} eOycallbackman_stats_t;
+
+
+/** @typedef    typedef struct EOYtheCallbackManager_hid EOYtheCallbackManager
+    @brief      EOYtheCallbackManager is an opaque struct. It is used to implement data abstraction for the callback
+                manager object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOYtheCallbackManager_hid EOYtheCallbackManager;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOycallbackman_cfg_t eoy_callbackman_DefaultCfg; // = { 1, 3, 256, eobool_true };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOYtheCallbackManager * eoy_callbackman_Initialise(const eOycallbackman_cfg_t *cbkmancfg)
+    @brief      Initialises the singleton EOYtheCallbackManager and starts its worker threads. It must be called after
+                eoy_sys_Initialise().
+    @param      cbkmancfg       The configuration. If NULL, it is used eoy_callbackman_DefaultCfg.
+    @return     A not NULL handle to the singleton. In case of errors it is called the EOtheErrorManager.
+ **/
+extern EOYtheCallbackManager * eoy_callbackman_Initialise(const eOycallbackman_cfg_t *cbkmancfg);
+
+
+/** @fn         extern EOYtheCallbackManager* eoy_callbackman_GetHandle(void)
+    @brief      Returns an handle to the singleton EOYtheCallbackManager. The singleton must have been initialised
+                with eoy_callbackman_Initialise(), otherwise this function call will return NULL.
+    @return     The pointer to the required EOYtheCallbackManager (or NULL upon in-initialised singleton).
+ **/
+extern EOYtheCallbackManager* eoy_callbackman_GetHandle(void);
+
+
+/** @fn         extern eOresult_t eoy_callbackman_Execute(EOYtheCallbackManager *p, eOcallback_t cbk, void *arg, eOycallbackman_priority_t prio, eOreltime_t tout)
+    @brief      Submits a callback to the workers.
+    @param      p               The handle to the singleton.
+    @param      cbk             The callback.
+    @param      arg             The argument of the callback.
+    @param      prio            The priority.
+    @param      tout            How long to wait for a free place if the queue is full.
+    @return     eores_OK if queued or coalesced, eores_NOK_nullpointer if p or cbk are NULL, eores_NOK_timeout if
+                the queue is still full after tout.
+ **/
+extern eOresult_t eoy_callbackman_Execute(EOYtheCallbackManager *p, eOcallback_t cbk, void *arg, eOycallbackman_priority_t prio, eOreltime_t tout);
+
+
+/** @fn         extern uint16_t eoy_callbackman_ExecuteN(EOYtheCallbackManager *p, const eOycallbackman_item_t *items, uint16_t number, eOreltime_t tout)
+    @brief      Submits many callbacks with a single lock of the queue and a single wake-up of the workers. The items
+                are queued in order and it stops at the first one which does not find place within tout.
+    @param      p               The handle to the singleton.
+    @param      items           The callbacks.
+    @param      number          The number of items.
+    @param      tout            How long to wait for a free place if the queue is full. It is the total time for
+                                all the items.
+    @return     The number of items queued or coalesced.
+ **/
+extern uint16_t eoy_callbackman_ExecuteN(EOYtheCallbackManager *p, const eOycallbackman_item_t *items, uint16_t number, eOreltime_t tout);
+
+
+/** @fn         extern uint16_t eoy_callbackman_Process(EOYtheCallbackManager *p, uint16_t maxnumber)
+    @brief      Executes in the context of the caller the callbacks inside the queue. It is meant for a configuration
+                with zero workers, but it can be used also together with the workers.
+    @param      p               The handle to the singleton.
+    @param      maxnumber       The max number of callbacks to execute. 0 means all of them.
+    @return     The number of executed callbacks.
+ **/
+extern uint16_t eoy_callbackman_Process(EOYtheCallbackManager *p, uint16_t maxnumber);
+
+
+/** @fn         extern eOresult_t eoy_callbackman_Stats_Get(EOYtheCallbackManager *p, eOycallbackman_stats_t *stats)
+    @brief      Gives the statistics since the initialisation.
+    @param      p               The handle to the singleton.
+    @param      stats           Where to copy the statistics.
+    @return     eores_OK or eores_NOK_nullpointer.
+ **/
+extern eOresult_t eoy_callbackman_Stats_Get(EOYtheCallbackManager *p, eOycallbackman_stats_t *stats);
+
+
+
+/** @}
+    end of group eoy_thecallbackmanager
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
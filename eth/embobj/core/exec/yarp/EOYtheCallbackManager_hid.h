@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTHECALLBACKMANAGER_HID_H_
+#define _EOYTHECALLBACKMANAGER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOYtheCallbackManager_hid.h
+    @brief      This header file implements hidden interface to the callback manager singleton of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtheCallbackManager.h"
+#include "EOVtask.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOYtheCallbackManager.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+// the states of a node taken from the free list
+#define EOYCALLBACKMAN_NODE_queued      0
+#define EOYCALLBACKMAN_NODE_running     1
+#define EOYCALLBACKMAN_NODE_requeued    2
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct eOycallbackman_node_T eOycallbackman_node_t;
+
+// a queued callback. next links the nodes of the same priority (or the free nodes), hnext those with the same hash
+// of callback and argument. a node stays in the hash also while its callback runs, and it goes back to the free
+// list only when the callback returns.
+struct eOycallbackman_node_T
+{
+    eOycallbackman_node_t       *next;
+    eOycallbackman_node_t       *hnext;
+    eOcallback_t                cbk;
+    void                        *arg;
+    eOnanotime_t                submitted;
+    uint8_t                     priority;
+    uint8_t                     state;          // use EOYCALLBACKMAN_NODE_*
+};
+
+// the derived object given as task to the EOVtheCallbackManager
+typedef struct
+{
+    EOVtask                     *tsk;
+} eOycallbackman_task_t;
+
+
+/* @struct     EOYtheCallbackManager_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOYtheCallbackManager_hid
+{
+    // base object
+    EOVtheCallbackManager       *cbkman;
+
+    // other stuff
+    eOycallbackman_cfg_t        config;
+    eOycallbackman_task_t       task;
+    void                        *oslock;        // the mutex and the condition variables of the queue
+    eOycallbackman_node_t       *nodes;         // config.capacity nodes
+    eOycallbackman_node_t       *free;
+    eOycallbackman_node_t       *head[eoy_callbackman_priorities_numberof];
+    eOycallbackman_node_t       *tail[eoy_callbackman_priorities_numberof];
+    eOycallbackman_node_t       **hash;         // hashmask+1 buckets
+    uint32_t                    hashmask;
+    uint32_t                    depth;          // number of queued callbacks
+    eOycallbackman_stats_t      stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -45,6 +45,8 @@
 
 #include "EOtheErrorManager.h"
 #include "EOVtheSystem_hid.h" 
+#include "EOYmutex_hid.h"
+#include "EOYtask_hid.h"
 
 #if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
     #if !defined(_MSC_VER)
@@ -54,11 +56,13 @@
 
 
 
-#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
-  #if   defined(EO_TAILOR_CODE_FOR_LINUX)
-  #include <time.h>
-  #include <sys/time.h>
-  #endif
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EOY_SYS_USE_POSIX_CLOCK
+    #include <time.h>
+    #if defined(__x86_64__)
+        #define EOY_SYS_USE_TSC
+        #include <x86intrin.h>
+    #endif
 #endif
 
 
@@ -79,7 +83,15 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#define EOY_SYS_TSC_calibration_ns      (20*1000*1000)
+
+// the default configuration must not use s_dummy_timeget() as a clock, which advances 10 ms at every call
+#if defined(EOY_SYS_USE_POSIX_CLOCK)
+    #define EOY_SYS_default_clock       eoy_sys_clock_monotonic
+#else
+    #define EOY_SYS_default_clock       eoy_sys_clock_timeget
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -92,7 +104,15 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#if defined(EOY_SYS_USE_TSC)
+typedef struct
+{
+    uint64_t    start;          // the tsc at the end of the calibration
+    uint64_t    nsstart;        // CLOCK_MONOTONIC at the end of the calibration
+    uint64_t    mult;           // nanoseconds per tsc tick, multiplied by 2^32
+} eOysys_tsc_t;
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -110,10 +130,17 @@ static void s_eoy_sys_abstime_set(eOabstime_t time);
 static eOnanotime_t s_eoy_sys_nanotime_get(void);
 static void s_eoy_sys_stop(void);
 
-#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
-#if   defined(EO_TAILOR_CODE_FOR_LINUX)
-static int s_timeval_subtract(struct timespec *_result, struct timespec *_x, struct timespec *_y);
+static eOuint64_fp_void_t s_eoy_sys_clock_select(eOysystem_clock_t clock);
+
+#if defined(EOY_SYS_USE_POSIX_CLOCK)
+static uint64_t s_eoy_sys_clock_monotonic(void);
+static uint64_t s_eoy_sys_clock_monotonicraw(void);
 #endif
+
+#if defined(EOY_SYS_USE_TSC)
+static uint64_t s_eoy_sys_clock_tsc(void);
+static void s_eoy_sys_clock_tsc_calibrate(void);
+static void s_eoy_sys_clock_tsc_pair(uint64_t *ns, uint64_t *tsc);
 #endif
 
 static double s_dummy_timeget() { static uint64_t t = 0; return ++t * 0.01; }
@@ -133,12 +160,14 @@ static const eOysystem_cfg_t s_eoy_sys_defaultconfig =
 {
     EO_INIT(.timeget)        s_dummy_timeget,
     EO_INIT(.mutexcfg)
-    {
-        EO_INIT(.fp_new)        s_dummy_mtx_new,
-        EO_INIT(.fp_take)       s_dummy_mtx_take,
-        EO_INIT(.fp_release)    s_dummy_mtx_release,
-        EO_INIT(.fp_delete)     s_dummy_mtx_delete
-    }
+    {   // the built-in mutex, if any, otherwise the dummy one
+        EO_INIT(.fp_new)        NULL,
+        EO_INIT(.fp_take)       NULL,
+        EO_INIT(.fp_release)    NULL,
+        EO_INIT(.fp_delete)     NULL
+    },
+    EO_INIT(.clock)          EOY_SYS_default_clock,
+    EO_INIT(.nanotimeget)    NULL
 };
 
 static EOYtheSystem s_eoy_system = 
@@ -147,13 +176,13 @@ static EOYtheSystem s_eoy_system =
 
     EO_INIT(.config)            {0},
     EO_INIT(.user_init_fn)      NULL,
-    EO_INIT(.start)             0
+    EO_INIT(.start)             0,
+    EO_INIT(.nanoget)           NULL,
+    EO_INIT(.startns)           0
 };
 
-#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
-#if   defined(EO_TAILOR_CODE_FOR_LINUX)
-static struct timespec s_eoy_sys_linux_start_time;
-#endif
+#if defined(EOY_SYS_USE_TSC)
+static eOysys_tsc_t s_eoy_sys_tsc = { 0, 0, 0 };
 #endif
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -183,6 +212,13 @@ extern EOYtheSystem * eoy_sys_Initialise(const eOysystem_cfg_t *syscfg,
         s_eoy_system.config.timeget = s_dummy_timeget;
     }
 
+    if((NULL == s_eoy_system.config.mutexcfg.fp_new) && (NULL == s_eoy_system.config.mutexcfg.fp_take) &&
+       (NULL == s_eoy_system.config.mutexcfg.fp_release) && (NULL == s_eoy_system.config.mutexcfg.fp_delete) &&
+       (NULL != eoy_mutex_hid_builtin_cfg_get()))
+    {   // no mutex at all: we use the built-in one
+        memmove(&s_eoy_system.config.mutexcfg, eoy_mutex_hid_builtin_cfg_get(), sizeof(s_eoy_system.config.mutexcfg));
+    }
+
     if(NULL == s_eoy_system.config.mutexcfg.fp_new)
     {
         s_eoy_system.config.mutexcfg.fp_new = s_dummy_mtx_new;
@@ -214,16 +250,25 @@ extern EOYtheSystem * eoy_sys_Initialise(const eOysystem_cfg_t *syscfg,
 
 
     // initialise y-environment
-    
-#if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
-    s_eoy_system.start = s_eoy_system.config.timeget();
-#else
 
-#if   defined(EO_TAILOR_CODE_FOR_LINUX)
-  clock_gettime(CLOCK_REALTIME, &s_eoy_sys_linux_start_time);
+#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
+    // w/out the feature interface there is no timeget() from yarp, thus we use the monotonic clock
+    if(eoy_sys_clock_timeget == s_eoy_system.config.clock)
+    {
+        s_eoy_system.config.clock = eoy_sys_clock_monotonic;
+    }
 #endif
 
-#endif
+    s_eoy_system.nanoget = s_eoy_sys_clock_select(s_eoy_system.config.clock);
+
+    if(NULL != s_eoy_system.nanoget)
+    {
+        s_eoy_system.startns = s_eoy_system.nanoget();
+    }
+    else
+    {
+        s_eoy_system.start = s_eoy_system.config.timeget();
+    }
 
     return(&s_eoy_system);  
 }
@@ -291,55 +336,54 @@ static void s_eoy_thecreation(void)
 
 static EOVtaskDerived* s_eoy_sys_gettask(void)
 {
-    return(NULL);
+    // NULL if the caller is not the thread of a EOYtask
+    return(eoy_task_hid_GetRunning());
 }
 
 static eOabstime_t s_eoy_sys_abstime_get(void)
 {
-    eOabstime_t time = 0xEABABABABABABABF;
+    eOabstime_t time = 0;
+    double delta = 0;
 
-#if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
+    if(NULL != s_eoy_system.nanoget)
+    {
+        return((s_eoy_system.nanoget() - s_eoy_system.startns) / 1000);
+    }
 
-    double delta = s_eoy_system.config.timeget() - s_eoy_system.start;
+    delta = s_eoy_system.config.timeget() - s_eoy_system.start;
 
     delta *= (1e6);
     time = (eOabstime_t)floor(delta);
 
-
-#else//defined(EOY_SYS_USE_FEATURE_INTERFACE)
-
-#if   defined(EO_TAILOR_CODE_FOR_LINUX)
-    struct timespec curr_time, diff;
-    clock_gettime(CLOCK_REALTIME, &curr_time);
-    s_timeval_subtract(&diff, &curr_time, &s_eoy_sys_linux_start_time);
-    time = ((diff.tv_sec * 1000 * 1000) + (diff.tv_nsec/1000));
-#endif
-
-#endif//defined(EOY_SYS_USE_FEATURE_INTERFACE)
-
     return(time);
 }
 
 
 static void s_eoy_sys_abstime_set(eOabstime_t time)
 {
-#if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
+    if(NULL != s_eoy_system.nanoget)
+    {
+        s_eoy_system.startns = s_eoy_system.nanoget() - (time * 1000);
+        return;
+    }
+
     s_eoy_system.start = ((double) time)/ 1e6;
-#else
-    // do nothing ...
-#endif
 }
 
 
 static eOnanotime_t s_eoy_sys_nanotime_get(void)
 {
     eOnanotime_t nanotime = 0;
+    double delta = 0;
 
-#if     defined(EOY_SYS_USE_FEATURE_INTERFACE)
-    double delta = s_eoy_system.config.timeget() - s_eoy_system.start;
+    if(NULL != s_eoy_system.nanoget)
+    {
+        return(s_eoy_system.nanoget() - s_eoy_system.startns);
+    }
+
+    delta = s_eoy_system.config.timeget() - s_eoy_system.start;
     delta *= 1e9;
     nanotime = (eOnanotime_t)floor(delta);
-#endif
 
     return(nanotime);
 }
@@ -351,44 +395,131 @@ static void s_eoy_sys_stop(void)
 
 
 
-#if     !defined(EOY_SYS_USE_FEATURE_INTERFACE)
-
-#if   defined(EO_TAILOR_CODE_FOR_LINUX)
-// risultato= stop - start, cioè _result = _x - _y
-static int s_timeval_subtract(struct timespec *_result, struct timespec *_x, struct timespec *_y)
+static eOuint64_fp_void_t s_eoy_sys_clock_select(eOysystem_clock_t clock)
 {
-	//difftime();
-	/* Perform the carry for the later subtraction by updating y. */
-	static const long int MULTIPLIER = 1000 * 1000 * 1000;
+    eOuint64_fp_void_t nanoget = NULL;
 
-	if(_x->tv_nsec < _y->tv_nsec)
-	{
-		int nsec = (_y->tv_nsec - _x->tv_nsec) / MULTIPLIER + 1;
+    switch(clock)
+    {
+        case eoy_sys_clock_nanotimeget:
+        {
+            eo_errman_Assert(eo_errman_GetHandle(), NULL != s_eoy_system.config.nanotimeget, "eoy_sys_Initialise(): eoy_sys_clock_nanotimeget needs a nanotimeget()", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+            nanoget = s_eoy_system.config.nanotimeget;
+        } break;
+
+#if defined(EOY_SYS_USE_POSIX_CLOCK)
+        case eoy_sys_clock_monotonic:
+        {
+            nanoget = s_eoy_sys_clock_monotonic;
+        } break;
+
+        case eoy_sys_clock_monotonicraw:
+        {
+            nanoget = s_eoy_sys_clock_monotonicraw;
+        } break;
+
+        case eoy_sys_clock_tsc:
+        {
+#if defined(EOY_SYS_USE_TSC)
+            s_eoy_sys_clock_tsc_calibrate();
+            nanoget = s_eoy_sys_clock_tsc;
+#else
+            nanoget = s_eoy_sys_clock_monotonic;
+#endif
+        } break;
+#endif
 
-		_y->tv_nsec -= MULTIPLIER * nsec;
-		_y->tv_sec += nsec;
-	}
+        default:
+        {   // eoy_sys_clock_timeget or a clock not available here: we use timeget()
+            nanoget = NULL;
+        } break;
+    }
 
-	if(_x->tv_nsec - _y->tv_nsec > MULTIPLIER)
-	{
-		int nsec = (_x->tv_nsec - _y->tv_nsec) / MULTIPLIER;
+    return(nanoget);
+}
 
-		_y->tv_nsec += MULTIPLIER * nsec;
-		_y->tv_sec -= nsec;
-	}
 
-	/* Compute the time remaining to wait. tv_usec is certainly positive. */
+#if defined(EOY_SYS_USE_POSIX_CLOCK)
 
-	_result->tv_sec = _x->tv_sec - _y->tv_sec;
-	_result->tv_nsec = _x->tv_nsec - _y->tv_nsec;
+static uint64_t s_eoy_sys_clock_monotonic(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
 
-	/* Return 1 if result is negative. */
 
-	return _x->tv_sec < _y->tv_sec;
+static uint64_t s_eoy_sys_clock_monotonicraw(void)
+{
+#if defined(CLOCK_MONOTONIC_RAW)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return(s_eoy_sys_clock_monotonic());
+#endif
 }
+
 #endif
 
-#endif//!defined(EOY_SYS_USE_FEATURE_INTERFACE)
+
+#if defined(EOY_SYS_USE_TSC)
+
+static uint64_t s_eoy_sys_clock_tsc(void)
+{
+    uint64_t ticks = __rdtsc() - s_eoy_sys_tsc.start;
+    return(s_eoy_sys_tsc.nsstart + (uint64_t)(((unsigned __int128)ticks * s_eoy_sys_tsc.mult) >> 32));
+}
+
+
+static void s_eoy_sys_clock_tsc_calibrate(void)
+{
+    uint64_t ns0 = 0;
+    uint64_t ns1 = 0;
+    uint64_t tsc0 = 0;
+    uint64_t tsc1 = 0;
+
+    // we count the ticks of the tsc during EOY_SYS_TSC_calibration_ns of CLOCK_MONOTONIC. the tsc clock is not
+    // adjusted afterwards, hence it drifts away from CLOCK_MONOTONIC by the residual error of the rate.
+    s_eoy_sys_clock_tsc_pair(&ns0, &tsc0);
+    do
+    {
+        ns1 = s_eoy_sys_clock_monotonic();
+    } while((ns1 - ns0) < EOY_SYS_TSC_calibration_ns);
+    s_eoy_sys_clock_tsc_pair(&ns1, &tsc1);
+
+    s_eoy_sys_tsc.start     = tsc1;
+    s_eoy_sys_tsc.nsstart   = ns1;
+    s_eoy_sys_tsc.mult      = ((ns1 - ns0) << 32) / (tsc1 - tsc0);
+}
+
+
+static void s_eoy_sys_clock_tsc_pair(uint64_t *ns, uint64_t *tsc)
+{
+    uint64_t before = 0;
+    uint64_t after = 0;
+    uint64_t best = UINT64_MAX;
+    uint64_t clock = 0;
+    uint8_t i = 0;
+
+    // the tsc is read just before and after the clock: we keep the reading with the narrowest window because
+    // in the others we were interrupted
+    for(i=0; i<16; i++)
+    {
+        before = __rdtsc();
+        clock = s_eoy_sys_clock_monotonic();
+        after = __rdtsc();
+
+        if((after - before) < best)
+        {
+            best = after - before;
+            *ns = clock;
+            *tsc = before + (after - before) / 2;
+        }
+    }
+}
+
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -67,13 +67,33 @@ typedef struct
     eOvoid_fp_voidp_t           fp_delete;
 } eOysystem_mutex_cfg_t;
 
+/** @typedef    typedef enum eOysystem_clock_t
+    @brief      eOysystem_clock_t tells which clock gives the time of life of the system. With eoy_sys_clock_timeget
+                it is used the function timeget() of the configuration, which returns seconds in a double, as it has
+                always been. The others keep the time as integer nanoseconds and do not use floating point, thus they
+                keep full resolution also after a long uptime and they are cheaper.
+ **/
+typedef enum
+{
+    eoy_sys_clock_timeget       = 0,    /**< timeget() of the configuration */
+    eoy_sys_clock_monotonic     = 1,    /**< CLOCK_MONOTONIC */
+    eoy_sys_clock_monotonicraw  = 2,    /**< CLOCK_MONOTONIC_RAW, which is not adjusted by NTP. it is CLOCK_MONOTONIC where it does not exist */
+    eoy_sys_clock_tsc           = 3,    /**< the time stamp counter of x86 cpus, calibrated vs CLOCK_MONOTONIC at initialisation. it
+                                             needs an invariant TSC. it is CLOCK_MONOTONIC on other cpus */
+    eoy_sys_clock_nanotimeget   = 4     /**< nanotimeget() of the configuration */
+} eOysystem_clock_t;
+
+
 /** @typedef    typedef struct eOysystem_cfg_t
-    @brief      eOysystem_cfg_t contains ...
+    @brief      eOysystem_cfg_t contains the configuration of the EOYtheSystem. The clocks other than eoy_sys_clock_timeget
+                and eoy_sys_clock_nanotimeget exist only on POSIX systems: elsewhere the system uses timeget().
  **/  
 typedef struct
 {
     eOdouble_fp_void_t      timeget;
-    eOysystem_mutex_cfg_t   mutexcfg;
+    eOysystem_mutex_cfg_t   mutexcfg;       /**< if all its functions are NULL, it is used the built-in recursive mutex (linux only) */
+    eOysystem_clock_t       clock;
+    eOuint64_fp_void_t      nanotimeget;    /**< used only with eoy_sys_clock_nanotimeget, which requires it not NULL. it returns monotonic nanoseconds */
 } eOysystem_cfg_t;
 
 
@@ -107,7 +127,8 @@ typedef void EOYtheSystemDerived;
                 the error manager, the the memory pool, the HAL, the OSAL, and optionally the FSAL. 
                 The EOMtheTimerManager and EOMtheCallbackManager are initialised later by eoy_sys_Start().
     @param      syscfg          The configuration of the system (HAL, OSAL, FSAL).  Only the config of FSAL can be NULL. In such a case
-                                the FSAL is not initialised.
+                                the FSAL is not initialised. If NULL, it is used a default configuration which keeps the time with
+                                eoy_sys_clock_monotonic where it exists.
     @param      mpoolcfg        The configuration of the EOtheMemoryPool.  If NULL, it is used the default configuration
                                 (@e eoy_mempool_DefaultCfg), which uses the heap.  The function eo_mempool_Initialise() is called internally.
     @param      errmancfg       The configuration of the EOtheErrorManager  If NULL, it is used the default configuration @e eoy_errman_DefaultCfg.
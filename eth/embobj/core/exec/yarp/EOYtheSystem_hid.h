@@ -65,6 +65,8 @@ struct EOYtheSystem_hid
     eOysystem_cfg_t             config;
     eOvoid_fp_void_t            user_init_fn;
     double                      start;      // using yarp time, which is storead as a double at its maximum resolution (sec and usec)
+    eOuint64_fp_void_t          nanoget;    // the integer clock. NULL if the clock is eoy_sys_clock_timeget
+    uint64_t                    startns;    // value of nanoget() at time of life zero
 }; 
 
 
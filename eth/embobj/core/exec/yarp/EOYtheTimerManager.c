@@ -0,0 +1,487 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+#include "EOVtheSystem.h"
+#include "EOVtheTimerManager_hid.h"
+#include "EOtimer_hid.h"
+#include "EOaction_hid.h"
+
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EOYTIMERMAN_USE_POSIX
+    #include <pthread.h>
+    #include <time.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtheTimerManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOYtheTimerManager_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define EOYTIMERMAN_WHEEL_mask          (EOYTIMERMAN_WHEEL_slots - 1)
+#define EOYTIMERMAN_WHEEL_range         ((uint64_t)1 << (EOYTIMERMAN_WHEEL_bits * EOYTIMERMAN_WHEEL_levels))
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOytimerman_cfg_t eoy_timerman_DefaultCfg =
+{
+    EO_INIT(.tickperiod)        1000,
+    EO_INIT(.tickthread)        eobool_true
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eoy_timerman_OnNewTimer(EOVtheTimerManager* tm, EOtimer *t);
+static eOresult_t s_eoy_timerman_OnDelTimer(EOVtheTimerManager* tm, EOtimer *t);
+static eOresult_t s_eoy_timerman_AddTimer(EOVtheTimerManager* tm, EOtimer *t);
+static eOresult_t s_eoy_timerman_RemTimer(EOVtheTimerManager* tm, EOtimer *t);
+
+static void s_eoy_timerman_wheel_insert(EOYtheTimerManager *p, eOytimerman_node_t *n);
+static void s_eoy_timerman_wheel_remove(EOYtheTimerManager *p, eOytimerman_node_t *n);
+static uint8_t s_eoy_timerman_wheel_cascade(EOYtheTimerManager *p, uint8_t level);
+
+static void s_eoy_timerman_thread_start(EOYtheTimerManager *p);
+
+#if defined(EOYTIMERMAN_USE_POSIX)
+static void * s_eoy_timerman_thread(void *arg);
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOYtheTimerManager";
+
+static EOYtheTimerManager s_eoy_timerman =
+{
+    EO_INIT(.tmrman)            NULL,
+    EO_INIT(.config)            {0},
+    EO_INIT(.mutex)             NULL,
+    EO_INIT(.tick)              0,
+    EO_INIT(.running)           0,
+    EO_INIT(.wheel)             {{NULL}}
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOYtheTimerManager * eoy_timerman_Initialise(const eOytimerman_cfg_t *tmrmancfg)
+{
+    if(NULL != s_eoy_timerman.tmrman)
+    {
+        // already initialised
+        return(&s_eoy_timerman);
+    }
+
+    if(NULL == tmrmancfg)
+    {
+        tmrmancfg = &eoy_timerman_DefaultCfg;
+    }
+
+    eo_errman_Assert(eo_errman_GetHandle(), NULL != eov_sys_GetHandle(), "eoy_timerman_Initialise(): system not initialised", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), 0 != tmrmancfg->tickperiod, "eoy_timerman_Initialise(): 0 tickperiod", s_eobj_ownname, &eo_errman_DescrWrongParamLocal);
+
+    memcpy(&s_eoy_timerman.config, tmrmancfg, sizeof(eOytimerman_cfg_t));
+
+    // the same mutex is used by the EOtimer objects via eov_timerman_Take() and by eoy_timerman_Tick()
+    s_eoy_timerman.mutex = eoy_mutex_New();
+
+    s_eoy_timerman.tmrman = eov_timerman_hid_Initialise(s_eoy_timerman_OnNewTimer, s_eoy_timerman_OnDelTimer,
+                                                         s_eoy_timerman_AddTimer, s_eoy_timerman_RemTimer,
+                                                         (EOVmutexDerived*)s_eoy_timerman.mutex);
+
+    s_eoy_timerman.tick = eov_sys_LifeTimeGet(eov_sys_GetHandle()) / s_eoy_timerman.config.tickperiod;
+
+    if(eobool_true == s_eoy_timerman.config.tickthread)
+    {
+        s_eoy_timerman_thread_start(&s_eoy_timerman);
+    }
+
+    return(&s_eoy_timerman);
+}
+
+
+extern EOYtheTimerManager* eoy_timerman_GetHandle(void)
+{
+    return((NULL != s_eoy_timerman.tmrman) ? (&s_eoy_timerman) : (NULL));
+}
+
+
+extern uint32_t eoy_timerman_Tick(EOYtheTimerManager *p)
+{
+    uint32_t executed = 0;
+    uint64_t now = 0;
+    eOabstime_t last = 0;
+    uint8_t index = 0;
+    uint8_t level = 0;
+    eOytimerman_node_t *expired = NULL;
+    eOytimerman_node_t *n = NULL;
+    EOtimer *t = NULL;
+    EOaction action;
+
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    eov_timerman_Take(p->tmrman, eok_reltimeINFINITE);
+
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle()) / p->config.tickperiod;
+
+    while(p->tick <= now)
+    {
+        if(0 == p->running)
+        {   // the wheel is empty: the position of its slots does not matter, thus we jump to now
+            p->tick = now + 1;
+            break;
+        }
+
+        index = (uint8_t)(p->tick & EOYTIMERMAN_WHEEL_mask);
+
+        if(0 == index)
+        {   // the first level has completed a turn: we move down one slot of the next level, and so on
+            for(level=1; level<EOYTIMERMAN_WHEEL_levels; level++)
+            {
+                if(0 != s_eoy_timerman_wheel_cascade(p, level))
+                {
+                    break;
+                }
+            }
+        }
+
+        // we detach the slot and advance the tick, so that a timer added in the meantime with an expiry in the
+        // past goes into the slot of the next tick and not into the list we are working on.
+        expired = p->wheel[0][index];
+        p->wheel[0][index] = NULL;
+        if(NULL != expired)
+        {
+            expired->pprev = &expired;
+        }
+        p->tick++;
+
+        while(NULL != (n = expired))
+        {
+            s_eoy_timerman_wheel_remove(p, n);
+            t = n->timer;
+
+            if(0 != n->period)
+            {   // the period is kept in micro-seconds so that it does not drift even if it is not a multiple of the tick
+                n->expiry += n->period;
+                last = (p->tick - 1) * p->config.tickperiod;
+                if(n->expiry <= last)
+                {   // we were late: we skip the periods which are already over
+                    n->expiry += ((last - n->expiry) / n->period + 1) * n->period;
+                }
+                s_eoy_timerman_wheel_insert(p, n);
+            }
+            else
+            {
+                t->status = EOTIMER_STATUS_COMPLETED;
+            }
+
+            // the action is executed w/out the mutex so that it can start or stop timers. as the timer can be
+            // changed in the meantime, we use a copy of its action.
+            memcpy(&action, &t->onexpiry, sizeof(EOaction));
+            eov_timerman_Release(p->tmrman);
+
+            eo_action_Execute(&action, eok_reltimeZERO);
+            executed++;
+
+            eov_timerman_Take(p->tmrman, eok_reltimeINFINITE);
+        }
+    }
+
+    eov_timerman_Release(p->tmrman);
+
+    return(executed);
+}
+
+
+extern uint32_t eoy_timerman_NumberOfRunningTimers(EOYtheTimerManager *p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    return(p->running);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// the following four functions are called by EOtimer with the mutex already taken, apart s_eoy_timerman_OnNewTimer()
+// and s_eoy_timerman_OnDelTimer()
+
+static eOresult_t s_eoy_timerman_OnNewTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOytimerman_node_t *n = (eOytimerman_node_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOytimerman_node_t), 1);
+
+    n->next     = NULL;
+    n->pprev    = NULL;
+    n->expiry   = 0;
+    n->period   = 0;
+    n->timer    = t;
+
+    t->envir.other = n;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoy_timerman_OnDelTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOytimerman_node_t *n = (eOytimerman_node_t*) t->envir.other;
+
+    if(NULL == n)
+    {
+        return(eores_NOK_generic);
+    }
+
+    eov_timerman_Take(tm, eok_reltimeINFINITE);
+    s_eoy_timerman_wheel_remove(&s_eoy_timerman, n);
+    t->envir.other = NULL;
+    eov_timerman_Release(tm);
+
+    eo_mempool_Delete(eo_mempool_GetHandle(), n);
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoy_timerman_AddTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    EOYtheTimerManager *p = &s_eoy_timerman;
+    eOytimerman_node_t *n = (eOytimerman_node_t*) t->envir.other;
+    eOabstime_t now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    eOabstime_t expiry = 0;
+
+    if(NULL == n)
+    {
+        return(eores_NOK_generic);
+    }
+
+    expiry = ((eok_abstimeNOW == t->startat) ? (now) : (t->startat)) + t->expirytime;
+
+    if((EOTIMER_MODE_FOREVER == t->mode) && (expiry <= now) && (0 != t->expirytime))
+    {   // a periodic timer started in the past: it expires at its first period after now
+        expiry += ((now - expiry) / t->expirytime + 1) * t->expirytime;
+    }
+
+    s_eoy_timerman_wheel_remove(p, n);
+
+    n->expiry = expiry;
+    n->period = 0;
+    if(EOTIMER_MODE_FOREVER == t->mode)
+    {   // a periodic timer cannot expire more than once per tick
+        n->period = (t->expirytime < p->config.tickperiod) ? (p->config.tickperiod) : (t->expirytime);
+    }
+
+    s_eoy_timerman_wheel_insert(p, n);
+    t->status = EOTIMER_STATUS_RUNNING;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eoy_timerman_RemTimer(EOVtheTimerManager* tm, EOtimer *t)
+{
+    eOytimerman_node_t *n = (eOytimerman_node_t*) t->envir.other;
+
+    if(NULL != n)
+    {
+        s_eoy_timerman_wheel_remove(&s_eoy_timerman, n);
+    }
+
+    eo_timer_hid_Reset_but_not_osaltime(t, eo_tmrstat_Idle);
+
+    return(eores_OK);
+}
+
+
+static void s_eoy_timerman_wheel_insert(EOYtheTimerManager *p, eOytimerman_node_t *n)
+{
+    // we round up the expiry so that the timer never expires before its time
+    uint64_t at = (n->expiry + p->config.tickperiod - 1) / p->config.tickperiod;
+    uint64_t delta = 0;
+    uint8_t level = 0;
+    eOytimerman_node_t **slot = NULL;
+
+    if(at < p->tick)
+    {   // already expired: it goes into the slot of the next tick
+        at = p->tick;
+    }
+
+    delta = at - p->tick;
+
+    if(delta >= EOYTIMERMAN_WHEEL_range)
+    {   // too far away: it stays in the last level until it gets nearer. its expiry is unchanged
+        delta = EOYTIMERMAN_WHEEL_range - 1;
+        at = p->tick + delta;
+    }
+
+    // level l holds the timers which expire between 64^l and 64^(l+1) - 1 ticks from now
+    while(delta >= ((uint64_t)1 << (EOYTIMERMAN_WHEEL_bits * (level+1))))
+    {
+        level++;
+    }
+
+    slot = &p->wheel[level][(at >> (EOYTIMERMAN_WHEEL_bits * level)) & EOYTIMERMAN_WHEEL_mask];
+
+    n->next = *slot;
+    if(NULL != n->next)
+    {
+        n->next->pprev = &n->next;
+    }
+    n->pprev = slot;
+    *slot = n;
+
+    p->running++;
+}
+
+
+static void s_eoy_timerman_wheel_remove(EOYtheTimerManager *p, eOytimerman_node_t *n)
+{
+    if(NULL == n->pprev)
+    {   // not in the wheel
+        return;
+    }
+
+    *n->pprev = n->next;
+    if(NULL != n->next)
+    {
+        n->next->pprev = n->pprev;
+    }
+    n->next = NULL;
+    n->pprev = NULL;
+
+    p->running--;
+}
+
+
+static uint8_t s_eoy_timerman_wheel_cascade(EOYtheTimerManager *p, uint8_t level)
+{
+    uint8_t index = (uint8_t)((p->tick >> (EOYTIMERMAN_WHEEL_bits * level)) & EOYTIMERMAN_WHEEL_mask);
+    eOytimerman_node_t *list = p->wheel[level][index];
+    eOytimerman_node_t *n = NULL;
+
+    p->wheel[level][index] = NULL;
+
+    // every timer of the slot goes into a lower level because now it is nearer than 64^level ticks
+    while(NULL != (n = list))
+    {
+        list = n->next;
+        n->next = NULL;
+        n->pprev = NULL;
+        p->running--;
+        s_eoy_timerman_wheel_insert(p, n);
+    }
+
+    return(index);
+}
+
+
+static void s_eoy_timerman_thread_start(EOYtheTimerManager *p)
+{
+#if defined(EOYTIMERMAN_USE_POSIX)
+    pthread_t thread;
+
+    if(0 == pthread_create(&thread, NULL, s_eoy_timerman_thread, p))
+    {
+        pthread_detach(thread);
+        return;
+    }
+
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eoy_timerman_Initialise(): cannot start the tick thread", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+#else
+    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, "eoy_timerman_Initialise(): no tick thread. call eoy_timerman_Tick()", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+#endif
+}
+
+
+#if defined(EOYTIMERMAN_USE_POSIX)
+static void * s_eoy_timerman_thread(void *arg)
+{
+    EOYtheTimerManager *p = (EOYtheTimerManager*)arg;
+    struct timespec period;
+
+    period.tv_sec   = p->config.tickperiod / 1000000;
+    period.tv_nsec  = (p->config.tickperiod % 1000000) * 1000;
+
+    // eoy_timerman_Tick() processes all the ticks up to the lifetime of the system, thus the jitter of the sleep
+    // delays the actions but does not accumulate.
+    for(;;)
+    {
+        nanosleep(&period, NULL);
+        eoy_timerman_Tick(p);
+    }
+
+    return(NULL);
+}
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
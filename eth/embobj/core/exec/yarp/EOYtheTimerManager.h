@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTHETIMERMANAGER_H_
+#define _EOYTHETIMERMANAGER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOYtheTimerManager.h
+    @brief      This header file implements public interface to the timer manager singleton of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+/** @defgroup eoy_thetimermanager Singleton EOYtheTimerManager
+    The EOYtheTimerManager is derived from the abstract object EOVtheTimerManager to give the EOtimer objects to the
+    YARP execution environment (YEE). It must be initialised after eoy_sys_Initialise() and before any eo_timer_New().
+
+    The running timers are kept inside a hierarchical timing wheel of four levels of 64 slots each, so that the start,
+    the stop and the expiry of a timer cost O(1) whatever the number of running timers is. The resolution is the tick
+    period of the configuration: a timer never expires before its time but it can expire up to one tick later.
+    Timers whose expiry is more than 2^24 ticks in the future are kept in the last level and moved back when
+    they get nearer.
+
+    The wheel is advanced by eoy_timerman_Tick(), which executes the EOaction of the expired timers with
+    eo_action_Execute(). On POSIX systems the singleton can start a dedicated thread which calls it every tick period,
+    otherwise the application must call it on its own. The mutex of the timer manager is released while an action
+    is executed, hence an action can start or stop timers. The mutex is a EOYmutex, thus the mutex functions
+    inside eOysystem_cfg_t must be real ones if the tick thread is used.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct eOytimerman_cfg_t
+    @brief      eOytimerman_cfg_t contains the configuration of the EOYtheTimerManager.
+ **/
+typedef struct
+{
+    eOreltime_t     tickperiod;     /**< the period of the wheel in micro-seconds. it is also the resolution of the timers. */
+    eObool_t        tickthread;     /**< if eobool_true a dedicated thread calls eoy_timerman_Tick() every tickperiod. */
+} eOytimerman_cfg_t;
+
+
+/** @typedef    typedef struct EOYtheTimerManager_hid EOYtheTimerManager
+    @brief      EOYtheTimerManager is an opaque struct. It is used to implement data abstraction for the timer manager
+                object so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOYtheTimerManager_hid EOYtheTimerManager;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOytimerman_cfg_t eoy_timerman_DefaultCfg; // = { 1000, eobool_true };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOYtheTimerManager * eoy_timerman_Initialise(const eOytimerman_cfg_t *tmrmancfg)
+    @brief      Initialises the singleton EOYtheTimerManager and, if required, starts its tick thread.
+    @param      tmrmancfg       The configuration. If NULL, it is used eoy_timerman_DefaultCfg.
+    @return     A not NULL handle to the singleton. In case of errors it is called the EOtheErrorManager.
+ **/
+extern EOYtheTimerManager * eoy_timerman_Initialise(const eOytimerman_cfg_t *tmrmancfg);
+
+
+/** @fn         extern EOYtheTimerManager* eoy_timerman_GetHandle(void)
+    @brief      Returns an handle to the singleton EOYtheTimerManager. The singleton must have been initialised
+                with eoy_timerman_Initialise(), otherwise this function call will return NULL.
+    @return     The pointer to the required EOYtheTimerManager (or NULL upon in-initialised singleton).
+ **/
+extern EOYtheTimerManager* eoy_timerman_GetHandle(void);
+
+
+/** @fn         extern uint32_t eoy_timerman_Tick(EOYtheTimerManager *p)
+    @brief      Advances the wheel up to the current lifetime of the system and executes the actions of the timers
+                which have expired in the meantime. It is called by the tick thread, but it can also be called by
+                the application when the tick thread is not used.
+    @param      p               The handle to the singleton.
+    @return     The number of executed actions.
+ **/
+extern uint32_t eoy_timerman_Tick(EOYtheTimerManager *p);
+
+
+/** @fn         extern uint32_t eoy_timerman_NumberOfRunningTimers(EOYtheTimerManager *p)
+    @brief      Gives the number of timers which are inside the wheel.
+    @param      p               The handle to the singleton.
+    @return     The number of running timers.
+ **/
+extern uint32_t eoy_timerman_NumberOfRunningTimers(EOYtheTimerManager *p);
+
+
+
+/** @}
+    end of group eoy_thetimermanager
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
+
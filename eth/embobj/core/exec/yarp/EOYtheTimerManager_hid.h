@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOYTHETIMERMANAGER_HID_H_
+#define _EOYTHETIMERMANAGER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOYtheTimerManager_hid.h
+    @brief      This header file implements hidden interface to the timer manager singleton of the YARP execution environment.
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOVtheTimerManager.h"
+#include "EOYmutex.h"
+#include "EOtimer.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOYtheTimerManager.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define EOYTIMERMAN_WHEEL_bits          6
+#define EOYTIMERMAN_WHEEL_slots         (1 << EOYTIMERMAN_WHEEL_bits)
+#define EOYTIMERMAN_WHEEL_levels        4
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct eOytimerman_node_T eOytimerman_node_t;
+
+// one for each EOtimer, pointed by its envir.other. pprev points to the pointer which points to the node (a slot of the
+// wheel or the next of another node), so that the node can be removed w/out knowing where it is. it is NULL when the
+// node is not inside the wheel.
+struct eOytimerman_node_T
+{
+    eOytimerman_node_t          *next;
+    eOytimerman_node_t          **pprev;
+    eOabstime_t                 expiry;         // in micro-seconds of lifetime
+    eOabstime_t                 period;         // in micro-seconds. 0 for a one shot timer
+    EOtimer                     *timer;
+};
+
+
+/* @struct     EOYtheTimerManager_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOYtheTimerManager_hid
+{
+    // base object
+    EOVtheTimerManager          *tmrman;
+
+    // other stuff
+    eOytimerman_cfg_t           config;
+    EOYmutex                    *mutex;
+    uint64_t                    tick;           // the next tick to be processed
+    uint32_t                    running;        // number of nodes inside the wheel
+    eOytimerman_node_t          *wheel[EOYTIMERMAN_WHEEL_levels][EOYTIMERMAN_WHEEL_slots];
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -650,8 +650,10 @@ extern uint8_t eoprot_endpoints_numberof_get(eOprotBRD_t brd)
 extern eOresult_t eoprot_endpoints_array_get(eOprotBRD_t brd, EOarray* array, uint8_t startfrom)
 {  
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);    
+    eOprotEndpoint_t eps[eoprot_endpoints_numberof] = {0};
     uint8_t ep = 0;
     uint8_t numberof = 0;
+    uint8_t n = 0;
 
     if(NULL == data)
     {
@@ -663,29 +665,23 @@ extern eOresult_t eoprot_endpoints_array_get(eOprotBRD_t brd, EOarray* array, ui
         return(eores_NOK_generic);
     }
     
-    // we reset the array 
-    eo_array_Reset(array);
-
-
+    // we collect the endpoints and then we replace the content of the array with a single copy
     numberof = 0;
-    //uint8_t capacity = eo_array_Capacity(array);
     for(ep=0; ep<eoprot_endpoints_numberof; ep++)
     {
         uint8_t epi = eoprot_ep_ep2index(ep);
         if(NULL != data->numberofeachentity[epi])
         {
             numberof++;
-            if(numberof>startfrom)
-            {   // we want to retrieve the items starting from a given number
-                eOresult_t res = eo_array_PushBack(array, &ep);
-                if(eores_OK != res)
-                {   // if array is valid, we have NOK when the array is full
-                    break;
-                }                    
+            if((numberof>startfrom) && (n < eo_array_Capacity(array)))
+            {   // we want to retrieve the items starting from a given number, until the array is full
+                eps[n++] = ep;
             }
         }
     }
     
+    eo_array_AssignRange(array, eps, n);
+    
     return(eores_OK);   
 }
 
@@ -693,9 +689,10 @@ extern eOresult_t eoprot_endpoints_array_get(eOprotBRD_t brd, EOarray* array, ui
 extern eOresult_t eoprot_endpoints_arrayofdescriptors_get(eOprotBRD_t brd, EOarray* array, uint8_t startfrom)
 { 
     eOprot_board_data_t *data = s_eoprot_board_data_get(brd);
-    eOresult_t res = eores_NOK_generic;
+    eoprot_endpoint_descriptor_t epdes[eoprot_endpoints_numberof] = {0};
     uint8_t ep = 0;
     uint8_t numberof = 0;
+    uint8_t n = 0;
 
     if(NULL == data)
     {
@@ -707,27 +704,22 @@ extern eOresult_t eoprot_endpoints_arrayofdescriptors_get(eOprotBRD_t brd, EOarr
         return(eores_NOK_generic);
     }
     
-    // we reset the array 
-    eo_array_Reset(array);
-
-
+    // we collect the descriptors and then we replace the content of the array with a single copy
     numberof = 0;
-    //uint8_t capacity = eo_array_Capacity(array);
     for(ep=0; ep<eoprot_endpoints_numberof; ep++)
     {
         uint8_t epi = eoprot_ep_ep2index(ep);
         if(NULL != data->numberofeachentity[epi])
         {
             numberof++;
-            if(numberof>startfrom)
-            {   // we want to retrieve the items starting from a given number
+            if((numberof>startfrom) && (n < eo_array_Capacity(array)))
+            {   // we want to retrieve the items starting from a given number, until the array is full
                 uint8_t ent;
                 uint16_t entitiesinside = 0;
-                eoprot_endpoint_descriptor_t epdes = {0};
-                epdes.endpoint          = ep;
-                epdes.entitiesinside    = 255; // eoprot_ep_entities_numberof[epi];
-                epdes.version.major     = eoprot_endpoint_version[epi]->major;
-                epdes.version.minor     = eoprot_endpoint_version[epi]->minor;
+                epdes[n].endpoint          = ep;
+                epdes[n].entitiesinside    = 255; // eoprot_ep_entities_numberof[epi];
+                epdes[n].version.major     = eoprot_endpoint_version[epi]->major;
+                epdes[n].version.minor     = eoprot_endpoint_version[epi]->minor;
                 for(ent=0; ent<eoprot_ep_entities_numberof[epi]; ent++)
                 {
                     if(0 != data->numberofeachentity[epi][ent])
@@ -735,18 +727,14 @@ extern eOresult_t eoprot_endpoints_arrayofdescriptors_get(eOprotBRD_t brd, EOarr
                         entitiesinside++;
                     }     
                 }
-                epdes.entitiesinside    = (uint8_t) entitiesinside; // ok, epdes.entitiesinside does not contains many item                
-                
-                
-                res = eo_array_PushBack(array, &epdes);
-                if(eores_OK != res)
-                {   // if array is valid, we have NOK when the array is full
-                    break;
-                }                    
+                epdes[n].entitiesinside    = (uint8_t) entitiesinside; // ok, epdes.entitiesinside does not contains many item                
+                n++;
             }
         }
     }
     
+    eo_array_AssignRange(array, epdes, n);
+    
     return(eores_OK);   
 }
 
@@ -1544,25 +1532,10 @@ static eObool_t s_eoprot_entity_tag_is_valid(uint8_t epi, eOprotEntity_t entity,
 // returns the offset of the variable with a given tag from the start of the entity
 static uint16_t s_eoprot_rom_entity_offset_of_tag(uint8_t epi, uint8_t ent, eOprotTag_t tag)
 {
-    uint32_t i, tag_aux = 0;
-    uint8_t *one = NULL;
-    uint8_t *two = NULL;
-    int res = 0;
-
-    tag_aux = 0;
-    for(i=0; i<ent; i++)
-    {
-        tag_aux += eoprot_ep_tags_numberof[epi][i];
-    }
-    // one contains the address of the default value of the entire entity (eg: &MYdefentity = 0x08001200).
-    one = (uint8_t*) eoprot_ep_entities_defval[epi][ent];
-    // two contains the address of the default value of the variable, but inside the default value of the entire entity (eg: &MYdefentity.var = 0x08001220)  
-    two = (uint8_t*) eoprot_ep_descriptors[epi][ent][tag]->resetval;
-    // if we want to know how many bytes they are fare aways we simply cast them to pointers of 1 byte and make the difference.
-    // the C standard assures that the result is an integer containing the distance between the pointers expressed in object pointed. in our case 1 byte.
-    res = two - one;
-    // and now we cast result to 16 bits because we dont have big entities.
-    return((uint16_t)res); 
+    // the offset is computed at compile time with offsetof() on the type of the entity and kept in a flat table next
+    // to the descriptors, thus we dont need to compute the distance between the resetval of the tag and the default
+    // value of the entity.
+    return(eoprot_ep_offsets[epi][ent][tag]); 
 }
 
 static uint16_t s_eoprot_rom_get_offset(uint8_t epi, eOprotEntity_t entity, eOprotTag_t tag)
@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -674,6 +675,75 @@ EOPROT_ROMmap EOnv_rom_t * const * const eoprot_as_rom_descriptors[] =
 };  EO_VERIFYsizeof(eoprot_as_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_as_numberof))
 
 
+// -- collector of the offsets of the tags inside their entity, computed at compile time with offsetof()
+
+static const uint16_t s_eoprot_as_rom_strain_offsets[] =
+{   // here are eoprot_tags_as_strain_numberof offsets for the strain entity
+    0,
+    offsetof(eOas_strain_t, config),
+    offsetof(eOas_strain_t, status),
+    offsetof(eOas_strain_t, status.fullscale),
+    offsetof(eOas_strain_t, status.calibratedvalues),
+    offsetof(eOas_strain_t, status.uncalibratedvalues)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_strain_offsets, sizeof(uint16_t)*(eoprot_tags_as_strain_numberof))
+
+static const uint16_t s_eoprot_as_rom_mais_offsets[] =
+{   // here are eoprot_tags_as_mais_numberof offsets for the mais entity
+    0,
+    offsetof(eOas_mais_t, config),
+    offsetof(eOas_mais_t, config.mode),
+    offsetof(eOas_mais_t, config.datarate),
+    offsetof(eOas_mais_t, config.resolution),
+    offsetof(eOas_mais_t, status),
+    offsetof(eOas_mais_t, status.the15values)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_mais_offsets, sizeof(uint16_t)*(eoprot_tags_as_mais_numberof))
+
+static const uint16_t s_eoprot_as_rom_temperature_offsets[] =
+{   // here are eoprot_tags_as_temperature_numberof offsets for the temperature entity
+    0,
+    offsetof(eOas_temperature_t, config),
+    offsetof(eOas_temperature_t, status),
+    offsetof(eOas_temperature_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_temperature_offsets, sizeof(uint16_t)*(eoprot_tags_as_temperature_numberof))
+
+static const uint16_t s_eoprot_as_rom_inertial_offsets[] =
+{   // here are eoprot_tags_as_inertial_numberof offsets for the inertial entity
+    0,
+    offsetof(eOas_inertial_t, config),
+    offsetof(eOas_inertial_t, config.datarate),
+    offsetof(eOas_inertial_t, config.enabled),
+    offsetof(eOas_inertial_t, status),
+    offsetof(eOas_inertial_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial_offsets, sizeof(uint16_t)*(eoprot_tags_as_inertial_numberof))
+
+static const uint16_t s_eoprot_as_rom_inertial3_offsets[] =
+{   // here are eoprot_tags_as_inertial3_numberof offsets for the inertial3 entity
+    0,
+    offsetof(eOas_inertial3_t, config),
+    offsetof(eOas_inertial3_t, status),
+    offsetof(eOas_inertial3_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_inertial3_offsets, sizeof(uint16_t)*(eoprot_tags_as_inertial3_numberof))
+
+static const uint16_t s_eoprot_as_rom_psc_offsets[] =
+{   // here are eoprot_tags_as_psc_numberof offsets for the psc entity
+    0,
+    offsetof(eOas_psc_t, config),
+    offsetof(eOas_psc_t, status),
+    offsetof(eOas_psc_t, cmmnds.enable)
+};  EO_VERIFYsizeof(s_eoprot_as_rom_psc_offsets, sizeof(uint16_t)*(eoprot_tags_as_psc_numberof))
+
+
+const uint16_t* const eoprot_as_rom_offsets[] = 
+{
+    s_eoprot_as_rom_strain_offsets,
+    s_eoprot_as_rom_mais_offsets,
+    s_eoprot_as_rom_temperature_offsets,
+    s_eoprot_as_rom_inertial_offsets,
+    s_eoprot_as_rom_inertial3_offsets,
+    s_eoprot_as_rom_psc_offsets
+};  EO_VERIFYsizeof(eoprot_as_rom_offsets, sizeof(const uint16_t*)*(eoprot_entities_as_numberof))
+
+
 // the other constants: to be changed when a new entity is added
 
 const uint8_t eoprot_as_rom_tags_numberof[] = 
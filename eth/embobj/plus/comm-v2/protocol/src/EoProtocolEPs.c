@@ -120,6 +120,14 @@ EOPROT_ROMmap EOnv_rom_t * const * const * const eoprot_ep_descriptors[] =
     eoprot_sk_rom_descriptors
 };  EO_VERIFYsizeof(eoprot_ep_descriptors, eoprot_endpoints_numberof*sizeof(EOPROT_ROMmap EOnv_rom_t * const * const *)) 
 
+const uint16_t* const * const eoprot_ep_offsets[] =
+{   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
+    eoprot_mn_rom_offsets,
+    eoprot_mc_rom_offsets,
+    eoprot_as_rom_offsets,
+    eoprot_sk_rom_offsets
+};  EO_VERIFYsizeof(eoprot_ep_offsets, eoprot_endpoints_numberof*sizeof(const uint16_t* const *)) 
+
 const uint16_t* const eoprot_ep_entities_sizeof[] =
 {   // very important: use order of eOprot_endpoint_t: pos 0 is eoprot_endpoint_management etc.
     eoprot_mn_rom_entities_sizeof,
@@ -61,6 +61,7 @@
 
 
 extern EOPROT_ROMmap EOnv_rom_t * const * const * const eoprot_ep_descriptors[];
+extern const uint16_t* const * const eoprot_ep_offsets[];          // eoprot_endpoints_numberof
     
 extern eOvoid_fp_cnvp_cropdesp_t eoprot_ep_onsay[];                 // eoprot_endpoints_numberof
 extern const eoprot_version_t * const eoprot_endpoint_version[];    // eoprot_endpoints_numberof
@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -756,6 +757,66 @@ EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mc_rom_descriptors[] =
 };  EO_VERIFYsizeof(eoprot_mc_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_mc_numberof))
 
 
+// -- collector of the offsets of the tags inside their entity, computed at compile time with offsetof()
+
+static const uint16_t s_eoprot_mc_rom_joint_offsets[] =
+{   // here are eoprot_tags_mc_joint_numberof offsets for the joint entity
+    0,
+    offsetof(eOmc_joint_t, config),
+    offsetof(eOmc_joint_t, config.pidtrajectory),
+    offsetof(eOmc_joint_t, config.piddirect),
+    offsetof(eOmc_joint_t, config.pidtorque),
+    offsetof(eOmc_joint_t, config.userlimits),
+    offsetof(eOmc_joint_t, config.impedance),
+    offsetof(eOmc_joint_t, config.motor_params),
+    offsetof(eOmc_joint_t, config.tcfiltertype),
+    offsetof(eOmc_joint_t, status),
+    offsetof(eOmc_joint_t, status.core),
+    offsetof(eOmc_joint_t, status.target),
+    offsetof(eOmc_joint_t, status.core.modes.controlmodestatus),
+    offsetof(eOmc_joint_t, status.core.modes.interactionmodestatus),
+    offsetof(eOmc_joint_t, status.core.modes.ismotiondone),
+    offsetof(eOmc_joint_t, status.addinfo.multienc),
+    offsetof(eOmc_joint_t, inputs),
+    offsetof(eOmc_joint_t, inputs.externallymeasuredtorque),
+    offsetof(eOmc_joint_t, cmmnds.calibration),
+    offsetof(eOmc_joint_t, cmmnds.setpoint),
+    offsetof(eOmc_joint_t, cmmnds.stoptrajectory),
+    offsetof(eOmc_joint_t, cmmnds.controlmode),
+    offsetof(eOmc_joint_t, cmmnds.interactionmode)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_joint_offsets, sizeof(uint16_t)*(eoprot_tags_mc_joint_numberof))
+
+static const uint16_t s_eoprot_mc_rom_motor_offsets[] =
+{   // here are eoprot_tags_mc_motor_numberof offsets for the motor entity
+    0,
+    offsetof(eOmc_motor_t, config),
+    offsetof(eOmc_motor_t, config.currentLimits),
+    offsetof(eOmc_motor_t, config.gearbox_M2J),
+    offsetof(eOmc_motor_t, config.rotorEncoderResolution),
+    offsetof(eOmc_motor_t, config.pwmLimit),
+    offsetof(eOmc_motor_t, config.temperatureLimit),
+    offsetof(eOmc_motor_t, config.pidcurrent),
+    offsetof(eOmc_motor_t, config.pidspeed),
+    offsetof(eOmc_motor_t, status),
+    offsetof(eOmc_motor_t, status.basic)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_motor_offsets, sizeof(uint16_t)*(eoprot_tags_mc_motor_numberof))
+
+static const uint16_t s_eoprot_mc_rom_controller_offsets[] =
+{   // here are eoprot_tags_mc_controller_numberof offsets for the controller entity
+    0,
+    offsetof(eOmc_controller_t, config),
+    offsetof(eOmc_controller_t, status)
+};  EO_VERIFYsizeof(s_eoprot_mc_rom_controller_offsets, sizeof(uint16_t)*(eoprot_tags_mc_controller_numberof))
+
+
+const uint16_t* const eoprot_mc_rom_offsets[] = 
+{
+    s_eoprot_mc_rom_joint_offsets,
+    s_eoprot_mc_rom_motor_offsets,
+    s_eoprot_mc_rom_controller_offsets
+};  EO_VERIFYsizeof(eoprot_mc_rom_offsets, sizeof(const uint16_t*)*(eoprot_entities_mc_numberof))
+
+
 
 // the other constants: to be changed when a new entity is added
 
@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -514,6 +515,56 @@ EOPROT_ROMmap EOnv_rom_t * const * const eoprot_mn_rom_descriptors[] =
     (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_mn_rom_service_descriptors       
 };  EO_VERIFYsizeof(eoprot_mn_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_mn_numberof))
 
+
+// -- collector of the offsets of the tags inside their entity, computed at compile time with offsetof()
+
+static const uint16_t s_eoprot_mn_rom_comm_offsets[] =
+{   // here are eoprot_tags_mn_comm_numberof offsets for the comm entity
+    0,
+    offsetof(eOmn_comm_t, status),
+    offsetof(eOmn_comm_t, status.managementprotocolversion),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.querynumof),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.queryarray),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.replynumof),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.replyarray),
+    offsetof(eOmn_comm_t, cmmnds.command.cmd.config)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_comm_offsets, sizeof(uint16_t)*(eoprot_tags_mn_comm_numberof))
+
+static const uint16_t s_eoprot_mn_rom_appl_offsets[] =
+{   // here are eoprot_tags_mn_appl_numberof offsets for the appl entity
+    0,
+    offsetof(eOmn_appl_t, config),
+    offsetof(eOmn_appl_t, config.txratedivider),
+    offsetof(eOmn_appl_t, status),
+    offsetof(eOmn_appl_t, cmmnds.go2state),
+    offsetof(eOmn_appl_t, cmmnds.timeset)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_appl_offsets, sizeof(uint16_t)*(eoprot_tags_mn_appl_numberof))
+
+static const uint16_t s_eoprot_mn_rom_info_offsets[] =
+{   // here are eoprot_tags_mn_info_numberof offsets for the info entity
+    0,
+    offsetof(eOmn_info_t, config),
+    offsetof(eOmn_info_t, config.enabled),
+    offsetof(eOmn_info_t, status),
+    offsetof(eOmn_info_t, status.basic)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_info_offsets, sizeof(uint16_t)*(eoprot_tags_mn_info_numberof))
+
+static const uint16_t s_eoprot_mn_rom_service_offsets[] =
+{   // here are eoprot_tags_mn_service_numberof offsets for the service entity
+    0,
+    offsetof(eOmn_service_t, status.commandresult),
+    offsetof(eOmn_service_t, cmmnds.command)
+};  EO_VERIFYsizeof(s_eoprot_mn_rom_service_offsets, sizeof(uint16_t)*(eoprot_tags_mn_service_numberof))
+
+
+const uint16_t* const eoprot_mn_rom_offsets[] = 
+{
+    s_eoprot_mn_rom_comm_offsets,
+    s_eoprot_mn_rom_appl_offsets,
+    s_eoprot_mn_rom_info_offsets,
+    s_eoprot_mn_rom_service_offsets
+};  EO_VERIFYsizeof(eoprot_mn_rom_offsets, sizeof(const uint16_t*)*(eoprot_entities_mn_numberof))
+
     
 
 // the other constants: to be changed when a new entity is added
@@ -30,6 +30,7 @@
 #include "stdlib.h" 
 #include "string.h"
 #include "stdio.h"
+#include "stddef.h"
 
 #include "EoCommon.h"
 #include "EOnv_hid.h"
@@ -198,6 +199,24 @@ EOPROT_ROMmap EOnv_rom_t * const * const eoprot_sk_rom_descriptors[] =
     (EOPROT_ROMmap EOnv_rom_t **)&s_eoprot_sk_rom_skin_descriptors 
 };  EO_VERIFYsizeof(eoprot_sk_rom_descriptors, sizeof(EOPROT_ROMmap EOnv_rom_t** const)*(eoprot_entities_sk_numberof))
 
+
+// -- collector of the offsets of the tags inside their entity, computed at compile time with offsetof()
+
+static const uint16_t s_eoprot_sk_rom_skin_offsets[] =
+{   // here are eoprot_tags_sk_skin_numberof offsets for the skin entity
+    0,
+    offsetof(eOsk_skin_t, config.sigmode),
+    offsetof(eOsk_skin_t, status.arrayofcandata),
+    offsetof(eOsk_skin_t, cmmnds.boardscfg),
+    offsetof(eOsk_skin_t, cmmnds.trianglescfg)
+};  EO_VERIFYsizeof(s_eoprot_sk_rom_skin_offsets, sizeof(uint16_t)*(eoprot_tags_sk_skin_numberof))
+
+
+const uint16_t* const eoprot_sk_rom_offsets[] = 
+{
+    s_eoprot_sk_rom_skin_offsets
+};  EO_VERIFYsizeof(eoprot_sk_rom_offsets, sizeof(const uint16_t*)*(eoprot_entities_sk_numberof))
+
     
 
 // the other constants: to be changed when a new entity is added
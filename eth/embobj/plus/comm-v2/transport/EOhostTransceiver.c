@@ -26,6 +26,8 @@
 #include "stdio.h"
 #include "EOtheMemoryPool.h"
 #include "EOtheErrorManager.h"
+#include "EOVtheSystem.h"
+#include "EoProtocol.h"
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 
@@ -62,7 +64,21 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+typedef struct
+{
+    const eOhosttransceiver_cfg_t*  cfgs;
+    uint8_t                         number;
+    uint8_t                         numberofworkers;
+    EOhostTransceiver**             hosttransceivers;
+    eOreltime_t*                    inittimes;
+} eOhosttransceiver_array_job_t;
+
+typedef struct
+{
+    const eOhosttransceiver_array_job_t*    job;
+    uint8_t                                 first;
+} eOhosttransceiver_array_worker_t;
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -73,6 +89,10 @@ static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cf
 
 static void s_eo_hosttransceiver_nvset_release(EOhostTransceiver *p);
 
+static eOresult_t s_eo_hosttransceiver_array_prepare(const eOhosttransceiver_cfg_t *cfgs, uint8_t number);
+
+static void s_eo_hosttransceiver_array_worker(void *arg);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -103,7 +123,10 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)      NULL,
         EO_INIT(.onerrorinvalidframe)   NULL
-    }    
+    },
+    EO_INIT(.nvsetramprovider)          NULL,
+    EO_INIT(.transmemory)               eo_trans_memory_scattered,
+    EO_INIT(.nvsetrwlock_fn_new)        NULL
 };
 
 
@@ -148,6 +171,7 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
     txrxcfg.proxycfg                            = NULL; // the host does not have a proxy
     txrxcfg.mutex_fn_new                        = cfg->mutex_fn_new;
     txrxcfg.protection                          = cfg->transprotection;
+    txrxcfg.memory                              = cfg->transmemory;
     memcpy(&txrxcfg.extfn, &cfg->extfn, sizeof(eOtransceiver_extfn_t));
 
     
@@ -185,6 +209,72 @@ extern void eo_hosttransceiver_Delete(EOhostTransceiver *p)
 }    
 
 
+extern eOresult_t eo_hosttransceiver_NewArray(const eOhosttransceiver_cfg_t *cfgs, uint8_t number, 
+                                              const eOhosttransceiver_workers_cfg_t *workers, 
+                                              EOhostTransceiver **hosttransceivers, eOreltime_t *inittimes)
+{
+    eOhosttransceiver_array_job_t job = {0};
+    eOhosttransceiver_array_worker_t args[EOK_HOSTTRANSCEIVER_maxnumberofworkers] = {0};
+    void* handles[EOK_HOSTTRANSCEIVER_maxnumberofworkers] = {NULL};
+    uint8_t numberofworkers = 1;
+    uint8_t i = 0;
+    eOresult_t res = eores_OK;
+    
+    if((NULL == cfgs) || (NULL == hosttransceivers))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    // 1. serial pre-phase: check the cfgs and register all the boards in the protocol, so that the workers 
+    //    dont realloc the data of the remote boards under the feet of each other.
+    if(eores_OK != (res = s_eo_hosttransceiver_array_prepare(cfgs, number)))
+    {
+        return(res);
+    }
+    
+    if((NULL != workers) && (NULL != workers->fp_start) && (NULL != workers->fp_join))
+    {
+        numberofworkers = EO_MIN(workers->numberofworkers, EOK_HOSTTRANSCEIVER_maxnumberofworkers);
+        numberofworkers = EO_MIN(numberofworkers, number);
+        numberofworkers = EO_MAX(numberofworkers, 1);
+    }
+    
+    job.cfgs                = cfgs;
+    job.number              = number;
+    job.numberofworkers     = numberofworkers;
+    job.hosttransceivers    = hosttransceivers;
+    job.inittimes           = inittimes;
+    
+    // 2. worker i creates the transceivers i, i+numberofworkers, i+2*numberofworkers, etc. the calling thread is worker 0
+    for(i=0; i<numberofworkers; i++)
+    {
+        args[i].job     = &job;
+        args[i].first   = i;
+    }
+    
+    for(i=1; i<numberofworkers; i++)
+    {
+        handles[i] = workers->fp_start(s_eo_hosttransceiver_array_worker, &args[i]);
+        if(NULL == handles[i])
+        {   // cannot start the thread: its share is done by the calling thread
+            s_eo_hosttransceiver_array_worker(&args[i]);
+        }
+    }
+    
+    s_eo_hosttransceiver_array_worker(&args[0]);
+    
+    for(i=1; i<numberofworkers; i++)
+    {
+        if(NULL != handles[i])
+        {
+            workers->fp_join(handles[i]);
+        }
+    }
+    
+    return(eores_OK);
+}
+
+
 extern EOtransceiver* eo_hosttransceiver_GetTransceiver(EOhostTransceiver *p)
 {
     if(NULL == p)
@@ -241,6 +331,8 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg)
 {
     EOnvSet* nvset = eo_nvset_New(cfg->nvsetprotection, cfg->mutex_fn_new);    
+    eo_nvset_RAMprovider_Set(nvset, cfg->nvsetramprovider);
+    eo_nvset_RWlock_Set(nvset, cfg->nvsetrwlock_fn_new);
     eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
     return(nvset);
 }
@@ -259,6 +351,66 @@ static void s_eo_hosttransceiver_nvset_release(EOhostTransceiver *p)
     p->nvset = NULL;  
 }
 
+
+static eOresult_t s_eo_hosttransceiver_array_prepare(const eOhosttransceiver_cfg_t *cfgs, uint8_t number)
+{
+    uint8_t i = 0;
+    uint8_t j = 0;
+    eOnvBRD_t maxbrd = 0;
+    
+    for(i=0; i<number; i++)
+    {
+        if(NULL == cfgs[i].nvsetbrdcfg)
+        {
+            return(eores_NOK_nullpointer);
+        }
+        
+        if(cfgs[i].nvsetbrdcfg->boardnum >= eoprot_board_remotes_maxnumberof)
+        {
+            return(eores_NOK_generic);
+        }
+        
+        // two objects on the same board would write the same data inside the protocol
+        for(j=0; j<i; j++)
+        {
+            if(cfgs[j].nvsetbrdcfg->boardnum == cfgs[i].nvsetbrdcfg->boardnum)
+            {
+                return(eores_NOK_generic);
+            }
+        }
+        
+        maxbrd = EO_MAX(maxbrd, cfgs[i].nvsetbrdcfg->boardnum);
+    }
+    
+    if(0 == number)
+    {
+        return(eores_OK);
+    }
+    
+    // it reserves all boards from 0 to maxbrd, thus eo_nvset_InitBRD() called later by the workers does not reserve any more
+    return(eoprot_config_board_reserve(maxbrd));
+}
+
+
+static void s_eo_hosttransceiver_array_worker(void *arg)
+{
+    const eOhosttransceiver_array_worker_t *worker = (const eOhosttransceiver_array_worker_t*)arg;
+    const eOhosttransceiver_array_job_t *job = worker->job;
+    uint16_t i = 0;
+    
+    for(i=worker->first; i<job->number; i+=job->numberofworkers)
+    {
+        eOabstime_t start = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+        
+        job->hosttransceivers[i] = eo_hosttransceiver_New(&job->cfgs[i]);
+        
+        if(NULL != job->inittimes)
+        {
+            job->inittimes[i] = (eOreltime_t)(eov_sys_LifeTimeGet(eov_sys_GetHandle()) - start);
+        }
+    }
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
@@ -62,6 +62,7 @@ extern "C" {
 #define EOK_HOSTTRANSCEIVER_capacityofropframeoccasionals      (EOK_HOSTTRANSCEIVER_capacityoftxpacket - EOK_HOSTTRANSCEIVER_TMP)
 #define EOK_HOSTTRANSCEIVER_maxnumberofregularrops             0
 #define EOK_HOSTTRANSCEIVER_maxnumberofconfreqrops             16
+#define EOK_HOSTTRANSCEIVER_maxnumberofworkers                 32
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
 
@@ -76,9 +77,26 @@ typedef struct
     eOnvset_protection_t            nvsetprotection; 
     eOconfman_cfg_t*                confmancfg;
     eOtransceiver_extfn_t           extfn;
+    const eOnvset_RAMprovider_t*    nvsetramprovider;   // if NULL the ram of the endpoints comes from the EOtheMemoryPool
+    eOtransceiver_memory_t          transmemory;
+    eov_rwlock_fn_rwlockderived_new nvsetrwlock_fn_new; // used only if nvsetprotection is one of the eo_nvset_protection_rwlock_*
 } eOhosttransceiver_cfg_t;
 
 
+/** @typedef    typedef struct eOhosttransceiver_workers_cfg_t
+    @brief      Contains the threading services used by eo_hosttransceiver_NewArray(). The embobj does not create threads 
+                by itself, hence the host application gives a function which starts a thread executing run(arg) and
+                returns an handle to it (or NULL if it cannot start it) and a function which waits for its end and
+                releases it. If fp_start is NULL or numberofworkers is less than 2, the initialisation is serial.
+ **/
+typedef struct
+{
+    uint8_t                         numberofworkers;    // max number of concurrent threads. it is clipped to EOK_HOSTTRANSCEIVER_maxnumberofworkers
+    void*                           (*fp_start)(eOvoid_fp_voidp_t run, void *arg);
+    void                            (*fp_join)(void *worker);
+} eOhosttransceiver_workers_cfg_t;
+
+
 
 /** @typedef    typedef struct EOhostTransceiver_hid EOhostTransceiver
     @brief      EOhostTransceiver is an opaque struct. It is used to implement data abstraction for the Parser  
@@ -109,6 +127,29 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
 extern void eo_hosttransceiver_Delete(EOhostTransceiver *p);
 
 
+/** @fn         extern eOresult_t eo_hosttransceiver_NewArray(const eOhosttransceiver_cfg_t *cfgs, uint8_t number, 
+                                                            const eOhosttransceiver_workers_cfg_t *workers, 
+                                                            EOhostTransceiver **hosttransceivers, eOreltime_t *inittimes)
+    @brief      Creates @e number host transceivers, one for each of cfgs[i], distributing their creation over the 
+                threads given by @e workers. The registration of the boards inside the protocol is done once by the 
+                calling thread before the workers start, so that they only write the data of their own boards. For this 
+                reason the boards in cfgs[] must all be different. The heap used by EOtheMemoryPool and the callbacks 
+                executed by eo_nv_Init() must be thread-safe, and the EOtheMemoryPool should have a mutex assigned 
+                with eo_mempool_SetMutex() to keep its statistics exact. 
+    @param      cfgs                array of @e number configurations. none of them can be NULL or have a NULL nvsetbrdcfg.
+    @param      number              the number of transceivers to create.
+    @param      workers             the threading services. if NULL the creation is serial.
+    @param      hosttransceivers    array of @e number pointers which in output contains the created objects.
+    @param      inittimes           if not NULL, array of @e number values which in output contains the time in usec
+                                    spent to create each object.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the cfgs[] are not valid. In case of error 
+                nothing is created.
+ **/
+extern eOresult_t eo_hosttransceiver_NewArray(const eOhosttransceiver_cfg_t *cfgs, uint8_t number, 
+                                              const eOhosttransceiver_workers_cfg_t *workers, 
+                                              EOhostTransceiver **hosttransceivers, eOreltime_t *inittimes);
+
+
 extern EOtransceiver * eo_hosttransceiver_GetTransceiver(EOhostTransceiver *p);
 
 extern EOnvSet * eo_hosttransceiver_GetNVset(EOhostTransceiver *p);
@@ -27,6 +27,7 @@
 #include "EOtheErrorManager.h"
 
 #include "EOVmutex.h"
+#include "EOVrwlock.h"
 
 
 #include "EOrop.h" 
@@ -64,6 +65,9 @@
 #if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
     #define eov_mutex_Take(a, b)   
     #define eov_mutex_Release(a)
+    #define eov_rwlock_TakeShared(a, b)
+    #define eov_rwlock_TakeExclusive(a, b)
+    #define eov_rwlock_Release(a)
 #endif
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -92,6 +96,43 @@ EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
     return(nv->rom->capacity);   
 }
 
+// the readers of the ram take the lock in shared mode, everything else in exclusive mode. w/out a rwlock both use the mutex
+EO_static_inline void s_eo_nv_lock_shared(const EOnv *nv)
+{
+    if(NULL != nv->rwl)
+    {
+        eov_rwlock_TakeShared(nv->rwl, eok_reltimeINFINITE);
+    }
+    else
+    {
+        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    }
+}
+
+EO_static_inline void s_eo_nv_lock_exclusive(const EOnv *nv)
+{
+    if(NULL != nv->rwl)
+    {
+        eov_rwlock_TakeExclusive(nv->rwl, eok_reltimeINFINITE);
+    }
+    else
+    {
+        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    }
+}
+
+EO_static_inline void s_eo_nv_unlock(const EOnv *nv)
+{
+    if(NULL != nv->rwl)
+    {
+        eov_rwlock_Release(nv->rwl);
+    }
+    else
+    {
+        eov_mutex_Release(nv->mtx);
+    }
+}
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -123,7 +164,7 @@ extern void eo_nv_Delete(EOnv *nv)
         return;    
     }   
     
-    eo_errman_Assert(eo_errman_GetHandle(), (eo_mempool_alloc_dynamic == eo_mempool_alloc_mode_Get(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_alloc_dynamic", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
+    eo_errman_Assert(eo_errman_GetHandle(), (eobool_true == eo_mempool_CanRelease(eo_mempool_GetHandle())), "eo_vector_Delete(): needs eo_mempool_alloc_dynamic or _slab", s_eobj_ownname, &eo_errman_DescrWrongUsageLocal);
   
     // at first clear.
     eo_nv_Clear(nv);
@@ -147,6 +188,7 @@ extern eOresult_t eo_nv_Clear(EOnv *nv)
     nv->rom         = NULL;       
     nv->ram         = NULL;  
     nv->mtx         = NULL;
+    nv->rwl         = NULL;
       
     return(eores_OK);
 }
@@ -229,9 +271,9 @@ extern eOresult_t eo_nv_Get(const EOnv *nv, eOnvStorage_t strg, void *data, uint
         {   // better to protect so that the copy is atomic and not interrupted by other tasks which write 
             source = nv->ram;       
             *size = s_eo_nv_get_size2(nv);  
-            eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+            s_eo_nv_lock_shared(nv);
             memcpy(data, source, *size); 
-            eov_mutex_Release(nv->mtx);
+            s_eo_nv_unlock(nv);
             res = eores_OK;
         } break;
 
@@ -265,9 +307,9 @@ extern eOresult_t eo_nv_Init(const EOnv *nv)
     // call the init function if existing
     if(NULL != nv->rom->init)
     {   // protect ...
-        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+        s_eo_nv_lock_exclusive(nv);
         nv->rom->init(nv);
-        eov_mutex_Release(nv->mtx);
+        s_eo_nv_unlock(nv);
         res = eores_OK;
     }
 
@@ -343,7 +385,7 @@ extern eOnvOwnership_t eo_nv_GetOwnership(const EOnv *nv)
 // --------------------------------------------------------------------------------------------------------------------
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx)
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, EOVrwlockDerived* rwl)
 {
     nv->ip          = ip;
     nv->brd         = brd;
@@ -353,15 +395,16 @@ extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eOboo
     nv->rom         = rom;
     nv->ram         = ram; 
     nv->mtx         = mtx;
+    nv->rwl         = rwl;
            
     return(eores_OK);
 }
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest)
 {
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    s_eo_nv_lock_shared(nv);
     memcpy(dest, nv->ram, nv->rom->capacity);
-    eov_mutex_Release(nv->mtx);    
+    s_eo_nv_unlock(nv);    
 }
 
 
@@ -462,9 +505,9 @@ extern eOresult_t eo_nv_hid_OnSay(const EOnv *nv, const eOropdescriptor_t* ropde
     // call the onsay function function if not NULL
     if(NULL != nv->onsay)
     {             
-        eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+        s_eo_nv_lock_exclusive(nv);
         nv->onsay(nv, ropdes);
-        eov_mutex_Release(nv->mtx);
+        s_eo_nv_unlock(nv);
     }
     
     return(eores_OK);
@@ -488,9 +531,9 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
     uint16_t size = s_eo_nv_get_size2(nv);
 
     // copy data
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    s_eo_nv_lock_exclusive(nv);
     memcpy(dst, dat, size);
-    eov_mutex_Release(nv->mtx);
+    s_eo_nv_unlock(nv);
 
     // call the update function if necessary
     s_eo_nv_UpdateROP(nv, upd, ropdes);
@@ -507,9 +550,9 @@ static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescr
         {
             if(NULL != nv->rom->update)
             {
-                eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+                s_eo_nv_lock_exclusive(nv);
                 nv->rom->update(nv, ropdes);
-                eov_mutex_Release(nv->mtx);
+                s_eo_nv_unlock(nv);
             }
         }
     }
@@ -54,6 +54,18 @@
 
 #undef EO_NVSET_INIT_EVERY_NV
 
+#if defined(EO_TAILOR_CODE_FOR_ARM)
+    #define EONV_DONT_USE_EOV_MUTEX_FUNCTIONS
+#endif
+
+// as in EOnv.c. the boards do not link the EOVrwlock, thus eo_nvset_RWlock_Set() refuses its constructor and no rwlock
+// is ever created. the mutex functions stay, because the boards have always used eov_mutex_Delete() in here.
+#if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
+    #define eov_rwlock_TakeExclusive(a, b)
+    #define eov_rwlock_Release(a)
+    #define eov_rwlock_Delete(a)
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
 // --------------------------------------------------------------------------------------------------------------------
@@ -65,7 +77,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgBasic =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) &eoprot_mn_basicEPcfg,
-    EO_INIT(.functions)       NULL     
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.circular)        eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgBasic =
@@ -82,7 +97,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgMax =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_maxEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.circular)        eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgMax =
@@ -100,7 +118,10 @@ static const EOconstvector s_eonvset_constvectofEPcfgStd =
     EO_INIT(.item_size)       sizeof(eOprot_EPcfg_t),
     EO_INIT(.dummy)           0,  
     EO_INIT(.stored_items)    (void*) eoprot_arrayof_stdEPcfg,
-    EO_INIT(.functions)       NULL          
+    EO_INIT(.functions)       NULL,
+    EO_INIT(.first)           0,
+    EO_INIT(.circular)        eobool_false,
+    EO_INIT(.filler)          0
 };
 
 const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
@@ -128,7 +149,18 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p);
 static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p);
 
 static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32);
+static EOVrwlockDerived* s_eo_nvset_get_nvrwlock(EOnvSet* p, eOnvID32_t id32);
+static eObool_t s_eo_nvset_rwlock_is_used(EOnvSet* p);
+static EOVrwlockDerived* s_eo_nvset_rwlock_new(EOnvSet* p);
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8);
+static eOresult_t s_eo_nvset_NV_load(EOnvSet* p, eOnvID32_t id32, EOnv* thenv);
+static void s_eo_nvset_lazy_prepare(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_lazy_initNV(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t prog, const EOnv* thenv);
+static void s_eo_nvset_lazy_initNVs(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index);
+static void s_eo_nvset_lazy_lock(eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_lazy_unlock(eOnvset_ep_t* theEndpoint);
+static eObool_t s_eo_nvset_lazy_anypending(eOnvset_ep_t* theEndpoint);
+static eObool_t s_eo_nvset_lazy_ispending(eOnvset_ep_t* theEndpoint, uint16_t prog);
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
 
@@ -154,12 +186,88 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
     // i dont initialise yet the device. i simply rely on the fact that it contains all zero data.
     p->theboard.ipaddress       = 0;    
     p->mtxderived_new           = mtxnew; 
-    p->protection               = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    p->protection               = prot; 
+    p->nvsinit                  = eo_nvset_nvsinit_eager;
+    memset(&p->ramprovider, 0, sizeof(p->ramprovider));
+    p->rwlderived_new           = NULL;
+    
+    if((NULL == mtxnew) && (eobool_false == s_eo_nvset_rwlock_is_used(p)))
+    {   // the rwlock protections get their locks from eo_nvset_RWlock_Set()
+        p->protection           = eo_nvset_protection_none;
+    }
 
     return(p);
 }
 
 
+extern eOresult_t eo_nvset_NVSinitmode_Set(EOnvSet* p, eOnvset_nvsinit_t mode)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((NULL != p->theboard.theendpoints) && (0 != eo_vector_Size(p->theboard.theendpoints)))
+    {   // too late: some endpoints are already loaded
+        return(eores_NOK_generic);
+    }
+    
+    p->nvsinit = mode;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_RAMprovider_Set(EOnvSet* p, const eOnvset_RAMprovider_t *provider)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((NULL != p->theboard.theendpoints) && (0 != eo_vector_Size(p->theboard.theendpoints)))
+    {   // too late: some endpoints already have their ram
+        return(eores_NOK_generic);
+    }
+    
+    if((NULL == provider) || (NULL == provider->get))
+    {
+        memset(&p->ramprovider, 0, sizeof(p->ramprovider));
+    }
+    else
+    {
+        memcpy(&p->ramprovider, provider, sizeof(p->ramprovider));
+    }
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_RWlock_Set(EOnvSet* p, eov_rwlock_fn_rwlockderived_new rwlnew)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL != p->theboard.theendpoints)
+    {   // too late: the board already has its locks
+        return(eores_NOK_generic);
+    }
+    
+#if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
+    if(NULL != rwlnew)
+    {
+        return(eores_NOK_unsupported);
+    }
+#endif
+    
+    p->rwlderived_new = rwlnew;
+    
+    return(eores_OK);
+}
+
+
 extern void eo_nvset_Delete(EOnvSet* p)
 {   
     if(NULL == p)
@@ -342,6 +450,12 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
     
     theEndpoint->initted = eobool_true;
     
+    if(eo_nvset_nvsinit_lazy == p->nvsinit)
+    {   // the NVs are initialised one by one at their first access
+        s_eo_nvset_lazy_prepare(p, theEndpoint);
+        return(eores_OK);
+    }
+    
 
 #define EO_NVSET_INIT_EVERY_NV
 #if defined(EO_NVSET_INIT_EVERY_NV)
@@ -359,6 +473,7 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
         eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
         
         EOVmutexDerived* mtx2use = NULL;
+        EOVrwlockDerived* rwl2use = (eo_nvset_protection_rwlock_one_per_board == p->protection) ? (theBoard->rwl_board) : (theEndpoint->rwl_endpoint);
 
         if(eo_nvset_protection_one_per_board == p->protection)
         {
@@ -406,7 +521,8 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
                                 onsay,
                                 rom,
                                 ram,
-                                mtx2use
+                                mtx2use,
+                                rwl2use
                           );                    
             
          
@@ -459,6 +575,11 @@ extern void* eo_nvset_RAMofEndpoint_Get(EOnvSet* p, eOnvEP8_t ep8)
         return(NULL); 
     }
     
+    if(eo_nvset_nvsinit_lazy == p->nvsinit)
+    {   // the caller may use any NV of the endpoint
+        s_eo_nvset_lazy_initNVs(p, ep8, EOK_uint08dummy, EOK_uint08dummy);
+    }
+    
     // get directly the ram using the eoprot function.     
     return(eoprot_endpoint_ramof_get(p->theboard.boardnum, ep8));   
 }
@@ -471,6 +592,11 @@ extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent,
         return(NULL); 
     }
     
+    if(eo_nvset_nvsinit_lazy == p->nvsinit)
+    {   // the caller may use any NV of the entity
+        s_eo_nvset_lazy_initNVs(p, ep8, ent, index);
+    }
+    
     // get directly the ram using the eoprot function.     
     return(eoprot_entity_ramof_get(p->theboard.boardnum, ep8, ent, index));
 }
@@ -482,6 +608,16 @@ extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32)
     {
         return(NULL); 
     }
+    
+    if(eo_nvset_nvsinit_lazy == p->nvsinit)
+    {
+        EOnv thenv = {0};
+        eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
+        if((NULL != theEndpoint) && (eobool_true == s_eo_nvset_lazy_anypending(theEndpoint)) && (eores_OK == s_eo_nvset_NV_load(p, id32, &thenv)))
+        {
+            s_eo_nvset_lazy_initNV(p, theEndpoint, eoprot_endpoint_id2prognum(p->theboard.boardnum, id32), &thenv);
+        }
+    }
 
     return(eoprot_variable_ramof_get(p->theboard.boardnum, id32));
 }
@@ -501,6 +637,35 @@ extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd)
 
 
 extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
+{
+    eOresult_t res = s_eo_nvset_NV_load(p, id32, thenv);
+    
+    if((eores_OK == res) && (eo_nvset_nvsinit_lazy == p->nvsinit))
+    {
+        eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
+        if((NULL != theEndpoint) && (eobool_true == s_eo_nvset_lazy_anypending(theEndpoint)))
+        {
+            s_eo_nvset_lazy_initNV(p, theEndpoint, eoprot_endpoint_id2prognum(p->theboard.boardnum, id32), thenv);
+        }
+    }
+    
+    return(res);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions 
+// --------------------------------------------------------------------------------------------------------------------
+
+
+static eOresult_t s_eo_nvset_NV_load(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
 {
     eOnvEP8_t ep8 = eoprot_ID2endpoint(id32); 
     uint8_t brd = 0; // local, or 0, 1, 2, 3 ...
@@ -508,6 +673,7 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     EOnv_rom_t* rom = NULL;
     uint8_t* ram = NULL;
     EOVmutexDerived* mtx2use = NULL;
+    EOVrwlockDerived* rwl2use = NULL;
     eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
  
     if((NULL == p) || (NULL == thenv)) 
@@ -534,11 +700,12 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
     // - 3. the mtx
     mtx2use = s_eo_nvset_get_nvmutex(p, id32);
+    rwl2use = s_eo_nvset_get_nvrwlock(p, id32);
         
     // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
     //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.
     
-    if((NULL == rom) || (NULL == ram))  // mtx2use can be NULL
+    if((NULL == rom) || (NULL == ram))  // mtx2use and rwl2use can be NULL
     {
         return(eores_NOK_generic); 
     }
@@ -553,23 +720,168 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
                         onsay,
                         rom,
                         ram,
-                        mtx2use
+                        mtx2use,
+                        rwl2use
                   );    
 
     return(eores_OK);
 }
 
 
+static void s_eo_nvset_lazy_prepare(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    uint16_t nwords = (theEndpoint->epnvsnumberof + 31) / 32;
+    uint16_t k = 0;
+    
+    if(0 == theEndpoint->epnvsnumberof)
+    {
+        return;
+    }
+    
+    theEndpoint->lazymask = (uint32_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(uint32_t), nwords);
+    memset(theEndpoint->lazymask, 0xff, nwords*sizeof(uint32_t));
+    if(0 != (theEndpoint->epnvsnumberof % 32))
+    {   // clear the bits beyond the last NV
+        theEndpoint->lazymask[nwords-1] = (1UL << (theEndpoint->epnvsnumberof % 32)) - 1;
+    }
+    theEndpoint->lazypending = theEndpoint->epnvsnumberof;
+    if(eobool_true == s_eo_nvset_rwlock_is_used(p))
+    {
+        theEndpoint->rwl_lazy = s_eo_nvset_rwlock_new(p);
+    }
+    else
+    {
+        theEndpoint->mtx_lazy = (eo_nvset_protection_none == p->protection) ? (NULL) : (p->mtxderived_new());
+    }
+    
+    // the prognumbers without a valid id32 never get an init()
+    for(k=0; k<theEndpoint->epnvsnumberof; k++)
+    {
+        if(EOK_uint32dummy == eoprot_endpoint_prognum2id(p->theboard.boardnum, theEndpoint->epcfg.endpoint, k))
+        {
+            theEndpoint->lazymask[k >> 5] &= ~(1UL << (k & 31));
+            theEndpoint->lazypending--;
+        }
+    }
+}
+
+
+static void s_eo_nvset_lazy_initNV(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t prog, const EOnv* thenv)
+{
+    uint32_t bit = 1UL << (prog & 31);
+    
+    if((NULL == theEndpoint->lazymask) || (prog >= theEndpoint->epnvsnumberof) || (eobool_false == s_eo_nvset_lazy_ispending(theEndpoint, prog)))
+    {   // no lazy init or already initialised
+        return;
+    }
+    
+    s_eo_nvset_lazy_lock(theEndpoint);
+    // check it again because some other thread may have done the init in the meantime
+    if(0 != (theEndpoint->lazymask[prog >> 5] & bit))
+    {
+        eo_nv_Init(thenv);
+        // we clear the bit only after the init, so that nobody can use the NV before it is initialised. the release
+        // pairs with the acquire of the checks done without the lock
+#if defined(EO_atomic_load_acquire)
+        EO_atomic_fetch_and_release(&theEndpoint->lazymask[prog >> 5], ~bit);
+        EO_atomic_fetch_sub_release(&theEndpoint->lazypending, 1);
+#else
+        theEndpoint->lazymask[prog >> 5] &= ~bit;
+        theEndpoint->lazypending--;
+#endif
+    }
+    s_eo_nvset_lazy_unlock(theEndpoint);
+}
 
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of extern hidden functions 
-// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eo_nvset_lazy_initNVs(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index)
+{   // if ent is EOK_uint08dummy it initialises all the pending NVs of the endpoint, else only those of entity (ent, index)
+    eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    uint16_t k = 0;
+    EOnv thenv = {0};
+    eOnvID32_t id32 = EOK_uint32dummy;
+    
+    if((NULL == theEndpoint) || (eobool_false == s_eo_nvset_lazy_anypending(theEndpoint)))
+    {
+        return;
+    }
+    
+    for(k=0; k<theEndpoint->epnvsnumberof; k++)
+    {
+        if(eobool_false == s_eo_nvset_lazy_ispending(theEndpoint, k))
+        {
+            continue;
+        }
+        
+        id32 = eoprot_endpoint_prognum2id(p->theboard.boardnum, ep8, k);
+        
+        if((EOK_uint08dummy != ent) && ((ent != eoprot_ID2entity(id32)) || (index != eoprot_ID2index(id32))))
+        {
+            continue;
+        }
+        
+        if(eores_OK == s_eo_nvset_NV_load(p, id32, &thenv))
+        {
+            s_eo_nvset_lazy_initNV(p, theEndpoint, k, &thenv);
+        }
+    }
+}
+
+
+static void s_eo_nvset_lazy_lock(eOnvset_ep_t* theEndpoint)
+{
+    if(NULL != theEndpoint->rwl_lazy)
+    {
+        eov_rwlock_TakeExclusive(theEndpoint->rwl_lazy, eok_reltimeINFINITE);
+    }
+    else
+    {
+        eov_mutex_Take(theEndpoint->mtx_lazy, eok_reltimeINFINITE);
+    }
+}
 
 
+static void s_eo_nvset_lazy_unlock(eOnvset_ep_t* theEndpoint)
+{
+    if(NULL != theEndpoint->rwl_lazy)
+    {
+        eov_rwlock_Release(theEndpoint->rwl_lazy);
+    }
+    else
+    {
+        eov_mutex_Release(theEndpoint->mtx_lazy);
+    }
+}
 
-// --------------------------------------------------------------------------------------------------------------------
-// - definition of static functions 
-// --------------------------------------------------------------------------------------------------------------------
+
+// lazymask and lazypending are written under the lock. where the porting gives atomics, they are read without it,
+// else the lock is taken also to read them.
+static eObool_t s_eo_nvset_lazy_anypending(eOnvset_ep_t* theEndpoint)
+{
+    uint16_t pending = 0;
+#if defined(EO_atomic_load_acquire)
+    pending = EO_atomic_load_acquire(&theEndpoint->lazypending);
+#else
+    s_eo_nvset_lazy_lock(theEndpoint);
+    pending = theEndpoint->lazypending;
+    s_eo_nvset_lazy_unlock(theEndpoint);
+#endif
+    return((0 != pending) ? (eobool_true) : (eobool_false));
+}
+
+
+static eObool_t s_eo_nvset_lazy_ispending(eOnvset_ep_t* theEndpoint, uint16_t prog)
+{
+    uint32_t word = 0;
+#if defined(EO_atomic_load_acquire)
+    word = EO_atomic_load_acquire(&theEndpoint->lazymask[prog >> 5]);
+#else
+    s_eo_nvset_lazy_lock(theEndpoint);
+    word = theEndpoint->lazymask[prog >> 5];
+    s_eo_nvset_lazy_unlock(theEndpoint);
+#endif
+    return((0 != (word & (1UL << (prog & 31)))) ? (eobool_true) : (eobool_false));
+}
 
 
 static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum)
@@ -592,6 +904,7 @@ static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, e
     theBoard->ownership             = ownership;
     theBoard->theendpoints          = eo_vector_New(sizeof(eOnvset_ep_t*), eo_vectorcapacity_dynamic, NULL, 0, NULL, NULL);    
     theBoard->mtx_board             = (eo_nvset_protection_one_per_board == p->protection) ? p->mtxderived_new() : NULL;
+    theBoard->rwl_board             = (eo_nvset_protection_rwlock_one_per_board == p->protection) ? s_eo_nvset_rwlock_new(p) : NULL;
     // reset the ep2indexlut to have all values EOK_uint16dummy
     {
         uint8_t i = 0;
@@ -618,6 +931,10 @@ static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p)
     {
         eov_mutex_Delete(theBoard->mtx_board);
     }
+    if(NULL != theBoard->rwl_board)
+    {
+        eov_rwlock_Delete(theBoard->rwl_board);
+    }
     
     
     // so that we know that everything is deinitted
@@ -671,8 +988,31 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     
     theEndpoint->epnvsnumberof      = epnvsnumberof;
     theEndpoint->initted            = eobool_false;    
-    theEndpoint->epram              = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+    if(NULL != p->ramprovider.get)
+    {
+        theEndpoint->epram          = p->ramprovider.get(p->ramprovider.owner, brd, theEndpoint->epcfg.endpoint, sizeofram);
+        if(NULL == theEndpoint->epram)
+        {
+            char str[64] = {0};
+            snprintf(str, sizeof(str), "EOnvSet: ep %d has no ram from provider", cfgofep->endpoint);  
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, str, NULL, &eo_errman_DescrRuntimeErrorLocal); 
+            
+            eoprot_config_endpoint_entities(brd, theEndpoint->epcfg.endpoint, NULL);
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint); 
+            
+            return(eores_NOK_generic);         
+        }
+    }
+    else
+    {
+        theEndpoint->epram          = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+    }
     theEndpoint->mtx_endpoint       = (eo_nvset_protection_one_per_endpoint == p->protection) ? p->mtxderived_new() : NULL;
+    theEndpoint->lazymask           = NULL;
+    theEndpoint->lazypending        = 0;
+    theEndpoint->mtx_lazy           = NULL;
+    theEndpoint->rwl_endpoint       = (eo_nvset_protection_rwlock_one_per_endpoint == p->protection) ? s_eo_nvset_rwlock_new(p) : NULL;
+    theEndpoint->rwl_lazy           = NULL;
         
     // now we must load the ram in the endpoint
     eoprot_config_endpoint_ram(brd, theEndpoint->epcfg.endpoint, theEndpoint->epram, sizeofram);
@@ -724,7 +1064,29 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         eOnvset_ep_t *theEndpoint = *ppep;
         
         // now i erase memory associated with this endpoint
-        eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        if(NULL != p->ramprovider.get)
+        {
+            if(NULL != p->ramprovider.release)
+            {
+                p->ramprovider.release(p->ramprovider.owner, theEndpoint->epram);
+            }
+        }
+        else
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        }
+        if(NULL != theEndpoint->lazymask)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->lazymask);
+        }
+        if(NULL != theEndpoint->mtx_lazy)
+        {
+            eov_mutex_Delete(theEndpoint->mtx_lazy);
+        }
+        if(NULL != theEndpoint->rwl_lazy)
+        {
+            eov_rwlock_Delete(theEndpoint->rwl_lazy);
+        }
         // and i dissociates that from from the internals of the eoprot library
         eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL, 0);
         // i also de-init the number of entities for that endpoint
@@ -736,6 +1098,10 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         {
             eov_mutex_Delete(theEndpoint->mtx_endpoint);
         }
+        if(NULL != theEndpoint->rwl_endpoint)
+        {
+            eov_rwlock_Delete(theEndpoint->rwl_endpoint);
+        }
         if(NULL != theEndpoint->themtxofthenvs)
         {
             uint16_t size = eo_vector_Size(theEndpoint->themtxofthenvs);
@@ -810,6 +1176,39 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+static EOVrwlockDerived* s_eo_nvset_get_nvrwlock(EOnvSet* p, eOnvID32_t id32)
+{
+    EOVrwlockDerived* rwl2use = NULL;
+    
+    if(eo_nvset_protection_rwlock_one_per_board == p->protection)
+    {
+        rwl2use = p->theboard.rwl_board;
+    }
+    else if(eo_nvset_protection_rwlock_one_per_endpoint == p->protection)
+    {
+        eOnvset_ep_t* theEndpoint = s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32));
+        if(NULL != theEndpoint)
+        {
+            rwl2use = theEndpoint->rwl_endpoint;
+        }  
+    }
+    
+    return(rwl2use);
+}
+
+
+static eObool_t s_eo_nvset_rwlock_is_used(EOnvSet* p)
+{
+    return(((eo_nvset_protection_rwlock_one_per_board == p->protection) || (eo_nvset_protection_rwlock_one_per_endpoint == p->protection)) ? (eobool_true) : (eobool_false));
+}
+
+
+static EOVrwlockDerived* s_eo_nvset_rwlock_new(EOnvSet* p)
+{
+    return((NULL == p->rwlderived_new) ? (NULL) : (p->rwlderived_new()));
+}
+
+
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
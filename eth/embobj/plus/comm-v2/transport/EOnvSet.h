@@ -44,6 +44,7 @@ extern "C" {
 #include "EOnv.h"
 #include "EOconstvector.h"
 #include "EOVmutex.h"
+#include "EOVrwlock.h"
 #include "EoProtocol.h"
 
 // - public #define  --------------------------------------------------------------------------------------------------
@@ -100,9 +101,34 @@ typedef enum
     eo_nvset_protection_none               = 0,    /**< we dont protect vs concurrent access at all */
     eo_nvset_protection_one_per_board      = 2,    /**< all the NVs in a booard share the same mutex */
     eo_nvset_protection_one_per_endpoint   = 3,    /**< all the NVs in an endpoint inside each board share the same mutex */
-    eo_nvset_protection_one_per_netvar     = 4     /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_one_per_netvar     = 4,    /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_rwlock_one_per_board    = 5,    /**< all the NVs in a board share the same reader-writer lock. see eo_nvset_RWlock_Set() */
+    eo_nvset_protection_rwlock_one_per_endpoint = 6     /**< all the NVs in an endpoint share the same reader-writer lock. see eo_nvset_RWlock_Set() */
 } eOnvset_protection_t;
 
+
+/** @typedef    typedef enum eOnvset_nvsinit_t
+    @brief      It tells when the init() function of the NVs of an endpoint is called. 
+ **/ 
+typedef enum
+{
+    eo_nvset_nvsinit_eager      = 0,    /**< all the NVs are initialised together with their endpoint */
+    eo_nvset_nvsinit_lazy       = 1     /**< every NV is initialised at its first access with eo_nvset_NV_Get() or eo_nvset_RAMof*_Get() */
+} eOnvset_nvsinit_t;
+
+
+/** @typedef    typedef struct eOnvset_RAMprovider_t
+    @brief      It allows to place the RAM of the endpoints outside of the EOtheMemoryPool, for instance inside a 
+                shared memory segment. get() returns sizeofram bytes for the endpoint ep8 of board brd, release()
+                gives them back when the endpoint is unloaded. owner is passed to both of them. 
+ **/ 
+typedef struct
+{
+    void*       (*get)(void *owner, eOnvBRD_t brd, eOnvEP8_t ep8, uint16_t sizeofram);
+    void        (*release)(void *owner, void *ram);
+    void*       owner;
+} eOnvset_RAMprovider_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -119,6 +145,21 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
 
 extern void eo_nvset_Delete(EOnvSet* p);
 
+// it sets the initialisation mode of the NVs. it must be called before the endpoints are loaded. the default is eo_nvset_nvsinit_eager.
+// in lazy mode, concurrent first accesses to the NVs are safe only if the EOnvSet has a protection other than eo_nvset_protection_none.
+extern eOresult_t eo_nvset_NVSinitmode_Set(EOnvSet* p, eOnvset_nvsinit_t mode);
+
+// it sets who gives the RAM of the endpoints. it must be called before the endpoints are loaded. if never called or if provider
+// is NULL, the RAM comes from the EOtheMemoryPool. the provider is copied, hence it can be a local variable.
+extern eOresult_t eo_nvset_RAMprovider_Set(EOnvSet* p, const eOnvset_RAMprovider_t *provider);
+
+// it sets the function which creates the reader-writer locks used by the eo_nvset_protection_rwlock_* protections. with them 
+// eo_nv_Get() and the refresh of the regular ROPs take the lock in shared mode, thus many readers can go at the same time,
+// whereas eo_nv_Set(), eo_nv_Reset() and the calls of init(), update() and onsay() take it in exclusive mode. it must be 
+// called before eo_nvset_InitBRD(). if never called the NVs are not protected. on the boards, which do not have the EOVrwlock, 
+// it returns eores_NOK_unsupported for a non-NULL rwlnew.
+extern eOresult_t eo_nvset_RWlock_Set(EOnvSet* p, eov_rwlock_fn_rwlockderived_new rwlnew);
+
 
 extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum);
 
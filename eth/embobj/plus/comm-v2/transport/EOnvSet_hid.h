@@ -38,6 +38,7 @@ extern "C" {
 #include "EOvector.h"
 #include "EOconstvector.h"
 #include "EOVmutex.h"
+#include "EOVrwlock.h"
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
  
@@ -58,6 +59,11 @@ typedef struct
     void*                               epram;    
     EOVmutexDerived*                    mtx_endpoint;    
     EOvector*                           themtxofthenvs;    
+    uint32_t*                           lazymask;           // in lazy mode: bit prog is 1 if the NV still needs its init()
+    uint16_t                            lazypending;        // in lazy mode: number of bits at 1 in lazymask
+    EOVmutexDerived*                    mtx_lazy;    
+    EOVrwlockDerived*                   rwl_endpoint;
+    EOVrwlockDerived*                   rwl_lazy;           // in lazy mode w/ a rwlock protection: used in place of mtx_lazy
 } eOnvset_ep_t;
 
 
@@ -69,6 +75,7 @@ typedef struct
     EOvector*                       theendpoints;       // of eOnvset_ep_t items
     EOVmutexDerived*                mtx_board;    
     uint16_t                        ep2indexlut[eonvset_max_endpoint_value+1];    
+    EOVrwlockDerived*               rwl_board;
 } eOnvset_brd_t;
 
 
@@ -84,6 +91,9 @@ struct EOnvSet_hid
     eOnvset_brd_t                   theboard;
     eOnvset_protection_t            protection;
     eov_mutex_fn_mutexderived_new   mtxderived_new;
+    eOnvset_nvsinit_t               nvsinit;
+    eOnvset_RAMprovider_t           ramprovider;
+    eov_rwlock_fn_rwlockderived_new rwlderived_new;
 };   
  
 
@@ -36,6 +36,7 @@ extern "C" {
 #include "EoCommon.h"
 #include "EOrop.h"
 #include "EOVmutex.h"
+#include "EOVrwlock.h"
 
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
@@ -60,6 +61,12 @@ typedef struct EOnv_rom_T           // 16 bytes on arm
     eOvoid_fp_cnvp_cropdesp_t       update;     // called after the nv value is changed by the protocol parser or by any other object (in this latter case ropdes is NULL)   
 } EOnv_rom_t;                       //EO_VERIFYsizeof(EOnv_rom_t, 16) 
 
+#if defined(EO_TAILOR_CODE_FOR_ARM)
+// the descriptors are in the flash of the boards: the offset of the nv inside its entity is in the flat tables
+// eoprot_ep_offsets[] rather than in here
+EO_VERIFYsizeof(EOnv_rom_t, 16)
+#endif
+
 
 
 struct EOnv_hid                    // 28 bytes ... 
@@ -73,6 +80,7 @@ struct EOnv_hid                    // 28 bytes ...
     EOnv_rom_t*                     rom;        // pointer to the constant part common to every device which uses this nv
     void*                           ram;        // the ram which keeps the LOCAL value of nv 
     EOVmutexDerived*                mtx;        // the mutex which protects concurrent access to the ram of this nv 
+    EOVrwlockDerived*               rwl;        // if not NULL it is used instead of mtx: shared by the readers, exclusive for the writers
 };  //EO_VERIFYsizeof(EOnv, 28)   
 
 
@@ -87,7 +95,7 @@ struct EOnv_hid                    // 28 bytes ...
 //extern EOnv * eo_nv_hid_New(uint8_t fun, uint8_t typ, uint32_t otherthingsmaybe);
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx);
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, EOVrwlockDerived* rwl);
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest);
 
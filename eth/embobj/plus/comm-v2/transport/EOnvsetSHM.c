@@ -0,0 +1,607 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "EoCommon.h"
+#include "string.h"
+#include "stdio.h"
+#include "EOtheMemoryPool.h"
+#include "EOtheErrorManager.h"
+
+#if defined(EO_TAILOR_CODE_FOR_POSIX)
+    #define EONVSETSHM_USE_POSIX
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sched.h>
+    #include <signal.h>
+    #include <errno.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOnvsetSHM.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EOnvsetSHM_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the ram of every endpoint starts at a multiple of 8 bytes, as it would if it came from the EOtheMemoryPool
+#define EONVSETSHM_ALIGN(n)         (((n) + 7) & ~((uint32_t)7))
+
+// eo_nvsetshm_Read() spins this many times while the writer is inside WriteBegin() / WriteEnd(), then it yields the
+// cpu at every retry. after the max number of retries it gives up
+#define EONVSETSHM_READ_spins       64
+#define EONVSETSHM_READ_maxretries  100000
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static EOnvsetSHM * s_eo_nvsetshm_new(const char *name, eObool_t writer, uint32_t capacity);
+
+static void * s_eo_nvsetshm_ram_get(void *owner, eOnvBRD_t brd, eOnvEP8_t ep8, uint16_t sizeofram);
+
+static void s_eo_nvsetshm_ram_release(void *owner, void *ram);
+
+static uint32_t s_eo_nvsetshm_sequence_load(const eOnvsetshm_header_t *header);
+
+static void s_eo_nvsetshm_sequence_store(eOnvsetshm_header_t *header, uint32_t value);
+
+static eOresult_t s_eo_nvsetshm_read_begin(const EOnvsetSHM *p, uint32_t *retries, uint32_t *sequence);
+
+static eObool_t s_eo_nvsetshm_read_end(const EOnvsetSHM *p, uint32_t sequence);
+
+static void s_eo_nvsetshm_read_backoff(uint32_t retries);
+
+static eObool_t s_eo_nvsetshm_reclaim(const char *name);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const char s_eobj_ownname[] = "EOnvsetSHM";
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+
+extern EOnvsetSHM * eo_nvsetshm_NewWriter(const char *name, uint32_t capacity)
+{
+    if((NULL == name) || (0 == capacity))
+    {
+        return(NULL);
+    }
+
+    return(s_eo_nvsetshm_new(name, eobool_true, capacity));
+}
+
+
+extern EOnvsetSHM * eo_nvsetshm_NewReader(const char *name)
+{
+    if(NULL == name)
+    {
+        return(NULL);
+    }
+
+    return(s_eo_nvsetshm_new(name, eobool_false, 0));
+}
+
+
+extern void eo_nvsetshm_Delete(EOnvsetSHM *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+#if defined(EONVSETSHM_USE_POSIX)
+    if(NULL != p->header)
+    {
+        munmap(p->header, p->mappedsize);
+    }
+
+    if(eobool_true == p->writer)
+    {
+        shm_unlink(p->name);
+    }
+#endif
+
+    memset(p, 0, sizeof(EOnvsetSHM));
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern const eOnvset_RAMprovider_t * eo_nvsetshm_RAMprovider_Get(EOnvsetSHM *p)
+{
+    if((NULL == p) || (eobool_false == p->writer))
+    {
+        return(NULL);
+    }
+
+    return(&p->ramprovider);
+}
+
+
+extern eOresult_t eo_nvsetshm_WriteBegin(EOnvsetSHM *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_false == p->writer)
+    {
+        return(eores_NOK_generic);
+    }
+
+    // odd value: the readers wait or retry
+    s_eo_nvsetshm_sequence_store(p->header, p->header->sequence + 1);
+#if defined(EONVSETSHM_USE_POSIX)
+    EO_atomic_thread_fence_release();
+#endif
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvsetshm_WriteEnd(EOnvsetSHM *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_false == p->writer)
+    {
+        return(eores_NOK_generic);
+    }
+
+    // even value: the ram is consistent again
+    s_eo_nvsetshm_sequence_store(p->header, p->header->sequence + 1);
+
+    return(eores_OK);
+}
+
+
+extern eOnvBRD_t eo_nvsetshm_BRD_Get(EOnvsetSHM *p)
+{
+    eOnvBRD_t brd = eo_nv_BRDdummy;
+    uint32_t sequence = 0;
+    uint32_t retries = 0;
+
+    if(NULL == p)
+    {
+        return(eo_nv_BRDdummy);
+    }
+
+    do
+    {
+        if(eores_OK != s_eo_nvsetshm_read_begin(p, &retries, &sequence))
+        {
+            return(eo_nv_BRDdummy);
+        }
+        brd = p->header->boardnum;
+    } while(eobool_false == s_eo_nvsetshm_read_end(p, sequence));
+
+    return(brd);
+}
+
+
+extern uint16_t eo_nvsetshm_SizeofEndpoint_Get(EOnvsetSHM *p, eOnvEP8_t ep8)
+{
+    uint16_t size = 0;
+    uint32_t sequence = 0;
+    uint32_t retries = 0;
+
+    if((NULL == p) || (ep8 > eonvset_max_endpoint_value))
+    {
+        return(0);
+    }
+
+    do
+    {
+        if(eores_OK != s_eo_nvsetshm_read_begin(p, &retries, &sequence))
+        {
+            return(0);
+        }
+        size = p->header->endpoints[ep8].size;
+    } while(eobool_false == s_eo_nvsetshm_read_end(p, sequence));
+
+    return(size);
+}
+
+
+extern eOresult_t eo_nvsetshm_Read(EOnvsetSHM *p, eOnvEP8_t ep8, uint16_t offset, void *data, uint16_t size)
+{
+    eOnvsetshm_ep_t ep = {0};
+    eObool_t valid = eobool_false;
+    uint32_t sequence = 0;
+    uint32_t retries = 0;
+
+    if((NULL == p) || (NULL == data))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(ep8 > eonvset_max_endpoint_value)
+    {
+        return(eores_NOK_generic);
+    }
+
+    do
+    {
+        if(eores_OK != s_eo_nvsetshm_read_begin(p, &retries, &sequence))
+        {
+            return(eores_NOK_timeout);
+        }
+
+        // the writer may move or remove the endpoint at any time, thus its place is checked at every retry. a torn
+        // value is discarded either by the check or by the sequence, but it never makes the copy go outside the map
+        ep.offset = p->header->endpoints[ep8].offset;
+        ep.size = p->header->endpoints[ep8].size;
+        valid = ((0 != ep.offset) && (((uint32_t)offset + size) <= ep.size) && ((ep.offset + ep.size) <= p->mappedsize)) ? (eobool_true) : (eobool_false);
+
+        if(eobool_true == valid)
+        {
+            memcpy(data, (const uint8_t*)p->header + ep.offset + offset, size);
+        }
+    } while(eobool_false == s_eo_nvsetshm_read_end(p, sequence));
+
+    return((eobool_true == valid) ? (eores_OK) : (eores_NOK_generic));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static EOnvsetSHM * s_eo_nvsetshm_new(const char *name, eObool_t writer, uint32_t capacity)
+{
+#if defined(EONVSETSHM_USE_POSIX)
+
+    EOnvsetSHM *p = NULL;
+    int fd = -1;
+    uint32_t mappedsize = 0;
+    void *addr = MAP_FAILED;
+
+    if(strlen(name) >= sizeof(p->name))
+    {
+        return(NULL);
+    }
+
+    if(eobool_true == writer)
+    {
+        mappedsize = sizeof(eOnvsetshm_header_t) + EONVSETSHM_ALIGN(capacity);
+        // a segment with the same name may still be mapped by some reader: resizing it with ftruncate() would give
+        // them a SIGBUS. if its writer is dead we mark it as invalid and unlink it, and we create a new one which
+        // nobody else has mapped. O_EXCL makes us fail if another writer creates it in the meantime
+        if(eobool_false == s_eo_nvsetshm_reclaim(name))
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_nvsetshm_NewWriter(): segment used by another writer", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            return(NULL);
+        }
+        fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+        if((fd < 0) || (0 != ftruncate(fd, mappedsize)))
+        {
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_nvsetshm_NewWriter(): cannot create segment", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            if(fd >= 0)
+            {
+                close(fd);
+            }
+            return(NULL);
+        }
+        addr = mmap(NULL, mappedsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    else
+    {
+        struct stat st;
+        fd = shm_open(name, O_RDONLY, 0);
+        if((fd < 0) || (0 != fstat(fd, &st)) || (st.st_size < (off_t)sizeof(eOnvsetshm_header_t)))
+        {
+            if(fd >= 0)
+            {
+                close(fd);
+            }
+            return(NULL);
+        }
+        mappedsize = (uint32_t)st.st_size;
+        addr = mmap(NULL, mappedsize, PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    // the mapping stays valid after the close of its descriptor
+    close(fd);
+
+    if(MAP_FAILED == addr)
+    {
+        return(NULL);
+    }
+
+    p = (EOnvsetSHM*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeof(EOnvsetSHM), 1);
+
+    p->header       = (eOnvsetshm_header_t*)addr;
+    p->mappedsize   = mappedsize;
+    p->writer       = writer;
+    snprintf(p->name, sizeof(p->name), "%s", name);
+
+    if(eobool_true == writer)
+    {
+        // the sequence stays odd while the header is written
+        s_eo_nvsetshm_sequence_store(p->header, 1);
+        memset(p->header->endpoints, 0, sizeof(p->header->endpoints));
+        p->header->magic        = EOK_NVSETSHM_magic;
+        p->header->version      = EOK_NVSETSHM_version;
+        p->header->boardnum     = eo_nv_BRDdummy;
+        p->header->capacity     = mappedsize - sizeof(eOnvsetshm_header_t);
+        p->header->used         = 0;
+        p->header->writerpid    = (uint32_t)getpid();
+        s_eo_nvsetshm_sequence_store(p->header, 2);
+
+        p->ramprovider.get      = s_eo_nvsetshm_ram_get;
+        p->ramprovider.release  = s_eo_nvsetshm_ram_release;
+        p->ramprovider.owner    = p;
+    }
+    else if((EOK_NVSETSHM_magic != p->header->magic) || (EOK_NVSETSHM_version != p->header->version) ||
+            (mappedsize < (sizeof(eOnvsetshm_header_t) + p->header->capacity)))
+    {
+        munmap(addr, mappedsize);
+        memset(p, 0, sizeof(EOnvsetSHM));
+        eo_mempool_Delete(eo_mempool_GetHandle(), p);
+        return(NULL);
+    }
+
+    return(p);
+
+#else
+
+    return(NULL);
+
+#endif
+}
+
+
+static void * s_eo_nvsetshm_ram_get(void *owner, eOnvBRD_t brd, eOnvEP8_t ep8, uint16_t sizeofram)
+{
+    EOnvsetSHM *p = (EOnvsetSHM*)owner;
+    eOnvsetshm_header_t *header = p->header;
+    uint32_t size = EONVSETSHM_ALIGN(sizeofram);
+    uint8_t *ram = NULL;
+
+    if((ep8 > eonvset_max_endpoint_value) || (0 != header->endpoints[ep8].offset))
+    {   // invalid or already given
+        return(NULL);
+    }
+
+    if((eo_nv_BRDdummy != header->boardnum) && (brd != header->boardnum))
+    {   // a segment contains only one board
+        return(NULL);
+    }
+
+    if((header->used + size) > header->capacity)
+    {
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "s_eo_nvsetshm_ram_get(): segment is too small", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+        return(NULL);
+    }
+
+    ram = (uint8_t*)header + sizeof(eOnvsetshm_header_t) + header->used;
+    memset(ram, 0, size);
+
+    eo_nvsetshm_WriteBegin(p);
+    header->boardnum                = brd;
+    header->endpoints[ep8].offset   = sizeof(eOnvsetshm_header_t) + header->used;
+    header->endpoints[ep8].size     = sizeofram;
+    header->used                   += size;
+    eo_nvsetshm_WriteEnd(p);
+
+    return(ram);
+}
+
+
+static void s_eo_nvsetshm_ram_release(void *owner, void *ram)
+{
+    EOnvsetSHM *p = (EOnvsetSHM*)owner;
+    eOnvsetshm_header_t *header = p->header;
+    uint32_t offset = (uint32_t)((uint8_t*)ram - (uint8_t*)header);
+    uint8_t i = 0;
+
+    // the space is not given back: the segment is sized for a single load of the endpoints. we just hide the
+    // endpoint to the readers
+    for(i=0; i<=eonvset_max_endpoint_value; i++)
+    {
+        if(offset == header->endpoints[i].offset)
+        {
+            eo_nvsetshm_WriteBegin(p);
+            header->endpoints[i].offset = 0;
+            header->endpoints[i].size   = 0;
+            eo_nvsetshm_WriteEnd(p);
+            break;
+        }
+    }
+}
+
+
+static uint32_t s_eo_nvsetshm_sequence_load(const eOnvsetshm_header_t *header)
+{
+#if defined(EONVSETSHM_USE_POSIX)
+    return(EO_atomic_load_acquire(&header->sequence));
+#else
+    return(header->sequence);
+#endif
+}
+
+
+static void s_eo_nvsetshm_sequence_store(eOnvsetshm_header_t *header, uint32_t value)
+{
+#if defined(EONVSETSHM_USE_POSIX)
+    EO_atomic_store_release(&header->sequence, value);
+#else
+    header->sequence = value;
+#endif
+}
+
+
+// it waits until the writer is outside WriteBegin() / WriteEnd() and it gives the sequence to be passed to
+// s_eo_nvsetshm_read_end() after the reads. it gives eores_NOK_timeout after the max number of retries
+static eOresult_t s_eo_nvsetshm_read_begin(const EOnvsetSHM *p, uint32_t *retries, uint32_t *sequence)
+{
+    for(;; (*retries)++)
+    {
+        if(*retries > 0)
+        {
+            if(*retries >= EONVSETSHM_READ_maxretries)
+            {   // the writer is too slow or it has died inside WriteBegin() / WriteEnd()
+                return(eores_NOK_timeout);
+            }
+            s_eo_nvsetshm_read_backoff(*retries);
+        }
+
+        *sequence = s_eo_nvsetshm_sequence_load(p->header);
+        if(0 == (*sequence & 1))
+        {
+            return(eores_OK);
+        }
+    }
+}
+
+
+// it tells if the values read after s_eo_nvsetshm_read_begin() are consistent. if not, the reads must be retried
+static eObool_t s_eo_nvsetshm_read_end(const EOnvsetSHM *p, uint32_t sequence)
+{
+    uint32_t now = 0;
+
+#if defined(EONVSETSHM_USE_POSIX)
+    EO_atomic_thread_fence_acquire();
+    now = EO_atomic_load_relaxed(&p->header->sequence);
+#else
+    now = p->header->sequence;
+#endif
+
+    return((now == sequence) ? (eobool_true) : (eobool_false));
+}
+
+
+static void s_eo_nvsetshm_read_backoff(uint32_t retries)
+{
+#if defined(EONVSETSHM_USE_POSIX)
+    if(retries < EONVSETSHM_READ_spins)
+    {
+    #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+    #elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+    #endif
+    }
+    else
+    {
+        sched_yield();
+    }
+#endif
+}
+
+
+// it tells if the name can be used by a new writer: either there is no segment or its writer has ended without
+// deleting it. in the latter case the readers which still map it see an odd sequence forever, thus their
+// eo_nvsetshm_Read() returns eores_NOK_timeout and they know that they must call eo_nvsetshm_NewReader() again
+static eObool_t s_eo_nvsetshm_reclaim(const char *name)
+{
+#if defined(EONVSETSHM_USE_POSIX)
+    struct stat st;
+    eOnvsetshm_header_t *header = NULL;
+    eObool_t reclaimed = eobool_false;
+    pid_t writer = 0;
+    int fd = shm_open(name, O_RDWR, 0);
+
+    if(fd < 0)
+    {
+        return((ENOENT == errno) ? (eobool_true) : (eobool_false));
+    }
+
+    if((0 == fstat(fd, &st)) && (st.st_size >= (off_t)sizeof(eOnvsetshm_header_t)))
+    {
+        header = (eOnvsetshm_header_t*) mmap(NULL, sizeof(eOnvsetshm_header_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(MAP_FAILED != (void*)header)
+        {
+            if((EOK_NVSETSHM_magic == header->magic) && (EOK_NVSETSHM_version == header->version))
+            {
+                // kill() with no signal tells if the process exists. EPERM means that it exists with another user
+                writer = (pid_t)header->writerpid;
+                if((0 == writer) || ((0 != kill(writer, 0)) && (ESRCH == errno)))
+                {
+                    s_eo_nvsetshm_sequence_store(header, s_eo_nvsetshm_sequence_load(header) | 1);
+                    reclaimed = eobool_true;
+                }
+            }
+            munmap(header, sizeof(eOnvsetshm_header_t));
+        }
+    }
+
+    close(fd);
+
+    if(eobool_true == reclaimed)
+    {
+        shm_unlink(name);
+    }
+
+    return(reclaimed);
+#else
+    return(eobool_false);
+#endif
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
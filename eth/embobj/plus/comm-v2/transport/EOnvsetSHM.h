@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETSHM_H_
+#define _EONVSETSHM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EOnvsetSHM.h
+    @brief      This header file implements public interface to the shared memory which contains the RAM of an EOnvSet.
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_nvsetshm Object EOnvsetSHM
+    The EOnvsetSHM places the RAM of the endpoints of an EOnvSet inside a POSIX shared memory segment, so that other
+    processes on the same host can read the status of a board without running their own EOhostTransceiver.
+    The process which owns the EOnvSet (the writer) creates the segment with eo_nvsetshm_NewWriter() and passes
+    the RAM provider returned by eo_nvsetshm_RAMprovider_Get() to eo_nvset_RAMprovider_Set() or to the
+    .nvsetramprovider of eOhosttransceiver_cfg_t. Then it encloses every change of the RAM (e.g., the call of
+    eo_transceiver_Receive()) between eo_nvsetshm_WriteBegin() and eo_nvsetshm_WriteEnd().
+    The other processes (the readers) map the segment read-only with eo_nvsetshm_NewReader() and get consistent
+    copies of the RAM with eo_nvsetshm_Read(), which uses a sequence lock and never blocks the writer.
+    On systems without POSIX shared memory the constructors return NULL.
+
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOnvSet.h"
+
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define EOK_NVSETSHM_magic          0x564e4f45      // "EONV"
+#define EOK_NVSETSHM_version        1
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+
+/** @typedef    typedef struct EOnvsetSHM_hid EOnvsetSHM
+    @brief      EOnvsetSHM is an opaque struct. It is used to implement data abstraction for the object
+                so that the user cannot see its private fields and he/she is forced to manipulate the
+                object only with the proper public functions.
+ **/
+typedef struct EOnvsetSHM_hid EOnvsetSHM;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+
+/** @fn         extern EOnvsetSHM * eo_nvsetshm_NewWriter(const char *name, uint32_t capacity)
+    @brief      Creates the shared memory segment @e name, able to contain @e capacity bytes of RAM of endpoints,
+                and maps it read-write. If a segment with the same name exists and its writer is still alive, or it
+                is not a segment of a EOnvsetSHM, the function fails. If its writer has ended without deleting it,
+                the segment is marked as invalid, so that eo_nvsetshm_Read() on its readers returns eores_NOK_timeout,
+                and it is replaced.
+    @param      name        The name of the segment, in the form "/somename".
+    @param      capacity    The max number of bytes of RAM of all the endpoints (e.g., sum of eoprot_endpoint_sizeof_get()).
+    @return     The object or NULL upon failure.
+ **/
+extern EOnvsetSHM * eo_nvsetshm_NewWriter(const char *name, uint32_t capacity);
+
+
+/** @fn         extern EOnvsetSHM * eo_nvsetshm_NewReader(const char *name)
+    @brief      Maps read-only the shared memory segment @e name created by a writer.
+    @param      name        The name of the segment.
+    @return     The object or NULL upon failure or if the segment has an unknown magic or version.
+ **/
+extern EOnvsetSHM * eo_nvsetshm_NewReader(const char *name);
+
+
+/** @fn         extern void eo_nvsetshm_Delete(EOnvsetSHM *p)
+    @brief      Unmaps the segment. The writer also removes its name, but the readers keep on seeing it until they
+                delete their objects. The EOnvSet which uses the segment must be deleted before.
+    @param      p           The object.
+ **/
+extern void eo_nvsetshm_Delete(EOnvsetSHM *p);
+
+
+/** @fn         extern const eOnvset_RAMprovider_t * eo_nvsetshm_RAMprovider_Get(EOnvsetSHM *p)
+    @brief      Gives the RAM provider to be used by the EOnvSet of the writer.
+    @param      p           The object.
+    @return     The provider or NULL if @e p is not a writer.
+ **/
+extern const eOnvset_RAMprovider_t * eo_nvsetshm_RAMprovider_Get(EOnvsetSHM *p);
+
+
+/** @fn         extern eOresult_t eo_nvsetshm_WriteBegin(EOnvsetSHM *p)
+    @brief      Tells the readers that the writer is changing the RAM. It must be followed by eo_nvsetshm_WriteEnd().
+    @param      p           The object.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if @e p is not a writer.
+ **/
+extern eOresult_t eo_nvsetshm_WriteBegin(EOnvsetSHM *p);
+
+
+/** @fn         extern eOresult_t eo_nvsetshm_WriteEnd(EOnvsetSHM *p)
+    @brief      Tells the readers that the RAM is consistent again.
+    @param      p           The object.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if @e p is not a writer.
+ **/
+extern eOresult_t eo_nvsetshm_WriteEnd(EOnvsetSHM *p);
+
+
+/** @fn         extern eOnvBRD_t eo_nvsetshm_BRD_Get(EOnvsetSHM *p)
+    @brief      Gives the number of the board whose RAM is inside the segment.
+    @param      p           The object.
+    @return     The board number or eo_nv_BRDdummy if no endpoint was placed in the segment yet or if no consistent
+                value was obtained, as for eo_nvsetshm_Read().
+ **/
+extern eOnvBRD_t eo_nvsetshm_BRD_Get(EOnvsetSHM *p);
+
+
+/** @fn         extern uint16_t eo_nvsetshm_SizeofEndpoint_Get(EOnvsetSHM *p, eOnvEP8_t ep8)
+    @brief      Gives the size of the RAM of endpoint @e ep8.
+    @param      p           The object.
+    @param      ep8         The endpoint.
+    @return     The size or 0 if the endpoint is not inside the segment or if no consistent value was obtained,
+                as for eo_nvsetshm_Read().
+ **/
+extern uint16_t eo_nvsetshm_SizeofEndpoint_Get(EOnvsetSHM *p, eOnvEP8_t ep8);
+
+
+/** @fn         extern eOresult_t eo_nvsetshm_Read(EOnvsetSHM *p, eOnvEP8_t ep8, uint16_t offset, void *data, uint16_t size)
+    @brief      Copies @e size bytes of the RAM of endpoint @e ep8 starting from @e offset into @e data. The copy is
+                repeated until the writer did not change the RAM in the meantime, hence it is always consistent.
+                Also the place and the size of the endpoint are read again at every retry.
+                If the writer keeps the RAM busy for too long, or if it died inside eo_nvsetshm_WriteBegin() /
+                eo_nvsetshm_WriteEnd() or recreated the segment, the function gives up after a bounded number of
+                retries: it spins for some of them and then yields the cpu.
+                The offset of a variable can be computed as the difference between eoprot_variable_ramof_get() and
+                eoprot_endpoint_ramof_get(), or with offsetof() on the type of the entity.
+    @param      p           The object.
+    @param      ep8         The endpoint.
+    @param      offset      The offset inside the RAM of the endpoint.
+    @param      data        Where to copy.
+    @param      size        The number of bytes.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_generic if the endpoint or the range are not valid, or
+                eores_NOK_timeout if no consistent copy was obtained. In such a case the segment should be opened
+                again with eo_nvsetshm_NewReader().
+ **/
+extern eOresult_t eo_nvsetshm_Read(EOnvsetSHM *p, eOnvEP8_t ep8, uint16_t offset, void *data, uint16_t size);
+
+
+
+/** @}
+    end of group eo_nvsetshm
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
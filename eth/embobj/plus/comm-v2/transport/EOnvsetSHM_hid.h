@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETSHM_HID_H_
+#define _EONVSETSHM_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       EOnvsetSHM_hid.h
+    @brief      This header file implements hidden interface to the EOnvsetSHM object.
+    @date       10/19/2026
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOnvSet.h"
+
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "EOnvsetSHM.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    uint32_t                offset;         // from the start of the segment. 0 means not used
+    uint16_t                size;
+    uint8_t                 dummy[2];
+} eOnvsetshm_ep_t;
+
+
+// it is at the start of the segment. the ram of the endpoints follows it.
+typedef struct
+{
+    uint32_t                magic;
+    uint16_t                version;
+    eOnvBRD_t               boardnum;
+    uint8_t                 dummy;
+    volatile uint32_t       sequence;       // it is odd while the writer changes the ram
+    uint32_t                capacity;       // bytes after the header
+    uint32_t                used;           // bytes after the header given to the endpoints
+    uint32_t                writerpid;      // the process of the writer, so that another writer does not take a live segment
+    eOnvsetshm_ep_t         endpoints[eonvset_max_endpoint_value+1];
+} eOnvsetshm_header_t;   EO_VERIFYsizeof(eOnvsetshm_header_t, 88)
+
+
+/** @struct     EOnvsetSHM_hid
+    @brief      Hidden definition. Implements private data used only internally by the
+                public or private (static) functions of the object and protected data
+                used also by its derived objects.
+ **/
+
+struct EOnvsetSHM_hid
+{
+    eOnvsetshm_header_t*    header;
+    uint32_t                mappedsize;
+    eObool_t                writer;
+    char                    name[64];
+    eOnvset_RAMprovider_t   ramprovider;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
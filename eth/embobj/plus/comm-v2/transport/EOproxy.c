@@ -57,6 +57,14 @@
     #define EONV_DONT_USE_EOV_MUTEX_FUNCTIONS
 #endif
 
+// define it to keep the rop descriptors in a list made by eo_list_New() rather than by eo_list_NewIndexed(). on the
+// boards the indexed list is used only if EOPROXY_USE_INDEXEDLIST is defined, so that their ram stays as it was
+#undef EOPROXY_DONT_USE_INDEXEDLIST
+
+#if (defined(EO_TAILOR_CODE_FOR_ARM) || defined(EO_TAILOR_CODE_FOR_DSPIC)) && !defined(EOPROXY_USE_INDEXEDLIST)
+    #define EOPROXY_DONT_USE_INDEXEDLIST
+#endif
+
 
 #if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
     #define eov_mutex_Take(a, b)   
@@ -148,7 +156,11 @@ extern EOproxy* eo_proxy_New(const eOproxy_cfg_t *cfg)
     
     retptr->transceiver = (EOtransceiver*) cfg->transceiver;
     
+#if defined(EOPROXY_DONT_USE_INDEXEDLIST)
     retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_New(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+#else
+    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_NewIndexed(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+#endif
     
     if(NULL != cfg->mutex_fn_new)
     {
@@ -51,7 +51,11 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+// the room in the arena for the objects, the ropframes, the mutexes and the headers of the blocks 
+#define EOK_TRANSCEIVER_arena_objects               2048
+// the room in the arena for every regular rop in the list of the transmitter
+#define EOK_TRANSCEIVER_arena_perregularrop         64
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -69,7 +73,8 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section    
+
+static uint32_t s_eo_transceiver_arena_capacity(const eOtransceiver_cfg_t *cfg);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -100,8 +105,8 @@ const eOtransceiver_cfg_t eo_transceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)          NULL,
         EO_INIT(.onerrorinvalidframe)       NULL
-    }
-    
+    },
+    EO_INIT(.memory)                        eo_trans_memory_scattered
 };
 
 
@@ -120,6 +125,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     eOreceiver_cfg_t rec_cfg;
     eOtransmitter_cfg_t tra_cfg;
     eOagent_cfg_t agentcfg = {0};
+    eOmempool_arena_t *arena = NULL;
 
 
     if(NULL == cfg)
@@ -128,12 +134,26 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     }
     
     
+    // if required, everything from now on gets memory from the arena, so that what is used together stays close
+    
+    if(eo_trans_memory_arena == cfg->memory)
+    {
+        arena = eo_mempool_Arena_New(eo_mempool_GetHandle(), s_eo_transceiver_arena_capacity(cfg));
+        if((NULL != arena) && (eores_OK != eo_mempool_Arena_Enter(eo_mempool_GetHandle(), arena)))
+        {   // the thread is already inside another arena: i keep on using that
+            eo_mempool_Arena_Delete(eo_mempool_GetHandle(), arena);
+            arena = NULL;
+        }
+    }
+    
+    
     // i get the memory for the object
     retptr = (EOtransceiver*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOtransceiver), 1);
     
     // save the config
     
     memcpy(&retptr->cfg, cfg, sizeof(eOtransceiver_cfg_t)); 
+    retptr->arena = arena;
     
     
     // create the conf manager  
@@ -207,6 +227,12 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     retptr->transmitter = eo_transmitter_New(&tra_cfg);
     
     
+    if(NULL != arena)
+    {
+        eo_mempool_Arena_Exit(eo_mempool_GetHandle());
+    }
+    
+    
     // manage the debug info
     
 #if defined(USE_DEBUG_EOTRANSCEIVER)    
@@ -220,6 +246,8 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
 
 extern void eo_transceiver_Delete(EOtransceiver* p)
 {
+    eOmempool_arena_t *arena = NULL;
+    
     if(NULL == p)
     {
         return;
@@ -247,9 +275,14 @@ extern void eo_transceiver_Delete(EOtransceiver* p)
         eo_confman_Delete(p->confmanager);
     }    
     
+    // the sub-objects have released their own resources (e.g., the mutexes) but not the memory inside the arena
+    arena = p->arena;
+    
     memset(p, 0, sizeof(EOtransceiver));
     
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
+    
+    eo_mempool_Arena_Delete(eo_mempool_GetHandle(), arena);
     return;
 }
 
@@ -512,6 +545,44 @@ extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescri
     return(res);
 }
 
+extern eOresult_t eo_transceiver_RegularROPs_LoadArray(EOtransceiver *p, eOropdescriptor_t *ropdescs, uint16_t number)
+{
+    eOresult_t res;
+    
+    if((NULL == p) || (NULL == ropdescs))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    res = eo_transmitter_regular_rops_LoadArray(p->transmitter, ropdescs, number);
+
+
+#if defined(USE_DEBUG_EOTRANSCEIVER)     
+    {   // DEBUG    
+        if(eores_OK != res)
+        {
+            p->debug.cannotloadropinregulars ++;
+        }
+    } 
+#endif    
+    
+    return(res);
+}
+
+extern eOresult_t eo_transceiver_RegularROPs_UnloadArray(EOtransceiver *p, eOropdescriptor_t *ropdescs, uint16_t number)
+{
+    eOresult_t res;
+    
+    if((NULL == p) || (NULL == ropdescs))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    res = eo_transmitter_regular_rops_UnloadArray(p->transmitter, ropdescs, number);
+    
+    return(res);
+}
+
 extern eOresult_t eo_transceiver_lasterror_tx_Get(EOtransceiver *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2)
 {
     //eOresult_t res;
@@ -599,7 +670,31 @@ extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t i
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+static uint32_t s_eo_transceiver_arena_capacity(const eOtransceiver_cfg_t *cfg)
+{
+    uint32_t capacity = EOK_TRANSCEIVER_arena_objects;
+    
+    // the transmitter: the packet, three buffers for the regulars, the occasionals, the replies, a rop and the list of regulars
+    capacity += cfg->sizes.capacityoftxpacket;
+    capacity += 3*cfg->sizes.capacityofropframeregulars;
+    capacity += cfg->sizes.capacityofropframeoccasionals;
+    capacity += cfg->sizes.capacityofropframereplies;
+    capacity += cfg->sizes.capacityofrop;
+    capacity += EOK_TRANSCEIVER_arena_perregularrop * cfg->sizes.maxnumberofregularrops;
+    
+    // the receiver: the buffer for the replies and two rops
+    capacity += cfg->sizes.capacityofropframereplies;
+    capacity += 2*cfg->sizes.capacityofrop;
+    
+    // the confirmation manager
+    if(NULL != cfg->confmancfg)
+    {
+        capacity += sizeof(eOropdescriptor_t) * cfg->confmancfg->maxnumberofconfreqrops;
+    }
+    
+    return(capacity);
+}
 
 
 
@@ -74,6 +74,13 @@ typedef enum
 } eOtransceiver_protection_t;
 
 
+typedef enum
+{
+    eo_trans_memory_scattered                   = 0,    // every sub-object gets its own memory from the EOtheMemoryPool
+    eo_trans_memory_arena                       = 1     // all the sub-objects and their buffers stay in a single block aligned to a cache line
+} eOtransceiver_memory_t;
+
+
 typedef struct   
 {
     uint16_t        capacityoftxpacket; 
@@ -102,6 +109,7 @@ typedef struct
     eov_mutex_fn_mutexderived_new   mutex_fn_new;
     eOtransceiver_protection_t      protection;
     eOtransceiver_extfn_t           extfn;
+    eOtransceiver_memory_t          memory;     // eo_trans_memory_arena is used only if the EOtheMemoryPool can release memory
 } eOtransceiver_cfg_t;
 
 
@@ -167,6 +175,10 @@ extern eOresult_t eo_transceiver_RegularROPs_Clear(EOtransceiver *p);
 extern eOresult_t eo_transceiver_RegularROP_Load(EOtransceiver *p, eOropdescriptor_t *ropdes); 
 extern eOresult_t eo_transceiver_RegularROP_Entity_Unload(EOtransceiver *p, eOnvEP8_t ep8, eOnvENT_t ent);
 extern eOresult_t eo_transceiver_RegularROP_Unload(EOtransceiver *p, eOropdescriptor_t *ropdes); 
+// they load / unload the @e number rop descriptors in @e ropdescs with a single lock. all the descriptors are validated at first:
+// if any of them cannot be loaded / unloaded nothing is done and the function returns an error.
+extern eOresult_t eo_transceiver_RegularROPs_LoadArray(EOtransceiver *p, eOropdescriptor_t *ropdescs, uint16_t number);
+extern eOresult_t eo_transceiver_RegularROPs_UnloadArray(EOtransceiver *p, eOropdescriptor_t *ropdescs, uint16_t number);
 
 
 extern eOresult_t eo_transceiver_LoadReplyInProxy(EOtransceiver *p, eOnvID32_t id32, void* data);
@@ -39,6 +39,7 @@ extern "C" {
 #include "EOreceiver.h"
 #include "EOtransmitter.h"
 #include "EOVmutex.h"
+#include "EOtheMemoryPool.h"
 
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
@@ -75,6 +76,7 @@ struct EOtransceiver_hid
     EOagent*                    agent;
     EOreceiver*                 receiver;
     EOtransmitter*              transmitter;   
+    eOmempool_arena_t*          arena;
 #if defined(USE_DEBUG_EOTRANSCEIVER)    
     EOtransceiverDEBUG_t        debug;
 #endif    
@@ -58,6 +58,18 @@
 //    #define EONV_DONT_USE_EOV_MUTEX_FUNCTIONS
 #endif
 
+// define it to keep the regular rops in a list made by eo_list_New() rather than by eo_list_NewIndexed(). on the
+// boards the indexed list is used only if EOTRANSMITTER_USE_INDEXEDLIST is defined, so that their ram stays as it was
+#undef EOTRANSMITTER_DONT_USE_INDEXEDLIST
+
+#if (defined(EO_TAILOR_CODE_FOR_ARM) || defined(EO_TAILOR_CODE_FOR_DSPIC)) && !defined(EOTRANSMITTER_USE_INDEXEDLIST)
+    #define EOTRANSMITTER_DONT_USE_INDEXEDLIST
+#endif
+
+// eo_transmitter_regular_rops_Unload() compacts the list of regulars when the rops it has unloaded since the last
+// compaction are at least 1/EOTRANSMITTER_COMPACT_fraction of the rops still inside
+#define EOTRANSMITTER_COMPACT_fraction      4
+
 
 #if defined(EONV_DONT_USE_EOV_MUTEX_FUNCTIONS)
     #define eov_mutex_Take(a, b)   
@@ -95,6 +107,14 @@ static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param);
 
 static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx);
 
+static eOresult_t s_eo_transmitter_regular_rops_check(EOtransmitter *p, eOropdescriptor_t* ropdesc, eo_transm_regropframe_t *type, uint16_t *ropbytes);
+
+static eOresult_t s_eo_transmitter_regular_rops_add(EOtransmitter *p, eOropdescriptor_t* ropdesc);
+
+static void s_eo_transmitter_regular_rops_remove(EOtransmitter *p, EOlistIter *li);
+
+static void s_eo_transmitter_regular_rops_compact(EOtransmitter *p);
+
 static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype);
 
 static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, uint16_t *ropsinside);
@@ -197,7 +217,13 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     // TAG(*1234*) : end
     retptr->bufferropframeoccasionals = (0 == cfg->sizes.capacityofropframeoccasionals) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframeoccasionals, 1));
     retptr->bufferropframereplies   = (0 == cfg->sizes.capacityofropframereplies) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframereplies, 1));
+#if defined(EOTRANSMITTER_DONT_USE_INDEXEDLIST)
     retptr->listofregropinfo        = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : (eo_list_New(sizeof(eo_transm_regrop_info_t), cfg->sizes.maxnumberofregularrops, NULL, 0, NULL, NULL));
+#else
+    retptr->listofregropinfo        = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : (eo_list_NewIndexed(sizeof(eo_transm_regrop_info_t), cfg->sizes.maxnumberofregularrops, NULL, 0, NULL, NULL));
+#endif
+    retptr->regropsnew              = (0 == cfg->sizes.maxnumberofregularrops) ? (NULL) : ((uint16_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), cfg->sizes.maxnumberofregularrops));
+    retptr->regropserased           = 0;
     retptr->currenttime             = 0;
     retptr->tx_seqnum               = 0;
 
@@ -307,6 +333,11 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
     {
         eo_list_Delete(p->listofregropinfo);
     }     
+    if(NULL != p->regropsnew)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regropsnew);
+        p->regropsnew = NULL;
+    }
     if(NULL != p->bufferropframeregulars_standard)
     {
         eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_standard);
@@ -490,6 +521,10 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_Get(EOtransmitter *p, ui
                 if(count > start)
                 {
                     eo_array_PushBack(array, &id32); 
+                    if(eobool_true == eo_array_Full(array))
+                    {   // no need to walk the rest of the list
+                        break;
+                    }
                 }
             }         
         }  
@@ -562,6 +597,10 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p,
                 if(count > start)
                 {
                     eo_array_PushBack(array, &id32); 
+                    if(eobool_true == eo_array_Full(array))
+                    {   // no need to walk the rest of the list
+                        break;
+                    }
                 }
             }         
         }            
@@ -575,17 +614,7 @@ extern eOresult_t eo_transmitter_regular_rops_arrayid32_ep_Get(EOtransmitter *p,
 
 extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc)
 {
-    eo_transm_regrop_info_t regropinfo;
-    eOropdescriptor_t ropdescriptor;
     eOresult_t res;
-    uint16_t usedbytes;
-    uint16_t remainingbytes;
-    uint16_t ropstarthere;
-    uint16_t ropsize;
-    EOnv nv;
-    EOnv* tmpnvptr = NULL;
-    eo_transm_regropframe_t regropframe2use_type = eo_transm_regropframe_standard;
-    EOropframe* regropframe2use = NULL;
 
     if((NULL == p) || (NULL == ropdesc)) 
     {
@@ -607,142 +636,143 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
         return(eores_NOK_generic);
     }
     
-
-    // for searching inside listofregropinfo we need only those three fields: ropcode, id, ep
-    ropdescriptor.ropcode   = ropdesc->ropcode;
-    ropdescriptor.id32      = ropdesc->id32;
-
-    
     // search for ropcode+ep+id. if found, then ... return a non NULL iterator and dont do anything because it means that the rop is already inside
-    if(NULL != eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescriptor))
+    if(NULL != eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, ropdesc))
     {   // it is already inside ...
         eov_mutex_Release(p->mtx_regulars);
         return(eores_OK);
     }    
     
-    // else ... prepare a temporary variable eo_transm_regrop_info_t to be put inside the list.
-    // and wait success of rop + insetrtion in frame
+    // lock tmprop
+    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
     
-    memcpy(&ropdescriptor, ropdesc, sizeof(eOropdescriptor_t));
-    ropdescriptor.control.rqstconf  = 0;                // VERY IMPORTANT: the regulars cannot ask for confirmation.
-    ropdescriptor.control.confinfo  = eo_ropconf_none;  // VERY IMPORTANT: the regulars cannot be a ack/nack
-    ropdescriptor.control.version   = EOK_ROP_VERSION_0;
+    res = s_eo_transmitter_regular_rops_add(p, ropdesc);
     
-      
-    res = eo_nvset_NV_Get(  (p->nvset),  
-                            ropdescriptor.id32,
-                            &nv
-                            );   
+    eov_mutex_Release(p->mtx_roptmp);
+    eov_mutex_Release(p->mtx_regulars);  
+    
+    return(res);   
+}
 
-    // if the nvset does not have the triple (ip, ep, id) then we return an error because we cannot form the rop
-    if(eores_OK != res)
+
+extern eOresult_t eo_transmitter_regular_rops_LoadArray(EOtransmitter *p, eOropdescriptor_t* ropdescs, uint16_t number)
+{
+    eOresult_t res = eores_OK;
+    eo_transm_regropframe_t type = eo_transm_regropframe_standard;
+    uint16_t ropbytes = 0;
+    uint16_t numberofnew = 0;
+    uint16_t numberoffree = 0;
+    uint32_t std = 0;
+    uint32_t cy0 = 0;
+    uint32_t cy1 = 0;
+    uint16_t i = 0;
+    uint16_t j = 0;
+    
+    if((NULL == p) || (NULL == ropdescs)) 
     {
-        eov_mutex_Release(p->mtx_regulars);
-        return(eores_NOK_generic);
-    } 
+        return(eores_NOK_nullpointer);
+    }  
 
-    // force size to be coherent with the nv. the size is always used, even if there is no data to transmit
-    ropdescriptor.size = eo_nv_Size(&nv);    
+    if(NULL == p->listofregropinfo)
+    {    // in such a case there is room for regular rops (for instance because the cfg->maxnumberofregularrops is zero)
+        return(eores_NOK_generic);
+    }
     
-    // now we have the nv. we set its value in local ram
-    if(eobool_true == eo_rop_ropcode_has_data(ropdescriptor.ropcode))
-    { 
-        eOnvOwnership_t nvownership = eo_rop_get_ownership(ropdescriptor.ropcode, eo_ropconf_none, eo_rop_dir_outgoing);        
-        if(eo_nv_ownership_local == nvownership)
-        {   // if the nv is local, then take data from nv, thus no need to write the data field of the nv using ropdescriptor.data.
-            ropdescriptor.data = NULL;   // set ropdescriptor.data to NULL to force eo_agent_OutROPfromNV() to get data from EOnv
+    if(0 == number)
+    {
+        return(eores_OK);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    // 1. validation of every ropdes: we keep the indices of the new ones in p->regropsnew and compute the bytes they need
+    //    in each regular ropframe. we start from the bytes already used, so that at the end we can verify capacity all at once. 
+    numberoffree = eo_list_Capacity(p->listofregropinfo) - eo_list_Size(p->listofregropinfo);
+    std = p->totalsizeofregulars_standard;
+    cy0 = p->totalsizeofregulars_cycle0of;
+    cy1 = p->totalsizeofregulars_cycle1of;
+    
+    for(i=0; i<number; i++)
+    {
+        // a rop which is already inside the regulars or which is repeated inside the array is not counted
+        if(NULL != eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescs[i]))
+        {
+            continue;
+        }        
+        for(j=0; j<i; j++)
+        {
+            if(ropdescs[j].id32 == ropdescs[i].id32)
+            {
+                break;
+            }
+        }        
+        if(j < i)
+        {
+            continue;
         }
-        else
-        {   // if the nv is remote, then the data must be passed inside ropdescriptor.data
-            
-            // so far we dont support that the device regularly sends commands such as set<remotevar, value>. it can send ask<remotevar> however.
-            // marco.accame on Nov 17 2014: it can regularly sends a ask<remotevar>, even if this mechanisms is not used ... and maybe will never be used ...
-            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_transmitter_regular_rops_Load(): cant load a regular ROP of remote variable w/ payload", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
-            
+        
+        if(numberofnew == numberoffree)
+        {   // we would exceed cfg->maxnumberofregularrops
             eov_mutex_Release(p->mtx_regulars);
             return(eores_NOK_generic);
-            
-            // however, if we allow a sending of rop<remotevar, value> ... we must have a descriptor.data not NULL
-            //if(NULL == ropdescriptor.data)
-            //{
-            //    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_transmitter_regular_rops_Load(): cant have NULL ropdes->data if nv is remote", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
-            //}          
         }
+        
+        if(eores_OK != s_eo_transmitter_regular_rops_check(p, &ropdescs[i], &type, &ropbytes))
+        {
+            eov_mutex_Release(p->mtx_regulars);
+            return(eores_NOK_generic);
+        }
+        
+        switch(type)
+        {
+            case eo_transm_regropframe_standard:    { std += ropbytes; } break;
+            case eo_transm_regropframe_cycle0of:    { cy0 += ropbytes; } break;
+            case eo_transm_regropframe_cycle1of:    { cy1 += ropbytes; } break;
+        }
+        
+        p->regropsnew[numberofnew] = i;
+        numberofnew ++;
     }
-    else
-    {   // dont need to send data
-        ropdescriptor.data = NULL;
-    }
-
-    // lock tmprop
-    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
     
-    res = eo_agent_OutROPprepare(p->agent, &nv, &ropdescriptor, p->roptmp, &usedbytes);   
-    
-    // if we cannot prepare the rop ... we quit
-    if(eores_OK != res)
+    // 2. the capacity of the regular ropframes is verified only once. the one of the list was verified in 1.
+    if((std + EO_MAX(cy0, cy1)) > p->effectivecapacityofregulars)
     {
-        eov_mutex_Release(p->mtx_roptmp);
         eov_mutex_Release(p->mtx_regulars);
-        return(res);
+        return(eores_NOK_generic);
     }
     
-
-    // extract the reference to the associated netvar
-    tmpnvptr = eo_rop_GetNV(p->roptmp);
-    
-
-    // choose the relevant regular ropframe. that depends on the id32 of the ropdescriptor 
-    regropframe2use = s_eo_transmitter_id32_to_typeofregulars(p, ropdescriptor.id32, &regropframe2use_type);
+    // 3. we add the new rops in one pass. we dont expect any failure in here because we have already verified everything.
+    //    but if it happens, we remove the rops added so far, so that the array is loaded either all or nothing.
+    eov_mutex_Take(p->mtx_roptmp, eok_reltimeINFINITE);
     
-    // see if we have space for this rop. as we transmit always a standard with one between cycled0of / cycled1of, we need verify
-    // with knowledge of regropframe2use_type and of usedbytes. 
-    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, usedbytes))
-    {   // cannot load the rop because we dont have usedbytes anymore
-        eov_mutex_Release(p->mtx_roptmp);
-        eov_mutex_Release(p->mtx_regulars);
-        return(eores_NOK_generic);        
+    for(i=0; i<numberofnew; i++)
+    {
+        res = s_eo_transmitter_regular_rops_add(p, &ropdescs[p->regropsnew[i]]);
+        if(eores_OK != res)
+        {
+            break;
+        }
     }
-           
-    // put the rop inside the relevant regular ropframe         
-    res = eo_ropframe_ROP_Add(regropframe2use, p->roptmp, &ropstarthere, &ropsize, &remainingbytes);
-    // if we cannot add the rop, then we quit ....
+    
     if(eores_OK != res)
     {
-        eov_mutex_Release(p->mtx_roptmp);
-        eov_mutex_Release(p->mtx_regulars);
-        return(res);
+        while(i > 0)
+        {
+            i--;
+            s_eo_transmitter_regular_rops_remove(p, eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescs[p->regropsnew[i]]));
+        }
+        s_eo_transmitter_regular_rops_compact(p);
     }
     
-    // i am sure that ropsize is equal to usedbytes, thus i dont verify with an assert ...
-    
-    // 3. prepare a regropinfo variable to be put inside the list    
-    regropinfo.ropcode                  = ropdescriptor.ropcode;    
-    regropinfo.hasdata2update           = eo_rop_datafield_is_present(&(p->roptmp->stream.head)); 
-    regropinfo.regropframetype          = regropframe2use_type;
-    regropinfo.ropframe                 = regropframe2use;
-    regropinfo.ropstarthere             = ropstarthere;
-    regropinfo.ropsize                  = ropsize;
-    regropinfo.timeoffsetinsiderop      = (0 == p->roptmp->stream.head.ctrl.plustime) ? (EOK_uint16dummy) : (ropsize - 8); //if we have time, then it is in teh last 8 bytes
-    memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
-
-
-    // push back regropinfo inside the list.
-    eo_list_PushBack(p->listofregropinfo, &regropinfo);
-    
-    // increment size of the relevant regular ropframe
-    s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
-    
     eov_mutex_Release(p->mtx_roptmp);
     eov_mutex_Release(p->mtx_regulars);  
     
-    return(eores_OK);   
+    return(res);   
 }
 
 
 extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdescriptor_t* ropdesc)//eOropcode_t ropcode, eOnvEP_t nvep, eOnvID_t nvid)
 {
-    eo_transm_regrop_info_t regropinfo;
     eOropdescriptor_t ropdescriptor;
     EOlistIter *li = NULL;
 
@@ -780,25 +810,64 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
         return(eores_NOK_generic);
     }
     
-    // copy what is inside the list into a temporary variable
-    memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
+    // remove the element indexed by li from the list and its rop from the regular ropframe
+    s_eo_transmitter_regular_rops_remove(p, li);
+
+    // the refresh walks the list at every cycle: we keep its nodes in order, but a single removal leaves only one hole,
+    // thus we compact only after some of them
+    p->regropserased++;
+    if((EOTRANSMITTER_COMPACT_fraction * p->regropserased) >= eo_list_Size(p->listofregropinfo))
+    {
+        s_eo_transmitter_regular_rops_compact(p);
+    }
+
+    eov_mutex_Release(p->mtx_regulars);
     
-    // for each element after li: (name is afterli) retrieve it and modify its content so that ropstarthere is decremented by regropinfo.ropsize ...
-    // but only if ... the element is inside the same regropframe. that is done in function s_eo_transmitter_list_shiftdownropinfo()
-    eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
+    return(eores_OK);   
+}
+
+
+extern eOresult_t eo_transmitter_regular_rops_UnloadArray(EOtransmitter *p, eOropdescriptor_t* ropdescs, uint16_t number)
+{
+    EOlistIter *li = NULL;
+    uint16_t i = 0;
+
+    if((NULL == p) || (NULL == ropdescs)) 
+    {
+        return(eores_NOK_nullpointer);
+    }  
+
+    if(NULL == p->listofregropinfo)
+    {
+        // in such a case there is room for regular rops (for instance because the cfg->maxnumberofregularrops is zero)
+        return(eores_NOK_generic);
+    }
     
-    // remove the element indexedby li
-    eo_list_Erase(p->listofregropinfo, li);
+    if(0 == number)
+    {
+        return(eores_OK);
+    }    
+
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
     
-    // inside the p->ropframeregulars: remove a rop of regropinfo.ropsize which starts at regropinfo.ropstartshere. use a _friend method in here defined.
-    //                                 you must: decrement the nrops by 1, decrement the size by regropinfo.ropsize, ... else in header and private variable ...
-    //                                           and finally make a memmove down by regropinfo.ropsize.
+    // 1. validation: every rop must be inside. as for eo_transmitter_regular_rops_Unload() it is an error if it is not.
+    for(i=0; i<number; i++)
+    {
+        if(NULL == eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescs[i]))
+        {
+            eov_mutex_Release(p->mtx_regulars);
+            return(eores_NOK_generic);
+        }
+    }
     
+    // 2. removal in one pass. a rop repeated inside the array is found only the first time.
+    for(i=0; i<number; i++)
+    {
+        li = eo_list_Find(p->listofregropinfo, s_eo_transmitter_ropmatchingrule_rule, &ropdescs[i]);
+        s_eo_transmitter_regular_rops_remove(p, li);
+    }
 
-    eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
-    
-    // decrement the size of relevant ropframe
-    s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement
+    s_eo_transmitter_regular_rops_compact(p);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -870,6 +939,8 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
         s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement    
     }
 
+    s_eo_transmitter_regular_rops_compact(p);
+
     eov_mutex_Release(p->mtx_regulars);
     
     return(eores_OK);   
@@ -897,6 +968,7 @@ extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p)
     } 
     
     eo_list_Clear(p->listofregropinfo);
+    p->regropserased = 0;
     
     eo_ropframe_Clear(p->ropframeregulars_standard);
     eo_ropframe_Clear(p->ropframeregulars_cycle0of);
@@ -1512,6 +1584,197 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     return(res);   
 }
 
+// it verifies that the ropdes can become a regular rop and it returns the regular ropframe which would host it and the bytes it needs.
+// it does not verify if the rop is already inside nor if there is space for it.
+static eOresult_t s_eo_transmitter_regular_rops_check(EOtransmitter *p, eOropdescriptor_t* ropdesc, eo_transm_regropframe_t *type, uint16_t *ropbytes)
+{
+    eOropctrl_t ropctrl = ropdesc->control;
+    EOnv nv;
+    
+    if(eobool_false == eo_rop_ropcode_is_valid(ropdesc->ropcode))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // if the nvset does not have the triple (ip, ep, id) then we cannot form the rop    
+    if(eores_OK != eo_nvset_NV_Get(p->nvset, ropdesc->id32, &nv))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // so far we dont support that the device regularly sends commands such as set<remotevar, value>. see s_eo_transmitter_regular_rops_add()
+    if((eobool_true == eo_rop_ropcode_has_data(ropdesc->ropcode)) && (eo_nv_ownership_local != eo_rop_get_ownership(ropdesc->ropcode, eo_ropconf_none, eo_rop_dir_outgoing)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    // same rules used by s_eo_transmitter_regular_rops_add() and by eo_agent_OutROPprepare() 
+    ropctrl.rqstconf = 0;
+    ropctrl.confinfo = eo_ropconf_none;
+    ropctrl.version  = EOK_ROP_VERSION_0;
+    
+    *ropbytes = eo_rop_compute_size(ropctrl, ropdesc->ropcode, eo_nv_Size(&nv));
+    s_eo_transmitter_id32_to_typeofregulars(p, ropdesc->id32, type);
+    
+    return(eores_OK);
+}
+
+// it adds a rop inside the regulars. the caller must have verified that the rop is not already inside and that the list of regulars
+// is not full. it must also hold mtx_regulars and mtx_roptmp.
+static eOresult_t s_eo_transmitter_regular_rops_add(EOtransmitter *p, eOropdescriptor_t* ropdesc)
+{
+    eo_transm_regrop_info_t regropinfo;
+    eOropdescriptor_t ropdescriptor;
+    eOresult_t res;
+    uint16_t usedbytes;
+    uint16_t remainingbytes;
+    uint16_t ropstarthere;
+    uint16_t ropsize;
+    EOnv nv;
+    EOnv* tmpnvptr = NULL;
+    eo_transm_regropframe_t regropframe2use_type = eo_transm_regropframe_standard;
+    EOropframe* regropframe2use = NULL;
+    
+    // prepare a temporary variable eo_transm_regrop_info_t to be put inside the list.
+    // and wait success of rop + insetrtion in frame
+    
+    memcpy(&ropdescriptor, ropdesc, sizeof(eOropdescriptor_t));
+    ropdescriptor.control.rqstconf  = 0;                // VERY IMPORTANT: the regulars cannot ask for confirmation.
+    ropdescriptor.control.confinfo  = eo_ropconf_none;  // VERY IMPORTANT: the regulars cannot be a ack/nack
+    ropdescriptor.control.version   = EOK_ROP_VERSION_0;
+    
+      
+    res = eo_nvset_NV_Get(  (p->nvset),  
+                            ropdescriptor.id32,
+                            &nv
+                            );   
+
+    // if the nvset does not have the triple (ip, ep, id) then we return an error because we cannot form the rop
+    if(eores_OK != res)
+    {
+        return(eores_NOK_generic);
+    } 
+
+    // force size to be coherent with the nv. the size is always used, even if there is no data to transmit
+    ropdescriptor.size = eo_nv_Size(&nv);    
+    
+    // now we have the nv. we set its value in local ram
+    if(eobool_true == eo_rop_ropcode_has_data(ropdescriptor.ropcode))
+    { 
+        eOnvOwnership_t nvownership = eo_rop_get_ownership(ropdescriptor.ropcode, eo_ropconf_none, eo_rop_dir_outgoing);        
+        if(eo_nv_ownership_local == nvownership)
+        {   // if the nv is local, then take data from nv, thus no need to write the data field of the nv using ropdescriptor.data.
+            ropdescriptor.data = NULL;   // set ropdescriptor.data to NULL to force eo_agent_OutROPfromNV() to get data from EOnv
+        }
+        else
+        {   // if the nv is remote, then the data must be passed inside ropdescriptor.data
+            
+            // so far we dont support that the device regularly sends commands such as set<remotevar, value>. it can send ask<remotevar> however.
+            // marco.accame on Nov 17 2014: it can regularly sends a ask<remotevar>, even if this mechanisms is not used ... and maybe will never be used ...
+            eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, "eo_transmitter_regular_rops_Load(): cant load a regular ROP of remote variable w/ payload", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            
+            return(eores_NOK_generic);
+            
+            // however, if we allow a sending of rop<remotevar, value> ... we must have a descriptor.data not NULL
+            //if(NULL == ropdescriptor.data)
+            //{
+            //    eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_transmitter_regular_rops_Load(): cant have NULL ropdes->data if nv is remote", s_eobj_ownname, &eo_errman_DescrRuntimeErrorLocal);
+            //}          
+        }
+    }
+    else
+    {   // dont need to send data
+        ropdescriptor.data = NULL;
+    }
+    
+    res = eo_agent_OutROPprepare(p->agent, &nv, &ropdescriptor, p->roptmp, &usedbytes);   
+    
+    // if we cannot prepare the rop ... we quit
+    if(eores_OK != res)
+    {
+        return(res);
+    }
+    
+
+    // extract the reference to the associated netvar
+    tmpnvptr = eo_rop_GetNV(p->roptmp);
+    
+
+    // choose the relevant regular ropframe. that depends on the id32 of the ropdescriptor 
+    regropframe2use = s_eo_transmitter_id32_to_typeofregulars(p, ropdescriptor.id32, &regropframe2use_type);
+    
+    // see if we have space for this rop. as we transmit always a standard with one between cycled0of / cycled1of, we need verify
+    // with knowledge of regropframe2use_type and of usedbytes. 
+    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, usedbytes))
+    {   // cannot load the rop because we dont have usedbytes anymore
+        return(eores_NOK_generic);        
+    }
+           
+    // put the rop inside the relevant regular ropframe         
+    res = eo_ropframe_ROP_Add(regropframe2use, p->roptmp, &ropstarthere, &ropsize, &remainingbytes);
+    // if we cannot add the rop, then we quit ....
+    if(eores_OK != res)
+    {
+        return(res);
+    }
+    
+    // i am sure that ropsize is equal to usedbytes, thus i dont verify with an assert ...
+    
+    // 3. prepare a regropinfo variable to be put inside the list    
+    regropinfo.ropcode                  = ropdescriptor.ropcode;    
+    regropinfo.hasdata2update           = eo_rop_datafield_is_present(&(p->roptmp->stream.head)); 
+    regropinfo.regropframetype          = regropframe2use_type;
+    regropinfo.ropframe                 = regropframe2use;
+    regropinfo.ropstarthere             = ropstarthere;
+    regropinfo.ropsize                  = ropsize;
+    regropinfo.timeoffsetinsiderop      = (0 == p->roptmp->stream.head.ctrl.plustime) ? (EOK_uint16dummy) : (ropsize - 8); //if we have time, then it is in teh last 8 bytes
+    memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
+
+
+    // push back regropinfo inside the list.
+    eo_list_PushBack(p->listofregropinfo, &regropinfo);
+    
+    // increment size of the relevant regular ropframe
+    s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
+    
+    return(eores_OK);
+}
+
+
+// it removes the rop at li from the list and from its regular ropframe. it does nothing if li is NULL
+static void s_eo_transmitter_regular_rops_remove(EOtransmitter *p, EOlistIter *li)
+{
+    eo_transm_regrop_info_t regropinfo;
+    
+    if(NULL == li)
+    {
+        return;
+    }
+    
+    // copy what is inside the list into a temporary variable
+    memcpy(&regropinfo, eo_list_At(p->listofregropinfo, li), sizeof(eo_transm_regrop_info_t));
+    
+    // the elements after li which are in the same regropframe must have their ropstarthere decremented by regropinfo.ropsize.
+    // that is done in function s_eo_transmitter_list_shiftdownropinfo()
+    eo_list_ExecuteFromIter(p->listofregropinfo, s_eo_transmitter_list_shiftdownropinfo, &regropinfo, eo_list_Next(p->listofregropinfo, li));
+    
+    eo_list_Erase(p->listofregropinfo, li);
+    
+    // inside the regular ropframe: decrement the nrops by 1, decrement the size by regropinfo.ropsize and memmove down
+    eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
+    
+    // decrement the size of the relevant ropframe
+    s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize);
+}
+
+
+static void s_eo_transmitter_regular_rops_compact(EOtransmitter *p)
+{
+    eo_list_Compact(p->listofregropinfo);
+    p->regropserased = 0;
+}
+
+
 static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype)
 {
     EOropframe* ret = NULL;
@@ -109,6 +109,8 @@ struct EOtransmitter_hid
     uint8_t*                    bufferropframeoccasionals;
     uint8_t*                    bufferropframereplies;
     EOlist*                     listofregropinfo; 
+    uint16_t*                   regropsnew;     // used by eo_transmitter_regular_rops_LoadArray(): the indices of the new rops
+    uint16_t                    regropserased;  // the single unloads since listofregropinfo was compacted
     eOabstime_t                 currenttime;   
     EOVmutexDerived*            mtx_replies;
     EOVmutexDerived*            mtx_regulars;
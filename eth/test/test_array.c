@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+#include "EOarray.h"
+#include "EoProtocol.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define TEST_ARRAY_capacity         10
+
+#define TEST_ARRAY_widecapacity     1000
+
+// the board whose endpoints are aggregated. it has the management, the motion control and the skin.
+#define TEST_ARRAY_board            0
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_array_check(eObool_t ok, const char *what);
+static eObool_t s_test_array_cleared(EOarray *a);
+static void s_test_array_bulk(void);
+static void s_test_array_wide(void);
+static void s_test_array_endpoints(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_test_array_failures = 0;
+
+static const uint8_t s_test_array_entities[8] = { 1, 2, 0, 1, 1, 1, 1, 1 };
+
+static const eOprotEndpoint_t s_test_array_eps[] = { eoprot_endpoint_management, eoprot_endpoint_motioncontrol, eoprot_endpoint_skin };
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it verifies eo_array_PushBackN(), eo_array_AssignRange(), the EOarrayWide and the aggregation of the endpoints of a
+// board by eoprot_endpoints_array_get() and eoprot_endpoints_arrayofdescriptors_get(), which use eo_array_AssignRange().
+int main(void)
+{
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    s_test_array_bulk();
+    s_test_array_wide();
+    s_test_array_endpoints();
+
+    if(0 != s_test_array_failures)
+    {
+        printf("test_array: FAILED %u checks\n", s_test_array_failures);
+        return(1);
+    }
+
+    printf("test_array: OK\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_array_check(eObool_t ok, const char *what)
+{
+    if(eobool_false == ok)
+    {
+        printf("test_array: FAILED %s\n", what);
+        s_test_array_failures++;
+    }
+}
+
+
+// the items beyond the size must be zero, as after eo_array_Reset()
+static eObool_t s_test_array_cleared(EOarray *a)
+{
+    uint16_t i = 0;
+
+    for(i=(uint16_t)eo_array_Size(a)*eo_array_ItemSize(a); i<(uint16_t)eo_array_Capacity(a)*eo_array_ItemSize(a); i++)
+    {
+        if(0 != a->data[i])
+        {
+            return(eobool_false);
+        }
+    }
+
+    return(eobool_true);
+}
+
+
+static void s_test_array_bulk(void)
+{
+    uint32_t memory[1+TEST_ARRAY_capacity];
+    uint32_t values[TEST_ARRAY_capacity+2];
+    EOarray *a = NULL;
+    uint8_t i = 0;
+    eObool_t ok = eobool_true;
+
+    for(i=0; i<TEST_ARRAY_capacity+2; i++)
+    {
+        values[i] = 100 + i;
+    }
+
+    a = eo_array_New(TEST_ARRAY_capacity, sizeof(uint32_t), memory);
+
+    // all the items or none
+    s_test_array_check((eores_OK == eo_array_PushBackN(a, values, 4)) ? eobool_true : eobool_false, "PushBackN");
+    s_test_array_check((4 == eo_array_Size(a)) ? eobool_true : eobool_false, "size after PushBackN");
+    s_test_array_check((eores_NOK_generic == eo_array_PushBackN(a, values, 7)) ? eobool_true : eobool_false, "PushBackN beyond capacity");
+    s_test_array_check((4 == eo_array_Size(a)) ? eobool_true : eobool_false, "size after a refused PushBackN");
+    s_test_array_check((eores_OK == eo_array_PushBackN(a, &values[4], 6)) ? eobool_true : eobool_false, "PushBackN up to capacity");
+    for(i=0; i<TEST_ARRAY_capacity; i++)
+    {
+        ok = ((100u + i) == *((uint32_t*)eo_array_At(a, i))) ? ok : eobool_false;
+    }
+    s_test_array_check(ok, "items after PushBackN");
+    s_test_array_check((eores_NOK_nullpointer == eo_array_PushBackN(NULL, values, 1)) ? eobool_true : eobool_false, "PushBackN of NULL");
+
+    // the content is replaced and the old items beyond the new size are cleared
+    s_test_array_check((eores_NOK_generic == eo_array_AssignRange(a, values, TEST_ARRAY_capacity+1)) ? eobool_true : eobool_false, "AssignRange beyond capacity");
+    s_test_array_check((TEST_ARRAY_capacity == eo_array_Size(a)) ? eobool_true : eobool_false, "size after a refused AssignRange");
+    s_test_array_check((eores_OK == eo_array_AssignRange(a, &values[5], 3)) ? eobool_true : eobool_false, "AssignRange");
+    s_test_array_check(((3 == eo_array_Size(a)) && (105 == *((uint32_t*)eo_array_At(a, 0)))) ? eobool_true : eobool_false, "items after AssignRange");
+    s_test_array_check(s_test_array_cleared(a), "items cleared by AssignRange");
+    s_test_array_check(((eores_OK == eo_array_AssignRange(a, NULL, 0)) && (0 == eo_array_Size(a))) ? eobool_true : eobool_false, "AssignRange of no items");
+}
+
+
+static void s_test_array_wide(void)
+{
+    uint32_t memory[1+TEST_ARRAY_capacity];
+    uint32_t values[TEST_ARRAY_capacity];
+    EOarrayWide *w = NULL;
+    EOarray *a = NULL;
+    EOarray *b = NULL;
+    uint32_t x = 7;
+    uint16_t i = 0;
+
+    for(i=0; i<TEST_ARRAY_capacity; i++)
+    {
+        values[i] = 100 + i;
+    }
+
+    a = eo_array_New(TEST_ARRAY_capacity, sizeof(uint32_t), memory);
+    eo_array_AssignRange(a, values, TEST_ARRAY_capacity);
+
+    // more than the 255 items of an EOarray, aggregated from many EOarray
+    w = eo_arraywide_New(TEST_ARRAY_widecapacity, sizeof(uint32_t), NULL);
+    s_test_array_check(((TEST_ARRAY_widecapacity == eo_arraywide_Capacity(w)) && (8 == eo_arraywide_UsedBytes(w))) ? eobool_true : eobool_false, "new wide array");
+    for(i=0; i<TEST_ARRAY_widecapacity/TEST_ARRAY_capacity; i++)
+    {
+        eo_arraywide_Append(w, a);
+    }
+    s_test_array_check((eobool_true == eo_arraywide_Full(w)) ? eobool_true : eobool_false, "wide array full");
+    s_test_array_check((eores_NOK_generic == eo_arraywide_Append(w, a)) ? eobool_true : eobool_false, "Append beyond capacity");
+    s_test_array_check((109 == *((uint32_t*)eo_arraywide_At(w, TEST_ARRAY_widecapacity-1))) ? eobool_true : eobool_false, "last item of the wide array");
+    s_test_array_check((NULL == eo_arraywide_At(w, TEST_ARRAY_widecapacity)) ? eobool_true : eobool_false, "item beyond the wide array");
+    s_test_array_check(((8 + 4*TEST_ARRAY_widecapacity) == eo_arraywide_UsedBytes(w)) ? eobool_true : eobool_false, "used bytes of the wide array");
+
+    eo_arraywide_Resize(w, 300);
+    eo_arraywide_Assign(w, 299, values, 3);
+    s_test_array_check(((302 == eo_arraywide_Size(w)) && (102 == *((uint32_t*)eo_arraywide_At(w, 301)))) ? eobool_true : eobool_false, "Assign of the wide array");
+    s_test_array_check(((eores_OK == eo_arraywide_PopBack(w)) && (301 == eo_arraywide_Size(w))) ? eobool_true : eobool_false, "PopBack of the wide array");
+    s_test_array_check(((eores_OK == eo_arraywide_PushBack(w, &x)) && ((TEST_ARRAY_widecapacity-302) == eo_arraywide_Available(w))) ? eobool_true : eobool_false, "PushBack of the wide array");
+    s_test_array_check(((eores_OK == eo_arraywide_AssignRange(w, values, 2)) && (2 == eo_arraywide_Size(w))) ? eobool_true : eobool_false, "AssignRange of the wide array");
+    eo_arraywide_Reset(w);
+    s_test_array_check((0 == eo_arraywide_Size(w)) ? eobool_true : eobool_false, "Reset of the wide array");
+
+    // the item sizes must match
+    b = eo_array_New(3, 2, NULL);
+    s_test_array_check((eores_NOK_generic == eo_arraywide_Append(w, b)) ? eobool_true : eobool_false, "Append of different items");
+
+    eo_array_Delete(b);
+    eo_arraywide_Delete(w);
+}
+
+
+// the arrays are filled until their capacity with the endpoints after startfrom, whatever they contained before
+static void s_test_array_endpoints(void)
+{
+    uint8_t memory[4+4*4];
+    uint8_t garbage[4*4];
+    eoprot_endpoint_descriptor_t *des = NULL;
+    EOarray *a = NULL;
+    uint8_t numberof = sizeof(s_test_array_eps)/sizeof(s_test_array_eps[0]);
+    uint8_t capacity = 0;
+    uint8_t startfrom = 0;
+    uint8_t expected = 0;
+    uint8_t i = 0;
+    eObool_t ok = eobool_true;
+
+    memset(garbage, 0xaa, sizeof(garbage));
+
+    eoprot_config_board_reserve(TEST_ARRAY_board);
+    for(i=0; i<numberof; i++)
+    {
+        eoprot_config_endpoint_entities(TEST_ARRAY_board, s_test_array_eps[i], s_test_array_entities);
+    }
+
+    for(capacity=1; capacity<=4; capacity++)
+    {
+        for(startfrom=0; startfrom<=numberof; startfrom++)
+        {
+            expected = ((numberof - startfrom) < capacity) ? (numberof - startfrom) : (capacity);
+
+            a = eo_array_New(capacity, sizeof(eOprotEndpoint_t), memory);
+            eo_array_PushBackN(a, garbage, capacity);
+            ok = (eores_OK == eoprot_endpoints_array_get(TEST_ARRAY_board, a, startfrom)) ? eobool_true : eobool_false;
+            ok = (expected == eo_array_Size(a)) ? ok : eobool_false;
+            for(i=0; i<eo_array_Size(a); i++)
+            {
+                ok = (s_test_array_eps[startfrom+i] == *((eOprotEndpoint_t*)eo_array_At(a, i))) ? ok : eobool_false;
+            }
+            ok = (eobool_true == s_test_array_cleared(a)) ? ok : eobool_false;
+            s_test_array_check(ok, "eoprot_endpoints_array_get()");
+
+            a = eo_array_New(capacity, sizeof(eoprot_endpoint_descriptor_t), memory);
+            eo_array_PushBackN(a, garbage, capacity);
+            ok = (eores_OK == eoprot_endpoints_arrayofdescriptors_get(TEST_ARRAY_board, a, startfrom)) ? eobool_true : eobool_false;
+            ok = (expected == eo_array_Size(a)) ? ok : eobool_false;
+            for(i=0; i<eo_array_Size(a); i++)
+            {
+                des = (eoprot_endpoint_descriptor_t*)eo_array_At(a, i);
+                ok = (s_test_array_eps[startfrom+i] == des->endpoint) ? ok : eobool_false;
+                ok = (eoprot_entities_in_endpoint_numberof_get(TEST_ARRAY_board, des->endpoint) == des->entitiesinside) ? ok : eobool_false;
+                ok = (eoprot_version_of_endpoint_get(des->endpoint)->major == des->version.major) ? ok : eobool_false;
+            }
+            ok = (eobool_true == s_test_array_cleared(a)) ? ok : eobool_false;
+            s_test_array_check(ok, "eoprot_endpoints_arrayofdescriptors_get()");
+        }
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+#include "EoManagement.h"
+#include "EoAnalogSensors.h"
+#include "EOcontainers.h"
+
+#include "test_containers.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the containers of the protocol which the c++ templates must be able to replace
+using test_containers_id32_t = embot::core::Array<uint32_t, eOmn_serv_capacity_arrayof_id32>;
+using test_containers_upto12bytes_t = embot::core::Array<uint8_t, 12>;
+
+static_assert(sizeof(test_containers_id32_t) == sizeof(eOmn_serv_arrayof_id32_t), "Array<uint32_t, 41> is not an eOmn_serv_arrayof_id32_t");
+static_assert(sizeof(test_containers_upto12bytes_t) == sizeof(eOas_arrayofupto12bytes_t), "Array<uint8_t, 12> is not an eOas_arrayofupto12bytes_t");
+static_assert(std::is_standard_layout<test_containers_id32_t>::value, "Array<uint32_t, 41> has not a standard layout");
+static_assert(std::is_trivially_copyable<test_containers_id32_t>::value, "Array<uint32_t, 41> cannot be copied as an EOarray");
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_containers_check(bool ok, const char *what);
+static void s_test_containers_layout(void);
+static void s_test_containers_vector(void);
+static void s_test_containers_array(void);
+static void s_test_containers_ring(void);
+static void s_test_containers_fifo(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_test_containers_failures = 0;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it verifies that the structs of the containers have the same layout in c and in c++ and that the objects of
+// EOcontainers.h can be used in turn by their inline functions and by the C functions compiled by the c compiler.
+int main(void)
+{
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    s_test_containers_layout();
+    s_test_containers_vector();
+    s_test_containers_array();
+    s_test_containers_ring();
+    s_test_containers_fifo();
+
+    if(0 != s_test_containers_failures)
+    {
+        std::printf("test_containers: FAILED %u checks\n", s_test_containers_failures);
+        return(1);
+    }
+
+    std::printf("test_containers: OK\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_containers_check(bool ok, const char *what)
+{
+    if(!ok)
+    {
+        std::printf("test_containers: FAILED %s\n", what);
+        s_test_containers_failures++;
+    }
+}
+
+
+static void s_test_containers_layout(void)
+{
+    static const uint32_t layout[test_containers_layout_numberof] =
+    {
+        sizeof(EOvector),
+        offsetof(EOvector, size),
+        offsetof(EOvector, stored_items),
+        sizeof(EOdeque),
+        offsetof(EOdeque, first),
+        offsetof(EOdeque, stored_items),
+        offsetof(EOdeque, mask),
+        sizeof(EOfifo),
+        offsetof(EOfifo, dek),
+        sizeof(eOarray_head_t),
+        offsetof(EOarray_of, data),
+        sizeof(eOmn_serv_arrayof_id32_t),
+        offsetof(eOmn_serv_arrayof_id32_t, data),
+        sizeof(eOas_arrayofupto12bytes_t)
+    };
+    char what[64];
+    test_containers_id32_t a;
+    uint8_t i = 0;
+
+    for(i=0; i<test_containers_layout_numberof; i++)
+    {
+        std::snprintf(what, sizeof(what), "layout #%u: c %u, c++ %u", i, test_containers_c_layout(static_cast<test_containers_layout_t>(i)), layout[i]);
+        s_test_containers_check(layout[i] == test_containers_c_layout(static_cast<test_containers_layout_t>(i)), what);
+    }
+
+    // the items of an Array are where the EOarray keeps its data
+    s_test_containers_check(test_containers_c_layout(test_containers_id32_data) ==
+                            static_cast<uint32_t>(reinterpret_cast<uint8_t*>(a.data()) - reinterpret_cast<uint8_t*>(&a)), "data of the Array");
+    a.push_back(1);
+    s_test_containers_check(static_cast<void*>(a.data()) == eo_array_At(a.array(), 0), "first item of the Array");
+}
+
+
+static void s_test_containers_vector(void)
+{
+    embot::core::Vector<uint32_t, 10> v;
+    uint32_t sum = 0;
+    uint32_t i = 0;
+
+    for(i=0; i<3; i++)
+    {
+        v.push_back(i);
+    }
+    s_test_containers_check(4 == test_containers_c_vector_fill(v.vector(), 3, 4), "c fill of the Vector");
+    s_test_containers_check(7 == v.size(), "size of the Vector after the c fill");
+    v.push_back(7);
+    s_test_containers_check(2 == test_containers_c_vector_fill(v.vector(), 8, 5), "c fill of the Vector up to capacity");
+    s_test_containers_check(v.full() && (eobool_true == eo_vector_Full(v.vector())), "full Vector");
+
+    for(auto x : v)
+    {
+        sum += x;
+    }
+    s_test_containers_check((45 == sum) && (45 == test_containers_c_vector_sum(v.vector())), "sum of the Vector");
+
+    eo_vector_PopBack(v.vector());
+    v.pop_back();
+    s_test_containers_check((8 == v.size()) && (7 == v.back()) && (28 == test_containers_c_vector_sum(v.vector())), "pop of the Vector");
+}
+
+
+static void s_test_containers_array(void)
+{
+    test_containers_id32_t a;
+    test_containers_id32_t b;
+    eOmn_serv_arrayof_id32_t id32;
+    uint32_t i = 0;
+
+    for(i=0; i<10; i++)
+    {
+        a.push_back(i);
+    }
+    s_test_containers_check(31 == test_containers_c_array_fill(a.array(), 10, 100), "c fill of the Array up to capacity");
+    s_test_containers_check(a.full() && (eOmn_serv_capacity_arrayof_id32 == eo_array_Size(a.array())), "full Array");
+    s_test_containers_check(eo_array_UsedBytes(a.array()) == a.usedbytes(), "used bytes of the Array");
+
+    // the Array goes where the protocol has its struct, and back
+    std::memcpy(&id32, &a, sizeof(id32));
+    s_test_containers_check(820 == test_containers_c_id32_sum(&id32), "sum of the Array as a protocol struct");
+    s_test_containers_check(820 == test_containers_c_id32_sum(&a), "sum of the Array");
+
+    b = a;
+    b.resize(5);
+    s_test_containers_check((5 == eo_array_Size(b.array())) && (10 == test_containers_c_id32_sum(&b)), "copy of the Array");
+
+    std::memcpy(&b, &id32, sizeof(b));
+    s_test_containers_check((eOmn_serv_capacity_arrayof_id32 == b.size()) && (40 == b[40]), "Array from a protocol struct");
+}
+
+
+// the Ring wraps: the c part pushes at the back and the c++ part at the front
+static void s_test_containers_ring(void)
+{
+    embot::core::Ring<uint32_t, 8> r;
+    uint32_t sum = 0;
+    uint32_t k = 0;
+    eOsizecntnr_t i = 0;
+    bool ok = true;
+
+    for(k=0; k<100; k++)
+    {
+        if(r.full())
+        {
+            r.pop_back();
+            eo_deque_PopFront(r.deque());
+        }
+        test_containers_c_deque_fill(r.deque(), k, 1);
+        r.push_front(1000 + k);
+
+        ok = (r.size() == eo_deque_Size(r.deque())) ? ok : false;
+        sum = 0;
+        i = 0;
+        for(auto &x : r)
+        {
+            ok = (&x == eo_deque_At(r.deque(), i)) ? ok : false;
+            sum += x;
+            i++;
+        }
+        ok = (sum == test_containers_c_deque_sum(r.deque())) ? ok : false;
+        ok = ((&r.front() == eo_deque_Front(r.deque())) && (&r.back() == eo_deque_Back(r.deque()))) ? ok : false;
+    }
+
+    s_test_containers_check(ok, "Ring used by c and c++");
+}
+
+
+static void s_test_containers_fifo(void)
+{
+    embot::core::Fifo<uint32_t, 4> f;
+    eOsizecntnr_t size = 0;
+    uint32_t item = 0;
+
+    f.put(1);
+    s_test_containers_check(3 == test_containers_c_fifo_fill(f.fifo(), 2, 5), "c fill of the Fifo up to capacity");
+    eo_fifo_Size(f.fifo(), &size, eok_reltimeZERO);
+    s_test_containers_check((4 == size) && f.full(), "full Fifo");
+    s_test_containers_check(f.getrem(item) && (1 == item), "oldest item of the Fifo");
+    s_test_containers_check((nullptr != f.get()) && (2 == *f.get()), "next item of the Fifo");
+    s_test_containers_check((9 == test_containers_c_fifo_sum(f.fifo())) && f.empty(), "c sum of the Fifo");
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _TEST_CONTAINERS_H_
+#define _TEST_CONTAINERS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// it is the interface between the c++ and the c part of the test of EOcontainers.h: the c part tells the layout of
+// the structs as seen by the c compiler and it uses the c++ objects only through the C functions of embobj.
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOarray.h"
+#include "EOvector.h"
+#include "EOdeque.h"
+#include "EOfifo.h"
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef enum
+{
+    test_containers_vector_sizeof           = 0,
+    test_containers_vector_size             = 1,
+    test_containers_vector_stored_items     = 2,
+    test_containers_deque_sizeof            = 3,
+    test_containers_deque_first             = 4,
+    test_containers_deque_stored_items      = 5,
+    test_containers_deque_mask              = 6,
+    test_containers_fifo_sizeof             = 7,
+    test_containers_fifo_dek                = 8,
+    test_containers_arrayhead_sizeof        = 9,
+    test_containers_arrayof_data            = 10,
+    test_containers_id32_sizeof             = 11,
+    test_containers_id32_data               = 12,
+    test_containers_upto12bytes_sizeof      = 13
+} test_containers_layout_t;
+
+enum { test_containers_layout_numberof = 14 };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+// it gives the size or the offset of a field, as seen by the c compiler
+extern uint32_t test_containers_c_layout(test_containers_layout_t what);
+
+// they push the values first, first+1, ..., first+n-1 with the C functions. they return the number of pushed items.
+extern uint32_t test_containers_c_vector_fill(EOvector *v, uint32_t first, uint32_t n);
+extern uint32_t test_containers_c_array_fill(EOarray *a, uint32_t first, uint32_t n);
+extern uint32_t test_containers_c_deque_fill(EOdeque *d, uint32_t first, uint32_t n);
+extern uint32_t test_containers_c_fifo_fill(EOfifo *f, uint32_t first, uint32_t n);
+
+// they return the sum of the items read with the C functions, from the front to the back
+extern uint32_t test_containers_c_vector_sum(EOvector *v);
+extern uint32_t test_containers_c_deque_sum(EOdeque *d);
+extern uint32_t test_containers_c_fifo_sum(EOfifo *f);
+
+// it reads the items of the protocol struct directly, as a board does with the EOarray it receives
+extern uint32_t test_containers_c_id32_sum(const void *arrayofid32);
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
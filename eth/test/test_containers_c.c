@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stddef.h"
+
+#include "EoCommon.h"
+#include "EoManagement.h"
+#include "EoAnalogSensors.h"
+
+// the layout of the structs is the one of the hidden headers
+#include "EOvector_hid.h"
+#include "EOdeque_hid.h"
+#include "EOfifo_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "test_containers.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint32_t s_test_containers_c_layout[test_containers_layout_numberof] =
+{
+    sizeof(EOvector),
+    offsetof(EOvector, size),
+    offsetof(EOvector, stored_items),
+    sizeof(EOdeque),
+    offsetof(EOdeque, first),
+    offsetof(EOdeque, stored_items),
+    offsetof(EOdeque, mask),
+    sizeof(EOfifo),
+    offsetof(EOfifo, dek),
+    sizeof(eOarray_head_t),
+    offsetof(EOarray_of, data),
+    sizeof(eOmn_serv_arrayof_id32_t),
+    offsetof(eOmn_serv_arrayof_id32_t, data),
+    sizeof(eOas_arrayofupto12bytes_t)
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern uint32_t test_containers_c_layout(test_containers_layout_t what)
+{
+    return(s_test_containers_c_layout[what]);
+}
+
+
+extern uint32_t test_containers_c_vector_fill(EOvector *v, uint32_t first, uint32_t n)
+{
+    uint32_t i = 0;
+
+    for(i=0; (i<n) && (eobool_false == eo_vector_Full(v)); i++)
+    {
+        uint32_t item = first + i;
+        eo_vector_PushBack(v, &item);
+    }
+
+    return(i);
+}
+
+
+extern uint32_t test_containers_c_array_fill(EOarray *a, uint32_t first, uint32_t n)
+{
+    uint32_t i = 0;
+
+    for(i=0; i<n; i++)
+    {
+        uint32_t item = first + i;
+        if(eores_OK != eo_array_PushBack(a, &item))
+        {
+            break;
+        }
+    }
+
+    return(i);
+}
+
+
+extern uint32_t test_containers_c_deque_fill(EOdeque *d, uint32_t first, uint32_t n)
+{
+    uint32_t i = 0;
+
+    for(i=0; (i<n) && (eobool_false == eo_deque_Full(d)); i++)
+    {
+        uint32_t item = first + i;
+        eo_deque_PushBack(d, &item);
+    }
+
+    return(i);
+}
+
+
+extern uint32_t test_containers_c_fifo_fill(EOfifo *f, uint32_t first, uint32_t n)
+{
+    uint32_t i = 0;
+
+    for(i=0; i<n; i++)
+    {
+        uint32_t item = first + i;
+        if(eores_OK != eo_fifo_Put(f, &item, eok_reltimeZERO))
+        {
+            break;
+        }
+    }
+
+    return(i);
+}
+
+
+extern uint32_t test_containers_c_vector_sum(EOvector *v)
+{
+    uint32_t sum = 0;
+    eOsizecntnr_t i = 0;
+
+    for(i=0; i<eo_vector_Size(v); i++)
+    {
+        sum += *((uint32_t*)eo_vector_At(v, i));
+    }
+
+    return(sum);
+}
+
+
+extern uint32_t test_containers_c_deque_sum(EOdeque *d)
+{
+    uint32_t sum = 0;
+    eOsizecntnr_t i = 0;
+
+    for(i=0; i<eo_deque_Size(d); i++)
+    {
+        sum += *((uint32_t*)eo_deque_At(d, i));
+    }
+
+    return(sum);
+}
+
+
+// it empties the fifo
+extern uint32_t test_containers_c_fifo_sum(EOfifo *f)
+{
+    uint32_t sum = 0;
+    uint32_t item = 0;
+
+    while(eores_OK == eo_fifo_GetRem(f, &item, eok_reltimeZERO))
+    {
+        sum += item;
+    }
+
+    return(sum);
+}
+
+
+extern uint32_t test_containers_c_id32_sum(const void *arrayofid32)
+{
+    const eOmn_serv_arrayof_id32_t *a = (const eOmn_serv_arrayof_id32_t*)arrayofid32;
+    uint32_t sum = 0;
+    uint8_t i = 0;
+
+    for(i=0; i<a->head.size; i++)
+    {
+        sum += a->data[i];
+    }
+
+    return(sum);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
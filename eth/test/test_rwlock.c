@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+#include <pthread.h>
+#include <time.h>
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+#include "EOYmutex.h"
+#include "EOYrwlock.h"
+#include "EOhostTransceiver.h"
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+
+// the test checks which lock the NV has been given
+#include "EOnv_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define TEST_RWLOCK_readers         4
+
+// the readers and the writer run for so many milli-seconds
+#define TEST_RWLOCK_runtime         300
+
+#define TEST_RWLOCK_maxnvsize       512
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// a helper thread takes the lock in the given mode, tells it with taken and keeps it until release is set
+typedef struct
+{
+    EOYrwlock           *lock;
+    eObool_t            exclusive;
+    volatile uint32_t   taken;
+    volatile uint32_t   release;
+} test_rwlock_holder_t;
+
+// the readers and the writer of the concurrent run. inside counts the readers which hold the lock at the same time.
+typedef struct
+{
+    EOYrwlock           *lock;
+    EOnv                nv;
+    uint16_t            nvsize;
+    uint32_t            inside;
+    uint32_t            writing;
+    uint32_t            stop;
+    uint32_t            errors;
+} test_rwlock_run_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_rwlock_check(eObool_t ok, const char *what);
+static void s_test_rwlock_sleep(uint32_t us);
+static void s_test_rwlock_semantics(void);
+static void s_test_rwlock_concurrent(void);
+static void s_test_rwlock_nvs(void);
+static void* s_test_rwlock_holder(void *arg);
+static void* s_test_rwlock_reader(void *arg);
+static void* s_test_rwlock_writer(void *arg);
+static void* s_test_rwlock_nvreader(void *arg);
+static void* s_test_rwlock_nvwriter(void *arg);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_test_rwlock_failures = 0;
+
+static test_rwlock_run_t s_test_rwlock_run;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it verifies the shared and the exclusive modes of the EOYrwlock, first one step at a time and then with concurrent
+// readers and a writer, and at last through the NVs of an EOnvSet protected by eo_nvset_protection_rwlock_one_per_endpoint.
+int main(void)
+{
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    s_test_rwlock_semantics();
+    s_test_rwlock_concurrent();
+    s_test_rwlock_nvs();
+
+    if(0 != s_test_rwlock_failures)
+    {
+        printf("test_rwlock: FAILED %u checks\n", s_test_rwlock_failures);
+        return(1);
+    }
+
+    printf("test_rwlock: OK\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_rwlock_check(eObool_t ok, const char *what)
+{
+    if(eobool_false == ok)
+    {
+        printf("test_rwlock: FAILED %s\n", what);
+        s_test_rwlock_failures++;
+    }
+}
+
+
+static void s_test_rwlock_sleep(uint32_t us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = 1000 * (us % 1000000);
+    nanosleep(&ts, NULL);
+}
+
+
+static void s_test_rwlock_semantics(void)
+{
+    EOYrwlock *lock = eoy_rwlock_New();
+    test_rwlock_holder_t holder;
+    pthread_t thread;
+
+    // a reader in another thread lets this one read but not write
+    memset(&holder, 0, sizeof(holder));
+    holder.lock = lock;
+    holder.exclusive = eobool_false;
+    pthread_create(&thread, NULL, s_test_rwlock_holder, &holder);
+    while(0 == holder.taken)
+    {
+        s_test_rwlock_sleep(100);
+    }
+
+    s_test_rwlock_check((eores_OK == eoy_rwlock_TakeShared(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "shared with shared");
+    s_test_rwlock_check((eores_OK == eoy_rwlock_Release(lock)) ? eobool_true : eobool_false, "release of shared");
+    s_test_rwlock_check((eores_NOK_timeout == eoy_rwlock_TakeExclusive(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "exclusive with shared, no wait");
+    s_test_rwlock_check((eores_NOK_timeout == eoy_rwlock_TakeExclusive(lock, 10*eok_reltime1ms)) ? eobool_true : eobool_false, "exclusive with shared, timed");
+
+    holder.release = 1;
+    pthread_join(thread, NULL);
+
+    // a writer in another thread keeps out both readers and writers
+    memset(&holder, 0, sizeof(holder));
+    holder.lock = lock;
+    holder.exclusive = eobool_true;
+    pthread_create(&thread, NULL, s_test_rwlock_holder, &holder);
+    while(0 == holder.taken)
+    {
+        s_test_rwlock_sleep(100);
+    }
+
+    s_test_rwlock_check((eores_NOK_timeout == eoy_rwlock_TakeShared(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "shared with exclusive, no wait");
+    s_test_rwlock_check((eores_NOK_timeout == eoy_rwlock_TakeShared(lock, 10*eok_reltime1ms)) ? eobool_true : eobool_false, "shared with exclusive, timed");
+    s_test_rwlock_check((eores_NOK_timeout == eoy_rwlock_TakeExclusive(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "exclusive with exclusive");
+
+    holder.release = 1;
+    pthread_join(thread, NULL);
+
+    // the writer takes it again in any mode and keeps it until its last release
+    s_test_rwlock_check((eores_OK == eoy_rwlock_TakeExclusive(lock, eok_reltimeINFINITE)) ? eobool_true : eobool_false, "exclusive when free");
+    s_test_rwlock_check((eores_OK == eoy_rwlock_TakeShared(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "shared by the writer");
+    s_test_rwlock_check((eores_OK == eoy_rwlock_TakeExclusive(lock, eok_reltimeZERO)) ? eobool_true : eobool_false, "exclusive by the writer");
+    eoy_rwlock_Release(lock);
+    eoy_rwlock_Release(lock);
+
+    memset(&holder, 0, sizeof(holder));
+    holder.lock = lock;
+    holder.exclusive = eobool_false;
+    pthread_create(&thread, NULL, s_test_rwlock_holder, &holder);
+    s_test_rwlock_sleep(20000);
+    s_test_rwlock_check((0 == holder.taken) ? eobool_true : eobool_false, "reader before the last release of the writer");
+    eoy_rwlock_Release(lock);
+    holder.release = 1;
+    pthread_join(thread, NULL);
+    s_test_rwlock_check((1 == holder.taken) ? eobool_true : eobool_false, "reader after the last release of the writer");
+
+    eoy_rwlock_Delete(lock);
+}
+
+
+static void s_test_rwlock_concurrent(void)
+{
+    test_rwlock_run_t *r = &s_test_rwlock_run;
+    pthread_t readers[TEST_RWLOCK_readers];
+    pthread_t writer;
+    uint32_t i = 0;
+
+    memset(r, 0, sizeof(test_rwlock_run_t));
+    r->lock = eoy_rwlock_New();
+
+    pthread_create(&writer, NULL, s_test_rwlock_writer, r);
+    for(i=0; i<TEST_RWLOCK_readers; i++)
+    {
+        pthread_create(&readers[i], NULL, s_test_rwlock_reader, r);
+    }
+
+    s_test_rwlock_sleep(1000*TEST_RWLOCK_runtime);
+    EO_atomic_store_release(&r->stop, 1);
+
+    pthread_join(writer, NULL);
+    for(i=0; i<TEST_RWLOCK_readers; i++)
+    {
+        pthread_join(readers[i], NULL);
+    }
+
+    s_test_rwlock_check((0 == r->errors) ? eobool_true : eobool_false, "readers and writer inside together");
+
+    eoy_rwlock_Delete(r->lock);
+}
+
+
+static void s_test_rwlock_nvs(void)
+{
+    test_rwlock_run_t *r = &s_test_rwlock_run;
+    eOnvset_BRDcfg_t brdcfg = eonvset_BRDcfgMax;
+    eOhosttransceiver_cfg_t cfg = eo_hosttransceiver_cfg_default;
+    EOhostTransceiver *transceiver = NULL;
+    eOprotID32_t id32 = eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, eoprot_tag_mc_joint_status);
+    pthread_t readers[TEST_RWLOCK_readers];
+    pthread_t writer;
+    uint32_t i = 0;
+
+    brdcfg.boardnum = 1;
+    cfg.nvsetbrdcfg = &brdcfg;
+    cfg.mutex_fn_new = (eov_mutex_fn_mutexderived_new)eoy_mutex_New;
+    cfg.nvsetprotection = eo_nvset_protection_rwlock_one_per_endpoint;
+    cfg.nvsetrwlock_fn_new = (eov_rwlock_fn_rwlockderived_new)eoy_rwlock_New;
+    transceiver = eo_hosttransceiver_New(&cfg);
+
+    memset(r, 0, sizeof(test_rwlock_run_t));
+    s_test_rwlock_check((eores_OK == eo_nvset_NV_Get(eo_hosttransceiver_GetNVset(transceiver), id32, &r->nv)) ? eobool_true : eobool_false, "nv of the endpoint");
+    s_test_rwlock_check(((NULL != r->nv.rwl) && (NULL == r->nv.mtx)) ? eobool_true : eobool_false, "rwlock of the nv");
+    r->nvsize = eo_nv_Size(&r->nv);
+    s_test_rwlock_check((r->nvsize <= TEST_RWLOCK_maxnvsize) ? eobool_true : eobool_false, "size of the nv");
+
+    if(0 == s_test_rwlock_failures)
+    {
+        pthread_create(&writer, NULL, s_test_rwlock_nvwriter, r);
+        for(i=0; i<TEST_RWLOCK_readers; i++)
+        {
+            pthread_create(&readers[i], NULL, s_test_rwlock_nvreader, r);
+        }
+
+        s_test_rwlock_sleep(1000*TEST_RWLOCK_runtime);
+        EO_atomic_store_release(&r->stop, 1);
+
+        pthread_join(writer, NULL);
+        for(i=0; i<TEST_RWLOCK_readers; i++)
+        {
+            pthread_join(readers[i], NULL);
+        }
+
+        s_test_rwlock_check((0 == r->errors) ? eobool_true : eobool_false, "torn reads of the nv");
+    }
+
+    eo_hosttransceiver_Delete(transceiver);
+}
+
+
+static void* s_test_rwlock_holder(void *arg)
+{
+    test_rwlock_holder_t *h = (test_rwlock_holder_t*)arg;
+
+    if(eobool_true == h->exclusive)
+    {
+        eoy_rwlock_TakeExclusive(h->lock, eok_reltimeINFINITE);
+    }
+    else
+    {
+        eoy_rwlock_TakeShared(h->lock, eok_reltimeINFINITE);
+    }
+
+    h->taken = 1;
+    while(0 == h->release)
+    {
+        s_test_rwlock_sleep(100);
+    }
+
+    eoy_rwlock_Release(h->lock);
+
+    return(NULL);
+}
+
+
+static void* s_test_rwlock_reader(void *arg)
+{
+    test_rwlock_run_t *r = (test_rwlock_run_t*)arg;
+
+    while(0 == EO_atomic_load_acquire(&r->stop))
+    {
+        eoy_rwlock_TakeShared(r->lock, eok_reltimeINFINITE);
+        EO_atomic_fetch_add_relaxed(&r->inside, 1);
+        if(0 != EO_atomic_load_relaxed(&r->writing))
+        {
+            EO_atomic_fetch_add_relaxed(&r->errors, 1);
+        }
+        // so that the readers overlap
+        s_test_rwlock_sleep(50);
+        EO_atomic_fetch_sub_relaxed(&r->inside, 1);
+        eoy_rwlock_Release(r->lock);
+    }
+
+    return(NULL);
+}
+
+
+static void* s_test_rwlock_writer(void *arg)
+{
+    test_rwlock_run_t *r = (test_rwlock_run_t*)arg;
+
+    while(0 == EO_atomic_load_acquire(&r->stop))
+    {
+        eoy_rwlock_TakeExclusive(r->lock, eok_reltimeINFINITE);
+        EO_atomic_store_relaxed(&r->writing, 1);
+        if(0 != EO_atomic_load_relaxed(&r->inside))
+        {
+            EO_atomic_fetch_add_relaxed(&r->errors, 1);
+        }
+        s_test_rwlock_sleep(50);
+        EO_atomic_store_relaxed(&r->writing, 0);
+        eoy_rwlock_Release(r->lock);
+        s_test_rwlock_sleep(200);
+    }
+
+    return(NULL);
+}
+
+
+// eo_nv_Get() takes the lock in shared mode: every byte must come from the same eo_nv_Set()
+static void* s_test_rwlock_nvreader(void *arg)
+{
+    test_rwlock_run_t *r = (test_rwlock_run_t*)arg;
+    uint8_t data[TEST_RWLOCK_maxnvsize];
+    uint16_t size = 0;
+    uint16_t i = 0;
+
+    while(0 == EO_atomic_load_acquire(&r->stop))
+    {
+        eo_nv_Get(&r->nv, eo_nv_strg_volatile, data, &size);
+        for(i=1; i<size; i++)
+        {
+            if(data[i] != data[0])
+            {
+                EO_atomic_fetch_add_relaxed(&r->errors, 1);
+                break;
+            }
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void* s_test_rwlock_nvwriter(void *arg)
+{
+    test_rwlock_run_t *r = (test_rwlock_run_t*)arg;
+    uint8_t data[TEST_RWLOCK_maxnvsize];
+    uint8_t value = 0;
+
+    while(0 == EO_atomic_load_acquire(&r->stop))
+    {
+        memset(data, value++, r->nvsize);
+        eo_nv_Set(&r->nv, data, eobool_true, eo_nv_upd_dontdo);
+    }
+
+    return(NULL);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
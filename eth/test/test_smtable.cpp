@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+#include "EOsm.h"
+#include "EOsmTable.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define TEST_SMTABLE_events         100000
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+enum { stA = 0, stB = 1, stC = 2, stD = 3, stNUMBEROF = 4 };
+enum { ev0 = 0, ev1 = 1, ev2 = 2, ev3 = 3, evNUMBEROF = 4 };
+
+// the dynamic data of a machine. every callback folds its code into trace, so that two machines with the same trace
+// called the same callbacks in the same order.
+typedef struct
+{
+    uint32_t        trace;
+} test_smtable_data_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_smtable_check(bool ok, const char *what);
+static void s_test_smtable_fold(EOsm *p, uint32_t code);
+
+static void s_test_smtable_onentry(EOsm *p);
+static void s_test_smtable_onexit(EOsm *p);
+static void s_test_smtable_ontransition(EOsm *p);
+static void s_test_smtable_ontransition_self(EOsm *p);
+
+static void s_test_smtable_tables(void);
+static void s_test_smtable_process(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_test_smtable_failures = 0;
+
+static constexpr eOsmState_t s_test_smtable_states[stNUMBEROF] =
+{
+    { "A", s_test_smtable_onentry, s_test_smtable_onexit },
+    { "B", s_test_smtable_onentry, NULL },
+    { "C", NULL, s_test_smtable_onexit },
+    { "D", s_test_smtable_onentry, s_test_smtable_onexit }
+};
+
+static constexpr eOsmTransition_t s_test_smtable_transitions[] =
+{
+    { stA, stB, ev0, s_test_smtable_ontransition },
+    { stA, stC, ev1, NULL },
+    { stB, stC, ev0, NULL },
+    { stB, stA, ev2, s_test_smtable_ontransition },
+    { stC, stD, ev0, s_test_smtable_ontransition },
+    { stC, stC, ev3, s_test_smtable_ontransition_self },
+    { stD, stA, ev0, NULL },
+    { stD, stB, ev1, s_test_smtable_ontransition }
+};
+
+static constexpr auto s_test_smtable_table = embot::core::sm::compile<evNUMBEROF>(s_test_smtable_states, s_test_smtable_transitions, stA);
+static constexpr eOsm_quickinfo_t s_test_smtable_quickinfo = s_test_smtable_table.quickinfo();
+
+// the tables are checked by the compiler
+static_assert(0x3 == s_test_smtable_table.evtmasks[stA], "events of state A");
+static_assert(0x9 == s_test_smtable_table.evtmasks[stC], "events of state C");
+static_assert(5 == s_test_smtable_table.transindices[stC*evNUMBEROF + ev3], "self transition of state C");
+static_assert(7 == s_test_smtable_table.transindices[stD*evNUMBEROF + ev1], "transition from D to B");
+
+// the same machine, with the tables built in ram by eo_sm_New() or given by the compiled table
+static const eOsm_cfg_t s_test_smtable_cfg_ram =
+{
+    stNUMBEROF, 8, evNUMBEROF, stA, sizeof(test_smtable_data_t),
+    s_test_smtable_states, s_test_smtable_transitions, NULL, NULL, NULL
+};
+
+static const eOsm_cfg_t s_test_smtable_cfg_rom =
+{
+    stNUMBEROF, 8, evNUMBEROF, stA, sizeof(test_smtable_data_t),
+    s_test_smtable_states, s_test_smtable_transitions, NULL, NULL, &s_test_smtable_quickinfo
+};
+
+// every configuration error must stop the compilation: the build of these variants is expected to fail
+#if defined(TEST_SMTABLE_AMBIGUOUS_TRANSITION)
+static constexpr eOsmTransition_t s_test_smtable_ambiguous[] =
+{
+    { stA, stB, ev0, NULL }, { stA, stC, ev0, NULL }, { stB, stD, ev1, NULL }, { stC, stA, ev1, NULL }
+};
+static constexpr auto s_test_smtable_error = embot::core::sm::compile<evNUMBEROF>(s_test_smtable_states, s_test_smtable_ambiguous, stA);
+#elif defined(TEST_SMTABLE_UNREACHABLE_STATE)
+static constexpr eOsmTransition_t s_test_smtable_unreachable[] =
+{
+    { stA, stB, ev0, NULL }, { stB, stA, ev1, NULL }, { stC, stD, ev0, NULL }, { stD, stC, ev0, NULL }
+};
+static constexpr auto s_test_smtable_error = embot::core::sm::compile<evNUMBEROF>(s_test_smtable_states, s_test_smtable_unreachable, stA);
+#elif defined(TEST_SMTABLE_TRANSITION_OUT_OF_RANGE)
+static constexpr eOsmTransition_t s_test_smtable_outofrange[] =
+{
+    { stA, stB, ev0, NULL }, { stB, stC, evNUMBEROF, NULL }, { stC, stD, ev0, NULL }, { stD, stA, ev0, NULL }
+};
+static constexpr auto s_test_smtable_error = embot::core::sm::compile<evNUMBEROF>(s_test_smtable_states, s_test_smtable_outofrange, stA);
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it verifies that embot::core::sm::process() with a compiled table takes the same path of eo_sm_ProcessEvent() with
+// the tables built in ram and with the same compiled table given as quickinfo.
+int main(void)
+{
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    s_test_smtable_tables();
+    s_test_smtable_process();
+
+    if(0 != s_test_smtable_failures)
+    {
+        std::printf("test_smtable: FAILED %u checks\n", s_test_smtable_failures);
+        return(1);
+    }
+
+    std::printf("test_smtable: OK\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_smtable_check(bool ok, const char *what)
+{
+    if(!ok)
+    {
+        std::printf("test_smtable: FAILED %s\n", what);
+        s_test_smtable_failures++;
+    }
+}
+
+
+static void s_test_smtable_fold(EOsm *p, uint32_t code)
+{
+    test_smtable_data_t *data = static_cast<test_smtable_data_t*>(eo_sm_GetDynamicData(p));
+
+    data->trace = (data->trace * 31) + (16 * code) + eo_sm_GetActiveState(p) + (256 * eo_sm_GetLatestEvent(p));
+}
+
+
+static void s_test_smtable_onentry(EOsm *p)
+{
+    s_test_smtable_fold(p, 1);
+}
+
+
+static void s_test_smtable_onexit(EOsm *p)
+{
+    s_test_smtable_fold(p, 2);
+}
+
+
+static void s_test_smtable_ontransition(EOsm *p)
+{
+    s_test_smtable_fold(p, 3);
+}
+
+
+static void s_test_smtable_ontransition_self(EOsm *p)
+{
+    s_test_smtable_fold(p, 4);
+}
+
+
+// the quickinfo and the compiled tables are the ones eo_sm_New() would build
+static void s_test_smtable_tables(void)
+{
+    bool ok = true;
+    uint8_t s = 0;
+    uint8_t e = 0;
+    uint32_t mask = 0;
+
+    s_test_smtable_check((stNUMBEROF == s_test_smtable_quickinfo.nstates) && (evNUMBEROF == s_test_smtable_quickinfo.maxevts), "dimensions of the quickinfo");
+    s_test_smtable_check((s_test_smtable_transitions == s_test_smtable_quickinfo.transitions) &&
+                         (s_test_smtable_table.evtmasks == s_test_smtable_quickinfo.evtmasks) &&
+                         (s_test_smtable_table.transindices == s_test_smtable_quickinfo.transindices), "tables of the quickinfo");
+
+    for(s=0; s<stNUMBEROF; s++)
+    {
+        mask = 0;
+        for(const eOsmTransition_t &t : s_test_smtable_transitions)
+        {
+            if(s == t.curr)
+            {
+                mask |= (1u << t.evt);
+                e = t.evt;
+                ok = (&t == &s_test_smtable_transitions[s_test_smtable_table.transindices[s*evNUMBEROF + e]]) ? ok : false;
+            }
+        }
+        ok = (mask == s_test_smtable_table.evtmasks[s]) ? ok : false;
+    }
+
+    s_test_smtable_check(ok, "compiled tables");
+}
+
+
+static void s_test_smtable_process(void)
+{
+    EOsm *ram = eo_sm_New(&s_test_smtable_cfg_ram);
+    EOsm *rom = eo_sm_New(&s_test_smtable_cfg_rom);
+    EOsm *inl = eo_sm_New(&s_test_smtable_cfg_rom);
+    test_smtable_data_t *dram = static_cast<test_smtable_data_t*>(eo_sm_GetDynamicData(ram));
+    test_smtable_data_t *drom = static_cast<test_smtable_data_t*>(eo_sm_GetDynamicData(rom));
+    test_smtable_data_t *dinl = static_cast<test_smtable_data_t*>(eo_sm_GetDynamicData(inl));
+    uint32_t seed = 12345;
+    uint32_t nodata = 0;
+    uint32_t i = 0;
+    eOsmEvent_t ev = 0;
+    eOresult_t rram = eores_OK;
+    eOresult_t rrom = eores_OK;
+    eOresult_t rinl = eores_OK;
+    bool ok = true;
+
+    s_test_smtable_check(eores_NOK_nullpointer == embot::core::sm::process(nullptr, s_test_smtable_table, ev0), "process() of a NULL EOsm");
+    s_test_smtable_check(eores_NOK_generic == embot::core::sm::process(inl, s_test_smtable_table, evNUMBEROF), "process() of an event out of range");
+
+    // process() starts the machine on its first event as eo_sm_ProcessEvent() does
+    for(i=0; i<TEST_SMTABLE_events; i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        ev = static_cast<eOsmEvent_t>((seed >> 16) % evNUMBEROF);
+
+        rram = eo_sm_ProcessEvent(ram, ev);
+        rrom = eo_sm_ProcessEvent(rom, ev);
+        rinl = embot::core::sm::process(inl, s_test_smtable_table, ev);
+
+        nodata += (eores_NOK_nodata == rinl) ? 1 : 0;
+
+        ok = ((rram == rinl) && (rrom == rinl)) ? ok : false;
+        ok = ((eo_sm_GetActiveState(ram) == eo_sm_GetActiveState(inl)) && (eo_sm_GetActiveState(rom) == eo_sm_GetActiveState(inl))) ? ok : false;
+        ok = ((eo_sm_GetLatestEvent(ram) == eo_sm_GetLatestEvent(inl)) && (eo_sm_GetLatestEvent(rom) == eo_sm_GetLatestEvent(inl))) ? ok : false;
+        ok = ((dram->trace == dinl->trace) && (drom->trace == dinl->trace)) ? ok : false;
+    }
+
+    s_test_smtable_check(ok, "process() and eo_sm_ProcessEvent() on the same events");
+    s_test_smtable_check((0 != nodata) && (TEST_SMTABLE_events != nodata), "events with and without a transition");
+
+    // after a reset the machines start again from the initial state
+    eo_sm_Reset(ram);
+    eo_sm_Reset(inl);
+    rram = eo_sm_ProcessEvent(ram, ev1);
+    rinl = embot::core::sm::process(inl, s_test_smtable_table, ev1);
+    s_test_smtable_check((eores_OK == rinl) && (rram == rinl) && (stC == eo_sm_GetActiveState(inl)) && (dram->trace == dinl->trace), "process() after eo_sm_Reset()");
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
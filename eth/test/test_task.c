@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "string.h"
+#include <time.h>
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+#include "EOVtheSystem.h"
+#include "EOVtask.h"
+#include "EOYtask.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the max time in milli-seconds waited for a task to do what it was asked
+#define TEST_TASK_maxwait           5000
+
+#define TEST_TASK_messages          1000
+
+#define TEST_TASK_callbacks         200
+
+// the capacity of the queue of the message-driven task
+#define TEST_TASK_queuesize         4
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// what the run() of a task or its callbacks have seen. it is written only by the thread of the task
+typedef struct
+{
+    uint32_t            runs;
+    uint32_t            events;
+    uint32_t            timeouts;
+    uint32_t            next;           // the next message or callback expected, to verify the FIFO order
+    uint32_t            sum;
+    uint32_t            errors;         // out of order or not on the thread of the task
+    uint32_t            gate;           // the message-driven task waits inside run() until it is not 0
+} test_task_seen_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_task_check(eObool_t ok, const char *what);
+static void s_test_task_sleep(uint32_t us);
+static eObool_t s_test_task_wait(uint32_t *value, uint32_t expected);
+static void s_test_task_onthread(test_task_seen_t *seen, EOYtask *tsk);
+
+static void s_test_task_events(void);
+static void s_test_task_messages(void);
+static void s_test_task_callbacks(void);
+static void s_test_task_periodic(void);
+
+static void s_test_task_run_event(EOYtask *tsk, uint32_t evt);
+static void s_test_task_run_message(EOYtask *tsk, uint32_t msg);
+static void s_test_task_run_periodic(EOYtask *tsk, uint32_t evt);
+static void s_test_task_callback(void *arg);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_test_task_failures = 0;
+
+static test_task_seen_t s_test_task_seen;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it verifies that a EOYtask receives through the EOVtask interface the events, the messages and the callbacks of
+// its type, in order and on its own thread, and that it rejects the others.
+int main(void)
+{
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    s_test_task_check((NULL == eov_sys_GetRunningTask(eov_sys_GetHandle())) ? eobool_true : eobool_false, "running task of the main thread");
+
+    s_test_task_events();
+    s_test_task_messages();
+    s_test_task_callbacks();
+    s_test_task_periodic();
+
+    if(0 != s_test_task_failures)
+    {
+        printf("test_task: FAILED %u checks\n", s_test_task_failures);
+        return(1);
+    }
+
+    printf("test_task: OK\n");
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_task_check(eObool_t ok, const char *what)
+{
+    if(eobool_false == ok)
+    {
+        printf("test_task: FAILED %s\n", what);
+        s_test_task_failures++;
+    }
+}
+
+
+static void s_test_task_sleep(uint32_t us)
+{
+    struct timespec ts;
+
+    ts.tv_sec = us / 1000000;
+    ts.tv_nsec = 1000 * (us % 1000000);
+    nanosleep(&ts, NULL);
+}
+
+
+// it waits until the task has written at least expected in value
+static eObool_t s_test_task_wait(uint32_t *value, uint32_t expected)
+{
+    uint32_t ms = 0;
+
+    for(ms=0; ms<TEST_TASK_maxwait; ms++)
+    {
+        if(EO_atomic_load_acquire(value) >= expected)
+        {
+            return(eobool_true);
+        }
+        s_test_task_sleep(1000);
+    }
+
+    return((EO_atomic_load_acquire(value) >= expected) ? eobool_true : eobool_false);
+}
+
+
+// called by the thread of the task, it verifies that the task is the running one
+static void s_test_task_onthread(test_task_seen_t *seen, EOYtask *tsk)
+{
+    if((void*)tsk != eov_sys_GetRunningTask(eov_sys_GetHandle()))
+    {
+        EO_atomic_store_release(&seen->errors, seen->errors + 1);
+    }
+}
+
+
+static void s_test_task_events(void)
+{
+    eOytask_cfg_t cfg = { eoy_task_type_eventdriven, 0, -1, 0, 20000, 0, NULL, s_test_task_run_event, &s_test_task_seen, "test.evt" };
+    EOYtask *tsk = NULL;
+    eOytask_stats_t stats;
+
+    memset(&s_test_task_seen, 0, sizeof(s_test_task_seen));
+    tsk = eoy_task_New(&cfg);
+
+    s_test_task_check((eoy_task_GetExternalData(tsk) == &s_test_task_seen) ? eobool_true : eobool_false, "external data");
+    s_test_task_check((eov_task_GetID(tsk) >= 16) ? eobool_true : eobool_false, "id of a task above the reserved ones");
+    s_test_task_check((eores_NOK_unsupported == eov_task_tskSendMessage(tsk, 1, eok_reltimeZERO)) ? eobool_true : eobool_false, "message to an event-driven task");
+    s_test_task_check((eores_NOK_unsupported == eov_task_tskExecCallback(tsk, s_test_task_callback, NULL, eok_reltimeZERO)) ? eobool_true : eobool_false, "callback to an event-driven task");
+
+    // the events of the task and of the isr are both delivered. run() is called also by the timeout
+    eov_task_tskSetEvent(tsk, 0x1);
+    eov_task_isrSetEvent(tsk, 0x80000000);
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.sum, 2), "events delivered");
+    s_test_task_check((0x80000001 == EO_atomic_load_acquire(&s_test_task_seen.events)) ? eobool_true : eobool_false, "mask of the events");
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.timeouts, 1), "timeout of an event-driven task");
+    s_test_task_check((0 == EO_atomic_load_acquire(&s_test_task_seen.errors)) ? eobool_true : eobool_false, "run() of the event-driven task on its thread");
+
+    eoy_task_Stats_Get(tsk, &stats);
+    s_test_task_check((stats.timeouts >= 1) && (stats.activations > stats.timeouts) ? eobool_true : eobool_false, "statistics of the event-driven task");
+
+    eoy_task_Delete(tsk);
+}
+
+
+static void s_test_task_messages(void)
+{
+    eOytask_cfg_t cfg = { eoy_task_type_messagedriven, 0, -1, TEST_TASK_queuesize, eok_reltimeINFINITE, 0, NULL, s_test_task_run_message, &s_test_task_seen, "test.msg" };
+    EOYtask *tsk = NULL;
+    eOytask_stats_t stats;
+    uint32_t i = 0;
+    eObool_t ok = eobool_true;
+
+    memset(&s_test_task_seen, 0, sizeof(s_test_task_seen));
+    s_test_task_seen.next = 1;
+    tsk = eoy_task_New(&cfg);
+
+    s_test_task_check((eores_NOK_unsupported == eov_task_tskSetEvent(tsk, 0x1)) ? eobool_true : eobool_false, "event to a message-driven task");
+
+    // run() holds the first message, thus the queue fills up and the next message is rejected
+    eov_task_tskSendMessage(tsk, 1, eok_reltimeINFINITE);
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.runs, 1), "first message delivered");
+    for(i=2; i<2+TEST_TASK_queuesize; i++)
+    {
+        ok = (eores_OK == eov_task_isrSendMessage(tsk, i)) ? ok : eobool_false;
+    }
+    s_test_task_check(ok, "messages up to the capacity of the queue");
+    s_test_task_check((eores_NOK_timeout == eov_task_isrSendMessage(tsk, 1000000)) ? eobool_true : eobool_false, "message to a full queue");
+    s_test_task_check((eores_NOK_timeout == eov_task_tskSendMessage(tsk, 1000000, 1000)) ? eobool_true : eobool_false, "timed message to a full queue");
+    EO_atomic_store_release(&s_test_task_seen.gate, 1);
+
+    // the other messages wait for a free slot
+    ok = eobool_true;
+    for(i=2+TEST_TASK_queuesize; i<=TEST_TASK_messages; i++)
+    {
+        ok = (eores_OK == eov_task_tskSendMessage(tsk, i, eok_reltimeINFINITE)) ? ok : eobool_false;
+    }
+    s_test_task_check(ok, "messages sent waiting for the queue");
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.runs, TEST_TASK_messages), "messages delivered");
+    s_test_task_check(((TEST_TASK_messages*(TEST_TASK_messages+1)/2) == EO_atomic_load_acquire(&s_test_task_seen.sum)) ? eobool_true : eobool_false, "sum of the messages");
+    s_test_task_check((0 == EO_atomic_load_acquire(&s_test_task_seen.errors)) ? eobool_true : eobool_false, "messages in order on the thread of the task");
+
+    eoy_task_Stats_Get(tsk, &stats);
+    s_test_task_check(((2 == stats.rejected) && (TEST_TASK_messages == stats.activations)) ? eobool_true : eobool_false, "statistics of the message-driven task");
+
+    eoy_task_Delete(tsk);
+}
+
+
+static void s_test_task_callbacks(void)
+{
+    eOytask_cfg_t cfg = { eoy_task_type_callbackdriven, 0, -1, 8, eok_reltimeINFINITE, 0, NULL, NULL, &s_test_task_seen, "test.cbk" };
+    EOYtask *tsk = NULL;
+    uint32_t i = 0;
+    eObool_t ok = eobool_true;
+
+    memset(&s_test_task_seen, 0, sizeof(s_test_task_seen));
+    tsk = eoy_task_New(&cfg);
+
+    s_test_task_check((eores_NOK_unsupported == eov_task_tskSendMessage(tsk, 1, eok_reltimeZERO)) ? eobool_true : eobool_false, "message to a callback-driven task");
+    s_test_task_check((eores_NOK_nullpointer == eov_task_tskExecCallback(tsk, NULL, NULL, eok_reltimeZERO)) ? eobool_true : eobool_false, "NULL callback");
+
+    // the argument of the callback is its position, so that the callback verifies the order
+    for(i=0; i<TEST_TASK_callbacks; i++)
+    {
+        ok = (eores_OK == eov_task_tskExecCallback(tsk, s_test_task_callback, (void*)(uintptr_t)i, eok_reltimeINFINITE)) ? ok : eobool_false;
+    }
+    s_test_task_check(ok, "callbacks sent");
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.runs, TEST_TASK_callbacks), "callbacks executed");
+    s_test_task_check((0 == EO_atomic_load_acquire(&s_test_task_seen.errors)) ? eobool_true : eobool_false, "callbacks in order on the thread of the task");
+
+    eoy_task_Delete(tsk);
+}
+
+
+static void s_test_task_periodic(void)
+{
+    eOytask_cfg_t cfg = { eoy_task_type_periodic, 0, -1, 4, 2000, 0, NULL, s_test_task_run_periodic, &s_test_task_seen, "test.per" };
+    EOYtask *tsk = NULL;
+
+    memset(&s_test_task_seen, 0, sizeof(s_test_task_seen));
+    tsk = eoy_task_New(&cfg);
+
+    s_test_task_check((eores_NOK_unsupported == eov_task_tskSendMessage(tsk, 1, eok_reltimeZERO)) ? eobool_true : eobool_false, "message to a periodic task");
+
+    // a periodic task takes the events and executes the callbacks before run()
+    eov_task_tskSetEvent(tsk, 0x4);
+    s_test_task_check((eores_OK == eov_task_tskExecCallback(tsk, s_test_task_callback, (void*)(uintptr_t)0, eok_reltimeINFINITE)) ? eobool_true : eobool_false, "callback to a periodic task");
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.sum, 1), "callback executed by a periodic task");
+    s_test_task_check(s_test_task_wait(&s_test_task_seen.timeouts, 10), "periodic activations");
+    s_test_task_check((0x4 == (0x4 & EO_atomic_load_acquire(&s_test_task_seen.events))) ? eobool_true : eobool_false, "event to a periodic task");
+    s_test_task_check((0 == EO_atomic_load_acquire(&s_test_task_seen.errors)) ? eobool_true : eobool_false, "periodic task on its thread");
+
+    eoy_task_Delete(tsk);
+}
+
+
+static void s_test_task_run_event(EOYtask *tsk, uint32_t evt)
+{
+    test_task_seen_t *seen = (test_task_seen_t*) eoy_task_GetExternalData(tsk);
+    uint32_t bits = 0;
+    uint32_t e = evt;
+
+    s_test_task_onthread(seen, tsk);
+
+    if(0 == evt)
+    {
+        EO_atomic_store_release(&seen->timeouts, seen->timeouts + 1);
+        return;
+    }
+
+    // sum counts the events received, whether they arrive together or not
+    for(bits=0; 0 != e; e &= e - 1)
+    {
+        bits++;
+    }
+
+    EO_atomic_store_release(&seen->events, seen->events | evt);
+    EO_atomic_store_release(&seen->sum, seen->sum + bits);
+}
+
+
+static void s_test_task_run_message(EOYtask *tsk, uint32_t msg)
+{
+    test_task_seen_t *seen = (test_task_seen_t*) eoy_task_GetExternalData(tsk);
+
+    s_test_task_onthread(seen, tsk);
+
+    if(msg != seen->next)
+    {
+        EO_atomic_store_release(&seen->errors, seen->errors + 1);
+    }
+    seen->next = msg + 1;
+
+    EO_atomic_store_release(&seen->sum, seen->sum + msg);
+    EO_atomic_store_release(&seen->runs, seen->runs + 1);
+
+    while(0 == EO_atomic_load_acquire(&seen->gate))
+    {
+        s_test_task_sleep(100);
+    }
+}
+
+
+// timeouts counts the activations of the periodic task, events the events it has received
+static void s_test_task_run_periodic(EOYtask *tsk, uint32_t evt)
+{
+    test_task_seen_t *seen = (test_task_seen_t*) eoy_task_GetExternalData(tsk);
+
+    s_test_task_onthread(seen, tsk);
+
+    EO_atomic_store_release(&seen->events, seen->events | evt);
+    EO_atomic_store_release(&seen->timeouts, seen->timeouts + 1);
+}
+
+
+static void s_test_task_callback(void *arg)
+{
+    EOVtaskDerived *tsk = eov_sys_GetRunningTask(eov_sys_GetHandle());
+    test_task_seen_t *seen = (NULL == tsk) ? (NULL) : ((test_task_seen_t*) eoy_task_GetExternalData((EOYtask*)tsk));
+
+    if(NULL == seen)
+    {
+        EO_atomic_store_release(&s_test_task_seen.errors, s_test_task_seen.errors + 1);
+        return;
+    }
+
+    if((uint32_t)(uintptr_t)arg != seen->next)
+    {
+        EO_atomic_store_release(&seen->errors, seen->errors + 1);
+    }
+    seen->next++;
+
+    EO_atomic_store_release(&seen->sum, seen->sum + 1);
+    EO_atomic_store_release(&seen->runs, seen->runs + 1);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
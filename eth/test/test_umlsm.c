@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "stdio.h"
+#include "stdlib.h"
+
+#include "EoCommon.h"
+#include "EOtheMemoryPool.h"
+#include "EOYtheSystem.h"
+
+// the test needs the jump table, to run the same machine with and without it
+#include "EOumlsm_hid.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define TEST_UMLSM_events           200000
+
+// the machines are reset every so many events
+#define TEST_UMLSM_resetperiod      10000
+
+// the highest trigger is 6, thus the random events are in [0, 7) plus eo_umlsm_evNONE
+#define TEST_UMLSM_numberofevents   7
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// the dynamic data of a machine. every action, guard and transition folds its name into trace, and seed drives the
+// results of the guards and the internal events, so that two machines with the same trace took the same path.
+typedef struct
+{
+    uint32_t        seed;
+    uint32_t        trace;
+    uint32_t        calls;
+} test_umlsm_data_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_umlsm_log(EOumlsm *p, const char *name);
+static void s_test_umlsm_action(EOumlsm *p, const char *name);
+static eObool_t s_test_umlsm_guard(EOumlsm *p, const char *name, uint32_t modulo);
+static void s_test_umlsm_reset(EOumlsm *p);
+
+static void s_test_umlsm_onentry_top(EOumlsm *p);
+static void s_test_umlsm_onexit_top(EOumlsm *p);
+static void s_test_umlsm_onentry_A(EOumlsm *p);
+static void s_test_umlsm_onexit_A(EOumlsm *p);
+static void s_test_umlsm_onentry_B(EOumlsm *p);
+static void s_test_umlsm_onexit_B(EOumlsm *p);
+static void s_test_umlsm_onentry_A1(EOumlsm *p);
+static void s_test_umlsm_onexit_A1(EOumlsm *p);
+static void s_test_umlsm_onentry_A2(EOumlsm *p);
+static void s_test_umlsm_onexit_A2(EOumlsm *p);
+static void s_test_umlsm_onentry_B1(EOumlsm *p);
+static void s_test_umlsm_onexit_B1(EOumlsm *p);
+static void s_test_umlsm_onentry_C(EOumlsm *p);
+static void s_test_umlsm_onexit_C(EOumlsm *p);
+static void s_test_umlsm_ontrans_0(EOumlsm *p);
+static void s_test_umlsm_ontrans_1(EOumlsm *p);
+static void s_test_umlsm_ontrans_2(EOumlsm *p);
+static eObool_t s_test_umlsm_guard_0(EOumlsm *p);
+static eObool_t s_test_umlsm_guard_1(EOumlsm *p);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+// the states: 0 top, 1 A inside top, 2 B inside top, 3 A1 inside A, 4 A2 inside A, 5 B1 inside B, 6 C alone.
+// the transitions of the owners are inherited, some events are handled at more levels and some guards are false.
+static const uint8_t s_test_umlsm_owners_top[] = { 0 };
+static const uint8_t s_test_umlsm_owners_A[]   = { 1, 0 };
+static const uint8_t s_test_umlsm_owners_B[]   = { 2, 0 };
+static const uint8_t s_test_umlsm_owners_A1[]  = { 3, 1, 0 };
+static const uint8_t s_test_umlsm_owners_A2[]  = { 4, 1, 0 };
+static const uint8_t s_test_umlsm_owners_B1[]  = { 5, 2, 0 };
+static const uint8_t s_test_umlsm_owners_C[]   = { 6 };
+
+static eOumlsmTransition_t s_test_umlsm_trans_top[] =
+{
+    { 0, 6, NULL,                   s_test_umlsm_ontrans_0 },
+    { 1, 2, s_test_umlsm_guard_0,   NULL },
+    { 1, 1, NULL,                   s_test_umlsm_ontrans_1 }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_A[] =
+{
+    { 2, 4, s_test_umlsm_guard_1,   s_test_umlsm_ontrans_2 },
+    { 3, 2, NULL,                   NULL }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_B[] =
+{
+    { 2, 1, NULL,                   s_test_umlsm_ontrans_0 },
+    { 4, 5, s_test_umlsm_guard_0,   s_test_umlsm_ontrans_1 }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_A1[] =
+{
+    { 4, 4, NULL,                   NULL },
+    { 2, 3, s_test_umlsm_guard_0,   NULL },
+    { 5, 0, NULL,                   s_test_umlsm_ontrans_2 }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_A2[] =
+{
+    { 4, 3, s_test_umlsm_guard_1,   s_test_umlsm_ontrans_1 },
+    { 5, 2, s_test_umlsm_guard_0,   NULL },
+    { 5, 6, NULL,                   NULL }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_B1[] =
+{
+    { 1, 5, NULL,                   s_test_umlsm_ontrans_0 },
+    { 3, 4, s_test_umlsm_guard_1,   NULL }
+};
+
+static eOumlsmTransition_t s_test_umlsm_trans_C[] =
+{
+    { 0, 0, NULL,                   s_test_umlsm_ontrans_1 },
+    { 1, 4, s_test_umlsm_guard_0,   s_test_umlsm_ontrans_2 },
+    { 2, 5, NULL,                   NULL },
+    { 6, 6, NULL,                   NULL }
+};
+
+static eOumlsmState_t s_test_umlsm_states[] =
+{
+    { "top", 1,                 1, s_test_umlsm_owners_top, 3, s_test_umlsm_trans_top, s_test_umlsm_onentry_top, s_test_umlsm_onexit_top },
+    { "A",   3,                 2, s_test_umlsm_owners_A,   2, s_test_umlsm_trans_A,   s_test_umlsm_onentry_A,   s_test_umlsm_onexit_A },
+    { "B",   5,                 2, s_test_umlsm_owners_B,   2, s_test_umlsm_trans_B,   s_test_umlsm_onentry_B,   s_test_umlsm_onexit_B },
+    { "A1",  EOK_uint08dummy,   3, s_test_umlsm_owners_A1,  3, s_test_umlsm_trans_A1,  s_test_umlsm_onentry_A1,  s_test_umlsm_onexit_A1 },
+    { "A2",  EOK_uint08dummy,   3, s_test_umlsm_owners_A2,  3, s_test_umlsm_trans_A2,  s_test_umlsm_onentry_A2,  s_test_umlsm_onexit_A2 },
+    { "B1",  EOK_uint08dummy,   3, s_test_umlsm_owners_B1,  2, s_test_umlsm_trans_B1,  s_test_umlsm_onentry_B1,  s_test_umlsm_onexit_B1 },
+    { "C",   EOK_uint08dummy,   1, s_test_umlsm_owners_C,   4, s_test_umlsm_trans_C,   s_test_umlsm_onentry_C,   s_test_umlsm_onexit_C }
+};
+
+static const eOumlsm_cfg_t s_test_umlsm_cfg =
+{
+    EO_INIT(.sizeofdynamicdata)         sizeof(test_umlsm_data_t),
+    EO_INIT(.initial_state)             0,
+    EO_INIT(.internal_event_fifo_size)  8,
+    EO_INIT(.states_number)             7,
+    EO_INIT(.states_table)              s_test_umlsm_states,
+    EO_INIT(.resetdynamicdata_fn)       s_test_umlsm_reset
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// it feeds the same random events, in both consume modes, to a machine which uses the jump table and to one which
+// scans the tables of the states, and it verifies after every event that both took the same path.
+int main(void)
+{
+    EOumlsm *compiled = NULL;
+    EOumlsm *interpretive = NULL;
+    test_umlsm_data_t *c = NULL;
+    test_umlsm_data_t *i = NULL;
+    eOumlsmEvent_t ev = 0;
+    eOumlsmConsumeMode_t consume = eo_umlsm_consume_ONE;
+    uint32_t transitions = 0;
+    uint32_t n = 0;
+    uint8_t rc = 0;
+    uint8_t ri = 0;
+
+    eoy_sys_Initialise(NULL, NULL, NULL);
+
+    compiled = eo_umlsm_New(&s_test_umlsm_cfg);
+    interpretive = eo_umlsm_New(&s_test_umlsm_cfg);
+
+    if(NULL == compiled->jumptable)
+    {
+        printf("test_umlsm: the EOumlsm is built without jump table, nothing to compare\n");
+        return(0);
+    }
+
+    // the interpretive path is used when there is no jump table
+    interpretive->jumptable = NULL;
+
+    c = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(compiled);
+    i = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(interpretive);
+
+    srand(7);
+
+    for(n=0; n<TEST_UMLSM_events; n++)
+    {
+        ev = (eOumlsmEvent_t)(rand() % (TEST_UMLSM_numberofevents + 1));
+        if(TEST_UMLSM_numberofevents == ev)
+        {
+            ev = eo_umlsm_evNONE;
+        }
+        consume = (0 != (rand() & 1)) ? (eo_umlsm_consume_ONE) : (eo_umlsm_consume_UPTO08);
+
+        rc = eo_umlsm_ProcessEvent(compiled, ev, consume);
+        ri = eo_umlsm_ProcessEvent(interpretive, ev, consume);
+
+        if((rc != ri) || (compiled->activestate != interpretive->activestate) ||
+           (c->trace != i->trace) || (c->calls != i->calls) || (c->seed != i->seed))
+        {
+            printf("test_umlsm: FAILED at event #%u (%u, consume %u): transitions %u vs %u, state %u vs %u, calls %u vs %u\n",
+                   n, ev, consume, rc, ri, compiled->activestate, interpretive->activestate, c->calls, i->calls);
+            return(1);
+        }
+
+        transitions += rc;
+
+        if((TEST_UMLSM_resetperiod - 1) == (n % TEST_UMLSM_resetperiod))
+        {
+            eo_umlsm_Reset(compiled);
+            eo_umlsm_Reset(interpretive);
+        }
+    }
+
+    printf("test_umlsm: OK, %u events, %u transitions, %u calls\n", n, transitions, c->calls);
+
+    return(0);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void s_test_umlsm_log(EOumlsm *p, const char *name)
+{
+    test_umlsm_data_t *d = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(p);
+
+    for(; '\0' != *name; name++)
+    {
+        d->trace = d->trace * 31 + (uint8_t)(*name);
+    }
+    d->seed = d->seed * 1103515245 + 12345 + d->trace;
+    d->calls++;
+}
+
+
+// an action may also put an internal event
+static void s_test_umlsm_action(EOumlsm *p, const char *name)
+{
+    test_umlsm_data_t *d = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(p);
+
+    s_test_umlsm_log(p, name);
+
+    if(0 == ((d->seed >> 20) % 5))
+    {
+        eo_umlsm_PutInternalEvent(p, (eOumlsmEvent_t)((d->seed >> 8) % 6));
+    }
+}
+
+
+static eObool_t s_test_umlsm_guard(EOumlsm *p, const char *name, uint32_t modulo)
+{
+    test_umlsm_data_t *d = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(p);
+
+    s_test_umlsm_log(p, name);
+
+    return((0 == ((d->seed >> 16) % modulo)) ? (eobool_true) : (eobool_false));
+}
+
+
+static void s_test_umlsm_reset(EOumlsm *p)
+{
+    test_umlsm_data_t *d = (test_umlsm_data_t*)eo_umlsm_GetDynamicData(p);
+
+    // the trace and the calls survive the reset, so that they cover the whole run
+    d->seed = 1;
+}
+
+
+static void s_test_umlsm_onentry_top(EOumlsm *p) { s_test_umlsm_action(p, "en-top"); }
+static void s_test_umlsm_onexit_top(EOumlsm *p)  { s_test_umlsm_action(p, "ex-top"); }
+static void s_test_umlsm_onentry_A(EOumlsm *p)   { s_test_umlsm_action(p, "en-A"); }
+static void s_test_umlsm_onexit_A(EOumlsm *p)    { s_test_umlsm_action(p, "ex-A"); }
+static void s_test_umlsm_onentry_B(EOumlsm *p)   { s_test_umlsm_action(p, "en-B"); }
+static void s_test_umlsm_onexit_B(EOumlsm *p)    { s_test_umlsm_action(p, "ex-B"); }
+static void s_test_umlsm_onentry_A1(EOumlsm *p)  { s_test_umlsm_action(p, "en-A1"); }
+static void s_test_umlsm_onexit_A1(EOumlsm *p)   { s_test_umlsm_action(p, "ex-A1"); }
+static void s_test_umlsm_onentry_A2(EOumlsm *p)  { s_test_umlsm_action(p, "en-A2"); }
+static void s_test_umlsm_onexit_A2(EOumlsm *p)   { s_test_umlsm_action(p, "ex-A2"); }
+static void s_test_umlsm_onentry_B1(EOumlsm *p)  { s_test_umlsm_action(p, "en-B1"); }
+static void s_test_umlsm_onexit_B1(EOumlsm *p)   { s_test_umlsm_action(p, "ex-B1"); }
+static void s_test_umlsm_onentry_C(EOumlsm *p)   { s_test_umlsm_action(p, "en-C"); }
+static void s_test_umlsm_onexit_C(EOumlsm *p)    { s_test_umlsm_action(p, "ex-C"); }
+static void s_test_umlsm_ontrans_0(EOumlsm *p)   { s_test_umlsm_action(p, "tr-0"); }
+static void s_test_umlsm_ontrans_1(EOumlsm *p)   { s_test_umlsm_action(p, "tr-1"); }
+static void s_test_umlsm_ontrans_2(EOumlsm *p)   { s_test_umlsm_action(p, "tr-2"); }
+static eObool_t s_test_umlsm_guard_0(EOumlsm *p) { return(s_test_umlsm_guard(p, "gu-0", 2)); }
+static eObool_t s_test_umlsm_guard_1(EOumlsm *p) { return(s_test_umlsm_guard(p, "gu-1", 3)); }
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+